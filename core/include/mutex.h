@@ -98,6 +98,35 @@
  *     - The scheduler is run, so that if the unblocked waiting thread can
  *       run now, in case it has a higher priority than the running thread.
  *
+ * Priority Inheritance
+ * --------------------
+ *
+ * With the module `core_mutex_priority_inheritance` the owner of a mutex
+ * inherits the priority of the highest priority thread waiting for it, using
+ * `sched_change_priority()`:
+ *
+ * - When a thread blocks on a mutex owned by a lower priority thread, the
+ *   owner is raised to the priority of the blocking thread. If the owner is
+ *   itself blocked on another mutex, its place in that waiting list is updated
+ *   and the inheritance continues along the chain of owners.
+ * - When a thread returns a mutex, or a waiter is cancelled, the owner falls
+ *   back to the highest priority of the threads still waiting for any of the
+ *   mutexes it holds, or to its own priority if there are none. This keeps a
+ *   thread holding several mutexes boosted until it returned all mutexes the
+ *   boosting threads wait for, regardless of the order they are returned in.
+ * - Ownership is passed on to the waiter woken by `mutex_unlock()`.
+ *
+ * The owner of a mutex is only known if it was locked by a thread, so a mutex
+ * initialized with `MUTEX_INIT_LOCKED` or unlocked from an ISR to signal a
+ * thread does not pass on priorities until it is locked by a thread. Changing
+ * the priority of a thread with `sched_change_priority()` while it inherits a
+ * priority is undone once it returns the mutexes.
+ *
+ * Falling back to a lower priority looks at all threads blocked on a mutex,
+ * which is done with interrupts disabled. This only happens when the owner
+ * actually inherited a priority; locking and unlocking without contention
+ * costs no more than without priority inheritance.
+ *
  * Debugging deadlocks
  * -------------------
  *
@@ -155,7 +184,7 @@ typedef struct {
     /**
      * @brief   The current owner of the mutex or `NULL`
      * @note    Only available if module core_mutex_priority_inheritance
-     *          is used.
+     *          or core_mutex_debug is used.
      *
      * If either the mutex is not locked or the mutex is not locked by a thread
      * (e.g. because it is used to synchronize a thread with an ISR completion),
@@ -173,14 +202,6 @@ typedef struct {
      */
     uinttxtptr_t owner_calling_pc;
 #endif
-#if defined(DOXYGEN) || defined(MODULE_CORE_MUTEX_PRIORITY_INHERITANCE)
-    /**
-     * @brief   Original priority of the owner
-     * @note    Only available if module core_mutex_priority_inheritance
-     *          is used.
-     */
-    uint8_t owner_original_priority;
-#endif
 } mutex_t;
 
 /**
@@ -192,6 +192,13 @@ struct _thread {
     msg_t *msg_array;               /**< memory holding messages sent
                                          to this thread's message queue */
 #endif
+#if defined(MODULE_CORE_MUTEX_PRIORITY_INHERITANCE) || defined(DOXYGEN)
+    void *mutex_waiting;            /**< mutex the thread is blocked on */
+    uint8_t base_priority;          /**< priority before inheriting one
+                                         from a mutex waiter, or
+                                         SCHED_PRIO_LEVELS if the thread
+                                         does not inherit a priority    */
+#endif
 #if defined(DEVELHELP) || IS_ACTIVE(SCHED_TEST_STACK) \
     || defined(MODULE_MPU_STACK_GUARD) || defined(DOXYGEN)
     char *stack_start;              /**< thread's stack start address   */
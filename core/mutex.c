@@ -36,6 +36,119 @@
 
 #if MAXTHREADS > 1
 
+#if IS_USED(MODULE_CORE_MUTEX_PRIORITY_INHERITANCE)
+/**
+ * @brief   Move @p thread, which was blocked on a mutex, to the position in
+ *          the waiting list matching its new priority
+ * @pre     IRQs are disabled
+ */
+static void _requeue(thread_t *thread)
+{
+    mutex_t *mutex = thread->mutex_waiting;
+
+    list_remove(&mutex->queue, (list_node_t *)&thread->rq_entry);
+    thread_add_to_list(&mutex->queue, thread);
+}
+
+/**
+ * @brief   Let the owner of @p mutex inherit the priority of @p me, which is
+ *          about to block on @p mutex
+ * @pre     IRQs are disabled
+ */
+static void _inherit_priority(mutex_t *mutex, thread_t *me)
+{
+    me->mutex_waiting = mutex;
+    /* follow owners blocked on further mutexes, the chain can't be longer
+     * than the number of threads unless there is a deadlock */
+    for (unsigned i = 0; i < MAXTHREADS; i++) {
+        thread_t *owner = thread_get(mutex->owner);
+
+        if ((owner == NULL) || (owner->priority <= me->priority)) {
+            return;
+        }
+        DEBUG("PID[%" PRIkernel_pid "] prio of %" PRIkernel_pid
+              ": %u --> %u\n",
+              thread_getpid(), owner->pid,
+              (unsigned)owner->priority, (unsigned)me->priority);
+        if (owner->base_priority == SCHED_PRIO_LEVELS) {
+            owner->base_priority = owner->priority;
+        }
+        sched_change_priority(owner, me->priority);
+        if (owner->status != STATUS_MUTEX_BLOCKED) {
+            return;
+        }
+        _requeue(owner);
+        mutex = owner->mutex_waiting;
+    }
+}
+
+/**
+ * @brief   Let @p thread fall back to the highest priority of the threads
+ *          still waiting for a mutex it holds, or to its own priority
+ * @pre     IRQs are disabled
+ */
+static void _restore_priority(thread_t *thread)
+{
+    for (unsigned i = 0; (thread != NULL) && (i < MAXTHREADS); i++) {
+        if (thread->base_priority == SCHED_PRIO_LEVELS) {
+            /* does not inherit a priority */
+            return;
+        }
+
+        uint8_t priority = thread->base_priority;
+
+        for (kernel_pid_t pid = KERNEL_PID_FIRST; pid <= KERNEL_PID_LAST;
+             pid++) {
+            thread_t *waiter = thread_get(pid);
+
+            if ((waiter != NULL) && (waiter->status == STATUS_MUTEX_BLOCKED)
+                && (waiter->mutex_waiting != NULL)
+                && (waiter->priority < priority)
+                && (((mutex_t *)waiter->mutex_waiting)->owner == thread->pid)) {
+                priority = waiter->priority;
+            }
+        }
+        if (priority == thread->base_priority) {
+            thread->base_priority = SCHED_PRIO_LEVELS;
+        }
+        if (priority == thread->priority) {
+            return;
+        }
+        DEBUG("PID[%" PRIkernel_pid "] prio %u --> %u\n",
+              thread->pid, (unsigned)thread->priority, (unsigned)priority);
+        sched_change_priority(thread, priority);
+        if (thread->status != STATUS_MUTEX_BLOCKED) {
+            return;
+        }
+        /* the owner of the mutex the thread is blocked on may have inherited
+         * the priority from it */
+        _requeue(thread);
+        thread = thread_get(((mutex_t *)thread->mutex_waiting)->owner);
+    }
+}
+#endif
+
+/**
+ * @brief   Pass the ownership of @p mutex to @p thread
+ * @pre     IRQs are disabled
+ */
+static inline void _set_owner(mutex_t *mutex, thread_t *thread)
+{
+    (void)mutex;
+    (void)thread;
+#if IS_USED(MODULE_CORE_MUTEX_PRIORITY_INHERITANCE) \
+    || IS_USED(MODULE_CORE_MUTEX_DEBUG)
+    kernel_pid_t previous = mutex->owner;
+
+    mutex->owner = (thread) ? thread->pid : KERNEL_PID_UNDEF;
+#  if IS_USED(MODULE_CORE_MUTEX_PRIORITY_INHERITANCE)
+    _restore_priority(thread_get(previous));
+#  else
+    (void)previous;
+#  endif
+#endif
+}
+
 /**
  * @brief   Block waiting for a locked mutex
  * @pre     IRQs are disabled
@@ -76,20 +189,16 @@ void _block(mutex_t *mutex,
         thread_add_to_list(&mutex->queue, me);
     }
 
-#ifdef MODULE_CORE_MUTEX_PRIORITY_INHERITANCE
-    thread_t *owner = thread_get(mutex->owner);
-    if ((owner) && (owner->priority > me->priority)) {
-        DEBUG("PID[%" PRIkernel_pid "] prio of %" PRIkernel_pid
-              ": %u --> %u\n",
-              thread_getpid(), mutex->owner,
-              (unsigned)owner->priority, (unsigned)me->priority);
-        sched_change_priority(owner, me->priority);
-    }
+#if IS_USED(MODULE_CORE_MUTEX_PRIORITY_INHERITANCE)
+    _inherit_priority(mutex, me);
 #endif
 
     irq_restore(irq_state);
     thread_yield_higher();
     /* We were woken up by scheduler. Waker removed us from queue. */
+#if IS_USED(MODULE_CORE_MUTEX_PRIORITY_INHERITANCE)
+    me->mutex_waiting = NULL;
+#endif
 #if IS_USED(MODULE_CORE_MUTEX_DEBUG)
     mutex->owner_calling_pc = pc;
 #endif
@@ -116,9 +225,6 @@ bool mutex_lock_internal(mutex_t *mutex, bool block)
 #endif
 #if IS_USED(MODULE_CORE_MUTEX_DEBUG)
         mutex->owner_calling_pc = pc;
-#endif
-#if IS_USED(MODULE_CORE_MUTEX_PRIORITY_INHERITANCE)
-        mutex->owner_original_priority = me->priority;
 #endif
         DEBUG("PID[%" PRIkernel_pid "] mutex_lock(): early out.\n",
               thread_getpid());
@@ -165,9 +271,6 @@ int mutex_lock_cancelable(mutex_cancel_t *mc)
 #endif
 #if IS_USED(MODULE_CORE_MUTEX_DEBUG)
         mutex->owner_calling_pc = pc;
-#endif
-#if IS_USED(MODULE_CORE_MUTEX_PRIORITY_INHERITANCE)
-        mutex->owner_original_priority = me->priority;
 #endif
         DEBUG("PID[%" PRIkernel_pid "] mutex_lock_cancelable() early out.\n",
               thread_getpid());
@@ -200,6 +303,7 @@ void mutex_unlock(mutex_t *mutex)
     if (mutex->queue.next == MUTEX_LOCKED) {
         mutex->queue.next = NULL;
         /* the mutex was locked and no thread was waiting for it */
+        _set_owner(mutex, NULL);
         irq_restore(irqstate);
         return;
     }
@@ -216,17 +320,10 @@ void mutex_unlock(mutex_t *mutex)
         mutex->queue.next = MUTEX_LOCKED;
     }
 
+    _set_owner(mutex, process);
+
     uint16_t process_priority = process->priority;
 
-#if IS_USED(MODULE_CORE_MUTEX_PRIORITY_INHERITANCE)
-    thread_t *owner = thread_get(mutex->owner);
-    if ((owner) && (owner->priority != mutex->owner_original_priority)) {
-        DEBUG("PID[%" PRIkernel_pid "] prio %u --> %u\n",
-              owner->pid, (unsigned)owner->priority,
-              (unsigned)mutex->owner_original_priority);
-        sched_change_priority(owner, mutex->owner_original_priority);
-    }
-#endif
 #if IS_USED(MODULE_CORE_MUTEX_DEBUG)
     mutex->owner_calling_pc = 0;
 #endif
@@ -244,6 +341,7 @@ void mutex_unlock_and_sleep(mutex_t *mutex)
     if (mutex->queue.next) {
         if (mutex->queue.next == MUTEX_LOCKED) {
             mutex->queue.next = NULL;
+            _set_owner(mutex, NULL);
         }
         else {
             list_node_t *next = list_remove_head(&mutex->queue);
@@ -255,6 +353,7 @@ void mutex_unlock_and_sleep(mutex_t *mutex)
             if (!mutex->queue.next) {
                 mutex->queue.next = MUTEX_LOCKED;
             }
+            _set_owner(mutex, process);
         }
     }
 
@@ -289,6 +388,10 @@ void mutex_cancel(mutex_cancel_t *mc)
             mutex->queue.next = MUTEX_LOCKED;
         }
         sched_set_status(thread, STATUS_PENDING);
+#if IS_USED(MODULE_CORE_MUTEX_PRIORITY_INHERITANCE)
+        /* the owner may have inherited the priority of the cancelled thread */
+        _restore_priority(thread_get(mutex->owner));
+#endif
         irq_restore(irq_state);
         sched_switch(thread->priority);
         return;
@@ -267,6 +267,9 @@ void sched_set_status(thread_t *process, thread_status_t status)
     if (status >= STATUS_ON_RUNQUEUE) {
         if (!(process->status >= STATUS_ON_RUNQUEUE)) {
             _runqueue_push(process, process->priority);
+#if (IS_USED(MODULE_SCHED_WAKEUP_CALLBACK))
+            sched_wakeup_callback(process);
+#endif
         }
     }
     else {
@@ -61,6 +61,7 @@
 #include <sys/time.h>
 #include <sys/stat.h>
 #include <sys/statvfs.h>
+#include <sys/socket.h>
 #include <sys/uio.h>
 #include <dirent.h>
 
@@ -113,6 +114,7 @@ extern int (*real_accept)(int socket, ...);
 extern int (*real_bind)(int socket, ...);
 extern int (*real_connect)(int socket, ...);
 extern ssize_t (*real_recv)(int sockfd, void *buf, size_t len, int flags);
+extern ssize_t (*real_recvmsg)(int sockfd, struct msghdr *msg, int flags);
 extern int (*real_chdir)(const char *path);
 extern int (*real_close)(int);
 extern int (*real_fcntl)(int, int, ...);
@@ -490,17 +490,17 @@ static int _read(ieee802154_dev_t *dev, void *buf, size_t max_size,
     int res;
     socket_zep_t *zepdev = dev->priv;
     size_t frame_len = max_size + sizeof(zep_v2_data_hdr_t) + 2;
+    zep_v2_data_hdr_t zep;
+    /* scatter the frame right into buf, only the ZEP header is read aside */
+    struct iovec iov[] = {
+        { .iov_base = &zep, .iov_len = sizeof(zep) },
+        { .iov_base = buf, .iov_len = max_size },
+    };
+    struct msghdr msg = { .msg_iov = iov, .msg_iovlen = ARRAY_SIZE(iov) };
 
     DEBUG("socket_zep::read: reading up to %zu bytes into %p\n", max_size, buf);
 
-    if (frame_len > sizeof(zepdev->rcv_buf)) {
-        DEBUG("socket_zep::read: frame size (%zu) exceeds RX  buffer (%zu bytes)\n",
-              frame_len, sizeof(zepdev->rcv_buf));
-        res = -ENOBUFS;
-        goto out;
-    }
-
-    res = real_recv(zepdev->sock_fd, zepdev->rcv_buf, frame_len, MSG_TRUNC);
+    res = real_recvmsg(zepdev->sock_fd, &msg, MSG_TRUNC);
 
     DEBUG("socket_zep::read: got %d/%zu bytes\n", res, frame_len);
 
@@ -510,50 +510,45 @@ static int _read(ieee802154_dev_t *dev, void *buf, size_t max_size,
         goto out;
     }
 
-    zep_hdr_t *tmp = (zep_hdr_t *)zepdev->rcv_buf;
-
-    if ((tmp->preamble[0] != 'E') || (tmp->preamble[1] != 'X')) {
+    if ((zep.hdr.preamble[0] != 'E') || (zep.hdr.preamble[1] != 'X')) {
         DEBUG("socket_zep::read: invalid ZEP header\n");
         res = -EINVAL;
         goto out;
     }
 
-    if (tmp->version != 2) {
-        DEBUG("socket_zep::read: unsupported ZEP version %u\n", tmp->version);
+    if (zep.hdr.version != 2) {
+        DEBUG("socket_zep::read: unsupported ZEP version %u\n", zep.hdr.version);
         res = -EINVAL;
         goto out;
     }
 
-    switch (((zep_v2_ack_hdr_t *)tmp)->type) {
+    switch (zep.type) {
     case ZEP_V2_TYPE_DATA: {
-        zep_v2_data_hdr_t *zep = (zep_v2_data_hdr_t *)tmp;
-
-        if (zep->chan != zepdev->chan) {
+        if (zep.chan != zepdev->chan) {
             DEBUG("socket_zep::read: wrong channel\n");
             res = -EINVAL;
             break;
         }
 
         if (info) {
-            info->lqi = zep->lqi_val;
+            info->lqi = zep.lqi_val;
             info->rssi = -IEEE802154_RADIO_RSSI_OFFSET;
         }
 
-        if (_dst_not_me(zepdev, zep + 1)) {
+        if (_dst_not_me(zepdev, buf)) {
             DEBUG("socket_zep::read: dst not me\n");
             res = -EINVAL;
             break;
         }
 
-        _send_ack(zepdev, zep + 1);
+        _send_ack(zepdev, buf);
 
-        memcpy(buf, zep + 1, max_size);
         res = max_size;
 
         break;
     }
     default:
-        DEBUG("socket_zep::read: unknown type %u\n", ((zep_v2_ack_hdr_t *)tmp)->type);
+        DEBUG("socket_zep::read: unknown type %u\n", zep.type);
         res = -EINVAL;
         break;
     }
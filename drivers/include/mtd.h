@@ -314,6 +314,59 @@ struct mtd_desc {
      */
     int (*power)(mtd_dev_t *dev, enum mtd_power_state power);
 
+#if defined(MODULE_MTD_ASYNC) || DOXYGEN
+    /**
+     * @brief   Start writing to a page without waiting for completion
+     *
+     * Optional, used by @ref drivers_mtd_async. The device must not be
+     * accessed until @ref mtd_desc::busy returned 0.
+     *
+     * @param[in] dev       Pointer to the selected driver
+     * @param[in] buff      Pointer to the data to be written
+     * @param[in] page      Page number to start writing to
+     * @param[in] offset    Byte offset from the start of the page
+     * @param[in] size      Number of bytes
+     *
+     * @retval n bytes that are being written on success
+     * @retval -ENOTSUP if the write can't be started without waiting
+     * @retval <0 value on error
+     */
+    int (*write_page_start)(mtd_dev_t *dev,
+                            const void *buff,
+                            uint32_t page,
+                            uint32_t offset,
+                            uint32_t size);
+
+    /**
+     * @brief   Start erasing a sector without waiting for completion
+     *
+     * Optional, used by @ref drivers_mtd_async. The device must not be
+     * accessed until @ref mtd_desc::busy returned 0.
+     *
+     * @param[in] dev       Pointer to the selected driver
+     * @param[in] sector    Sector number to erase
+     *
+     * @retval n expected duration of the erase in microseconds
+     * @retval -ENOTSUP if the erase can't be started without waiting
+     * @retval <0 value on error
+     */
+    int (*erase_sector_start)(mtd_dev_t *dev, uint32_t sector);
+
+    /**
+     * @brief   Check whether a started write or erase is still ongoing
+     *
+     * Required if @ref mtd_desc::write_page_start or
+     * @ref mtd_desc::erase_sector_start is implemented.
+     *
+     * @param[in] dev       Pointer to the selected driver
+     *
+     * @retval 1 if the device is still busy
+     * @retval 0 if the operation completed
+     * @retval <0 value on error
+     */
+    int (*busy)(mtd_dev_t *dev);
+#endif
+
     /**
      * @brief   Properties of the MTD driver
      */
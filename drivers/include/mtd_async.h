@@ -0,0 +1,216 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    drivers_mtd_async  Asynchronous MTD requests
+ * @ingroup     drivers_storage
+ * @brief       Queued, non-blocking access to MTD devices
+ *
+ * All functions of the @ref drivers_mtd API block the caller until the
+ * operation completed, which can take tens of milliseconds for erasing a
+ * sector of a SPI NOR flash. This module queues requests to a per-device
+ * worker that runs on an @ref sys_event "event queue" and signals completion
+ * with a callback.
+ *
+ * If the driver implements @ref mtd_desc::write_page_start,
+ * @ref mtd_desc::erase_sector_start and @ref mtd_desc::busy, the worker starts
+ * the operation and polls the device with a timer. The event queue is free to
+ * handle other events while the device is busy. Other drivers are called
+ * through the blocking API from the event queue thread.
+ *
+ * ## Usage
+ *
+ * ```
+ * USEMODULE += mtd_async
+ * ```
+ *
+ * ```
+ * static mtd_async_t worker;
+ * static mtd_async_req_t req;
+ *
+ * static void _erased(mtd_async_req_t *req, int res)
+ * {
+ *     ...
+ * }
+ *
+ * mtd_async_init(&worker, MTD_0, EVENT_PRIO_LOWEST);
+ * mtd_async_erase_sector(&worker, &req, 0, 4, _erased, NULL);
+ * ```
+ *
+ * @warning While requests are pending, the device must not be accessed other
+ *          than through its worker.
+ *
+ * @{
+ *
+ * @file
+ * @brief       Interface definitions for asynchronous MTD requests
+ */
+
+#ifndef MTD_ASYNC_H
+#define MTD_ASYNC_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "clist.h"
+#include "event.h"
+#include "mtd.h"
+#include "ztimer.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup drivers_mtd_async_config  Asynchronous MTD compile time configuration
+ * @ingroup config_drivers_storage
+ * @{
+ */
+/**
+ * @brief   Interval in microseconds to poll a busy device
+ */
+#ifndef CONFIG_MTD_ASYNC_POLL_US
+#define CONFIG_MTD_ASYNC_POLL_US    100
+#endif
+/** @} */
+
+/**
+ * @brief   Asynchronous MTD operations
+ */
+typedef enum {
+    MTD_ASYNC_OP_READ,      /**< read pages */
+    MTD_ASYNC_OP_WRITE,     /**< raw write of pages */
+    MTD_ASYNC_OP_ERASE,     /**< erase sectors */
+} mtd_async_op_t;
+
+/**
+ * @brief   Forward declaration of an asynchronous MTD request
+ */
+typedef struct mtd_async_req mtd_async_req_t;
+
+/**
+ * @brief   Completion callback of an asynchronous MTD request
+ *
+ * Called in the thread of the event queue of the worker. The request may be
+ * reused from within the callback.
+ *
+ * @param[in] req   the completed request
+ * @param[in] res   0 on success, negative errno of the MTD API on error
+ */
+typedef void (*mtd_async_cb_t)(mtd_async_req_t *req, int res);
+
+/**
+ * @brief   Asynchronous MTD request
+ *
+ * The fields are managed by the worker, the request must not be modified
+ * before its callback was called.
+ */
+struct mtd_async_req {
+    clist_node_t node;      /**< entry in the queue of the worker */
+    mtd_async_cb_t cb;      /**< completion callback */
+    void *arg;              /**< argument of the caller */
+    void *buf;              /**< remaining data of a read or write */
+    uint32_t pos;           /**< next page or sector */
+    uint32_t offset;        /**< offset within the next page */
+    uint32_t remaining;     /**< remaining bytes or sectors */
+    mtd_async_op_t op;      /**< requested operation */
+};
+
+/**
+ * @brief   Per-device worker for asynchronous MTD requests
+ */
+typedef struct {
+    mtd_dev_t *dev;         /**< MTD device */
+    event_queue_t *queue;   /**< event queue the requests are handled on */
+    event_t event;          /**< handles the next step of the current request */
+    ztimer_t timer;         /**< polls the device while it is busy */
+    clist_node_t pending;   /**< queued requests, the first one is current */
+    bool busy;              /**< device is busy with the current request */
+} mtd_async_t;
+
+/**
+ * @brief   Initialize a worker for asynchronous requests
+ *
+ * @param[out] worker   worker to initialize
+ * @param[in]  dev      initialized MTD device
+ * @param[in]  queue    event queue to handle the requests on
+ */
+void mtd_async_init(mtd_async_t *worker, mtd_dev_t *dev,
+                    event_queue_t *queue);
+
+/**
+ * @brief   Queue a read with pagewise addressing
+ *
+ * Same as @ref mtd_read_page, but returns immediately.
+ *
+ * @param[in]  worker   worker of the device
+ * @param[out] req      request, must stay valid until @p cb was called
+ * @param[out] dest     the buffer to fill in
+ * @param[in]  page     page number to start reading from
+ * @param[in]  offset   offset from the start of the page (in bytes)
+ * @param[in]  size     the number of bytes to read
+ * @param[in]  cb       completion callback
+ * @param[in]  arg      argument of the caller, stored in @p req
+ */
+void mtd_async_read_page(mtd_async_t *worker, mtd_async_req_t *req,
+                         void *dest, uint32_t page, uint32_t offset,
+                         uint32_t size, mtd_async_cb_t cb, void *arg);
+
+/**
+ * @brief   Queue a raw write with pagewise addressing
+ *
+ * Same as @ref mtd_write_page_raw, but returns immediately.
+ *
+ * @param[in]  worker   worker of the device
+ * @param[out] req      request, must stay valid until @p cb was called
+ * @param[in]  src      the buffer to write, must stay valid until @p cb was
+ *                      called
+ * @param[in]  page     page number to start writing to
+ * @param[in]  offset   byte offset from the start of the page
+ * @param[in]  size     the number of bytes to write
+ * @param[in]  cb       completion callback
+ * @param[in]  arg      argument of the caller, stored in @p req
+ */
+void mtd_async_write_page_raw(mtd_async_t *worker, mtd_async_req_t *req,
+                              const void *src, uint32_t page, uint32_t offset,
+                              uint32_t size, mtd_async_cb_t cb, void *arg);
+
+/**
+ * @brief   Queue an erase of sectors
+ *
+ * Same as @ref mtd_erase_sector, but returns immediately.
+ *
+ * @param[in]  worker   worker of the device
+ * @param[out] req      request, must stay valid until @p cb was called
+ * @param[in]  sector   the first sector number to erase
+ * @param[in]  num      the number of sectors to erase
+ * @param[in]  cb       completion callback
+ * @param[in]  arg      argument of the caller, stored in @p req
+ */
+void mtd_async_erase_sector(mtd_async_t *worker, mtd_async_req_t *req,
+                            uint32_t sector, uint32_t num,
+                            mtd_async_cb_t cb, void *arg);
+
+/**
+ * @brief   Check whether a worker has pending requests
+ *
+ * @param[in] worker    worker of the device
+ *
+ * @return  true if requests are queued or in progress
+ */
+static inline bool mtd_async_pending(const mtd_async_t *worker)
+{
+    return !clist_is_empty(&worker->pending);
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MTD_ASYNC_H */
+/** @} */
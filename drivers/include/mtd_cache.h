@@ -0,0 +1,151 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    drivers_mtd_cache  MTD write-back sector cache
+ * @ingroup     drivers_storage
+ * @brief       Write-back cache of whole sectors for MTD devices
+ *
+ * Writing a few bytes to a sector with @ref mtd_write_page reads, erases and
+ * rewrites the whole sector. Many small writes to the same sector, e.g.
+ * appending to a log, wear the flash out quickly. This MTD module keeps
+ * sectors of a backing MTD device in RAM and only erases and writes them back
+ * when
+ *
+ * - a sector is evicted to make room for another one,
+ * - @ref mtd_cache_flush is called, or
+ * - the device is powered down with @ref mtd_power.
+ *
+ * The cached device accepts writes of any size and alignment that overwrite
+ * the previous content, as signaled by @ref MTD_DRIVER_FLAG_DIRECT_WRITE.
+ *
+ * @warning Data that was not written back yet is lost on reset or power
+ *          loss.
+ *
+ * ## Usage
+ *
+ * To use this module include it in your makefile:
+ *
+ * ```
+ * USEMODULE += mtd_cache
+ * ```
+ *
+ * The RAM for the cached sectors is provided by the application. To cache two
+ * sectors of `MTD_0`:
+ *
+ * ```
+ * static mtd_cache_slot_t slots[2];
+ * static uint8_t buf[2 * SECTOR_SIZE];
+ * static mtd_cache_t cache = MTD_CACHE_INIT(MTD_0, slots, buf);
+ *
+ * mtd_dev_t *dev = &cache.mtd;
+ * ```
+ *
+ * The cached device takes over the geometry of the backing device on
+ * @ref mtd_init. The backing device must not be accessed directly while it is
+ * cached.
+ *
+ * @{
+ *
+ * @file
+ * @brief       Interface definitions for the MTD write-back sector cache
+ */
+
+#ifndef MTD_CACHE_H
+#define MTD_CACHE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "container.h"
+#include "mtd.h"
+#include "mutex.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Shortcut macro for initializing an @ref mtd_cache_t struct
+ *
+ * @param   _parent     backing MTD device
+ * @param   _slots      array of @ref mtd_cache_slot_t, one per cached sector
+ * @param   _buf        buffer of at least one sector per element of @p _slots
+ */
+#define MTD_CACHE_INIT(_parent, _slots, _buf) \
+{ \
+    .mtd = { .driver = &mtd_cache_driver }, \
+    .parent = _parent, \
+    .slots = _slots, \
+    .slots_numof = ARRAY_SIZE(_slots), \
+    .buf = _buf, \
+    .buf_size = sizeof(_buf), \
+    .lock = MUTEX_INIT, \
+}
+
+/**
+ * @brief MTD cache statistics
+ */
+typedef struct {
+    uint32_t hits;          /**< accesses to a cached sector */
+    uint32_t misses;        /**< writes to a sector that was not cached */
+    uint32_t writebacks;    /**< sectors written back to the backing device */
+    uint32_t erases;        /**< sectors erased on the backing device */
+} mtd_cache_stats_t;
+
+/**
+ * @brief MTD cache slot holding a sector
+ */
+typedef struct {
+    uint32_t sector;        /**< cached sector */
+    uint32_t last_use;      /**< value of the use counter on last access */
+    bool valid;             /**< slot holds a sector */
+    bool dirty;             /**< sector was modified since it was cached */
+    bool erased;            /**< sector is erased on the backing device */
+} mtd_cache_slot_t;
+
+/**
+ * @brief MTD cache device
+ */
+typedef struct {
+    mtd_dev_t mtd;              /**< MTD context */
+    mtd_dev_t *parent;          /**< backing MTD device */
+    mtd_cache_slot_t *slots;    /**< slots for the cached sectors */
+    uint8_t *buf;               /**< data of the cached sectors */
+    size_t buf_size;            /**< size of @ref mtd_cache_t::buf */
+    unsigned slots_numof;       /**< number of elements of @ref mtd_cache_t::slots */
+    uint32_t uses;              /**< use counter to find the least recently
+                                     used slot */
+    mutex_t lock;               /**< guards the cache and the backing device */
+    mtd_cache_stats_t stats;    /**< cache statistics */
+} mtd_cache_t;
+
+/**
+ * @brief MTD cache device operations table
+ */
+extern const mtd_desc_t mtd_cache_driver;
+
+/**
+ * @brief   Write all modified sectors back to the backing device
+ *
+ * The sectors stay in the cache.
+ *
+ * @param[in] cache     the cache device
+ *
+ * @retval 0 on success
+ * @retval <0 error of the backing device
+ */
+int mtd_cache_flush(mtd_cache_t *cache);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MTD_CACHE_H */
+/** @} */
@@ -93,6 +93,15 @@ typedef struct {
     size_t size;        /**< total size of the MTD device in bytes */
     uint8_t *memory;    /**< RAM that is used for the emulated MTD device */
     bool init_done;     /**< indicates whether initialization is already done */
+#if defined(MODULE_MTD_ASYNC) || DOXYGEN
+    /**
+     * @brief   Emulated duration of writes and erases started by
+     *          @ref drivers_mtd_async in microseconds
+     */
+    uint32_t latency_us;
+    uint32_t busy_until;    /**< end of the ongoing emulated operation */
+    bool busy;              /**< an emulated operation is ongoing */
+#endif
 } mtd_emulated_t;
 
 /**
@@ -0,0 +1,261 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     drivers_mtd_async
+ * @{
+ *
+ * @file
+ * @brief       Asynchronous MTD request worker
+ *
+ * @}
+ */
+
+#include <assert.h>
+#include <errno.h>
+#include <stdint.h>
+
+#include "container.h"
+#include "irq.h"
+#include "mtd.h"
+#include "mtd_async.h"
+#include "ztimer.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+static void _timer_cb(void *arg)
+{
+    mtd_async_t *worker = arg;
+
+    event_post(worker->queue, &worker->event);
+}
+
+static mtd_async_req_t *_current(mtd_async_t *worker)
+{
+    unsigned state = irq_disable();
+    clist_node_t *node = clist_lpeek(&worker->pending);
+    irq_restore(state);
+
+    return node ? container_of(node, mtd_async_req_t, node) : NULL;
+}
+
+static void _complete(mtd_async_t *worker, mtd_async_req_t *req, int res)
+{
+    unsigned state = irq_disable();
+    clist_lpop(&worker->pending);
+    bool more = !clist_is_empty(&worker->pending);
+    irq_restore(state);
+
+    DEBUG("mtd_async: request %p done: %d\n", (void *)req, res);
+
+    /* don't starve other events on the queue by handling the next request
+     * right away */
+    if (more) {
+        event_post(worker->queue, &worker->event);
+    }
+    req->cb(req, res);
+}
+
+static bool _out_of_bounds(const mtd_dev_t *dev, const mtd_async_req_t *req)
+{
+    uint64_t end = (uint64_t)req->pos * dev->page_size + req->offset +
+                   req->remaining;
+
+    return end > (uint64_t)dev->sector_count * dev->pages_per_sector *
+                 dev->page_size;
+}
+
+/* the step functions return 0 once the request is done, the time to wait for
+ * the device in microseconds while it is busy or a negative errno */
+static int _step_read(mtd_dev_t *dev, mtd_async_req_t *req)
+{
+    /* reading doesn't keep the device busy */
+    int res = mtd_read_page(dev, req->buf, req->pos, req->offset,
+                            req->remaining);
+
+    req->remaining = 0;
+    return res;
+}
+
+static int _step_write(mtd_dev_t *dev, mtd_async_req_t *req)
+{
+    int res = -ENOTSUP;
+
+    if (dev->driver->write_page_start) {
+        if (_out_of_bounds(dev, req)) {
+            return -EOVERFLOW;
+        }
+        /* ensure offset is within a page */
+        req->pos += req->offset / dev->page_size;
+        req->offset %= dev->page_size;
+        res = dev->driver->write_page_start(dev, req->buf, req->pos,
+                                            req->offset, req->remaining);
+    }
+    if (res == -ENOTSUP) {
+        res = mtd_write_page_raw(dev, req->buf, req->pos, req->offset,
+                                 req->remaining);
+        req->remaining = 0;
+        return res;
+    }
+    if (res < 0) {
+        return res;
+    }
+
+    req->buf = (uint8_t *)req->buf + res;
+    req->offset += res;
+    req->remaining -= res;
+    return CONFIG_MTD_ASYNC_POLL_US;
+}
+
+static int _step_erase(mtd_dev_t *dev, mtd_async_req_t *req)
+{
+    int res = -ENOTSUP;
+
+    if (dev->driver->erase_sector_start) {
+        if ((req->pos >= dev->sector_count) ||
+            (req->remaining > dev->sector_count - req->pos)) {
+            return -EOVERFLOW;
+        }
+        res = dev->driver->erase_sector_start(dev, req->pos);
+    }
+    if (res == -ENOTSUP) {
+        res = mtd_erase_sector(dev, req->pos, req->remaining);
+        req->remaining = 0;
+        return res;
+    }
+    if (res < 0) {
+        return res;
+    }
+
+    req->pos++;
+    req->remaining--;
+    /* first check after the expected duration of the erase */
+    return res ? res : CONFIG_MTD_ASYNC_POLL_US;
+}
+
+static void _handler(event_t *event)
+{
+    mtd_async_t *worker = container_of(event, mtd_async_t, event);
+    mtd_dev_t *dev = worker->dev;
+    mtd_async_req_t *req = _current(worker);
+    int res;
+
+    if (req == NULL) {
+        return;
+    }
+
+    if (worker->busy) {
+        res = dev->driver->busy(dev);
+        if (res > 0) {
+            ztimer_set(ZTIMER_USEC, &worker->timer, CONFIG_MTD_ASYNC_POLL_US);
+            return;
+        }
+        worker->busy = false;
+        if (res < 0) {
+            _complete(worker, req, res);
+            return;
+        }
+    }
+
+    if (req->remaining == 0) {
+        _complete(worker, req, 0);
+        return;
+    }
+
+    switch (req->op) {
+    case MTD_ASYNC_OP_READ:
+        res = _step_read(dev, req);
+        break;
+    case MTD_ASYNC_OP_WRITE:
+        res = _step_write(dev, req);
+        break;
+    case MTD_ASYNC_OP_ERASE:
+        res = _step_erase(dev, req);
+        break;
+    default:
+        res = -EINVAL;
+    }
+
+    if (res > 0) {
+        assert(dev->driver->busy);
+        worker->busy = true;
+        ztimer_set(ZTIMER_USEC, &worker->timer, res);
+    }
+    else {
+        _complete(worker, req, res);
+    }
+}
+
+static void _submit(mtd_async_t *worker, mtd_async_req_t *req,
+                    mtd_async_op_t op, mtd_async_cb_t cb, void *arg)
+{
+    assert(cb);
+
+    req->op = op;
+    req->cb = cb;
+    req->arg = arg;
+
+    unsigned state = irq_disable();
+    bool idle = clist_is_empty(&worker->pending);
+    clist_rpush(&worker->pending, &req->node);
+    irq_restore(state);
+
+    if (idle) {
+        event_post(worker->queue, &worker->event);
+    }
+}
+
+void mtd_async_init(mtd_async_t *worker, mtd_dev_t *dev,
+                    event_queue_t *queue)
+{
+    assert(dev && dev->driver);
+    assert(!dev->driver->write_page_start || dev->driver->busy);
+    assert(!dev->driver->erase_sector_start || dev->driver->busy);
+
+    *worker = (mtd_async_t) {
+        .dev = dev,
+        .queue = queue,
+        .event.handler = _handler,
+        .timer = { .callback = _timer_cb, .arg = worker },
+    };
+}
+
+void mtd_async_read_page(mtd_async_t *worker, mtd_async_req_t *req,
+                         void *dest, uint32_t page, uint32_t offset,
+                         uint32_t size, mtd_async_cb_t cb, void *arg)
+{
+    req->buf = dest;
+    req->pos = page;
+    req->offset = offset;
+    req->remaining = size;
+    _submit(worker, req, MTD_ASYNC_OP_READ, cb, arg);
+}
+
+void mtd_async_write_page_raw(mtd_async_t *worker, mtd_async_req_t *req,
+                              const void *src, uint32_t page, uint32_t offset,
+                              uint32_t size, mtd_async_cb_t cb, void *arg)
+{
+    /* the buffer is only read */
+    req->buf = (void *)src;
+    req->pos = page;
+    req->offset = offset;
+    req->remaining = size;
+    _submit(worker, req, MTD_ASYNC_OP_WRITE, cb, arg);
+}
+
+void mtd_async_erase_sector(mtd_async_t *worker, mtd_async_req_t *req,
+                            uint32_t sector, uint32_t num,
+                            mtd_async_cb_t cb, void *arg)
+{
+    req->buf = NULL;
+    req->pos = sector;
+    req->offset = 0;
+    req->remaining = num;
+    _submit(worker, req, MTD_ASYNC_OP_ERASE, cb, arg);
+}
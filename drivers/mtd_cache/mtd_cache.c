@@ -0,0 +1,308 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     drivers_mtd_cache
+ * @{
+ *
+ * @file
+ * @brief       Write-back sector cache for MTD devices
+ *
+ * @}
+ */
+
+#include <assert.h>
+#include <errno.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "kernel_defines.h"
+#include "macros/utils.h"
+#include "mtd.h"
+#include "mtd_cache.h"
+#include "mutex.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+static uint32_t _sector_size(const mtd_cache_t *cache)
+{
+    return cache->mtd.pages_per_sector * cache->mtd.page_size;
+}
+
+static uint8_t *_slot_data(mtd_cache_t *cache, const mtd_cache_slot_t *slot)
+{
+    return cache->buf + (slot - cache->slots) * _sector_size(cache);
+}
+
+static mtd_cache_slot_t *_slot_find(mtd_cache_t *cache, uint32_t sector)
+{
+    for (unsigned i = 0; i < cache->slots_numof; i++) {
+        mtd_cache_slot_t *slot = &cache->slots[i];
+
+        if (slot->valid && (slot->sector == sector)) {
+            slot->last_use = ++cache->uses;
+            return slot;
+        }
+    }
+    return NULL;
+}
+
+static int _slot_flush(mtd_cache_t *cache, mtd_cache_slot_t *slot)
+{
+    mtd_dev_t *parent = cache->parent;
+    int res;
+
+    if (!slot->valid || !slot->dirty) {
+        return 0;
+    }
+
+    DEBUG("mtd_cache: writing back sector %" PRIu32 "\n", slot->sector);
+    if (!(parent->driver->flags & MTD_DRIVER_FLAG_DIRECT_WRITE) &&
+        !slot->erased) {
+        res = mtd_erase_sector(parent, slot->sector, 1);
+        if (res < 0) {
+            return res;
+        }
+        cache->stats.erases++;
+    }
+    /* the sector is not erased anymore once it was written */
+    slot->erased = false;
+    res = mtd_write_page_raw(parent, _slot_data(cache, slot),
+                             slot->sector * cache->mtd.pages_per_sector, 0,
+                             _sector_size(cache));
+    if (res < 0) {
+        return res;
+    }
+    cache->stats.writebacks++;
+    slot->dirty = false;
+    return 0;
+}
+
+static int _flush(mtd_cache_t *cache)
+{
+    for (unsigned i = 0; i < cache->slots_numof; i++) {
+        int res = _slot_flush(cache, &cache->slots[i]);
+
+        if (res < 0) {
+            return res;
+        }
+    }
+    return 0;
+}
+
+/* gets a slot for sector, reads the sector from the backing device if load is
+ * set, otherwise the caller overwrites the whole sector */
+static int _slot_get(mtd_cache_t *cache, uint32_t sector, bool load,
+                     mtd_cache_slot_t **res_slot)
+{
+    mtd_cache_slot_t *slot = _slot_find(cache, sector);
+    int res;
+
+    if (slot != NULL) {
+        cache->stats.hits++;
+        *res_slot = slot;
+        return 0;
+    }
+    cache->stats.misses++;
+
+    /* take an empty slot or evict the least recently used one */
+    slot = &cache->slots[0];
+    for (unsigned i = 0; i < cache->slots_numof; i++) {
+        mtd_cache_slot_t *cur = &cache->slots[i];
+
+        if (!cur->valid) {
+            slot = cur;
+            break;
+        }
+        if ((int32_t)(cur->last_use - slot->last_use) < 0) {
+            slot = cur;
+        }
+    }
+    res = _slot_flush(cache, slot);
+    if (res < 0) {
+        return res;
+    }
+
+    slot->valid = false;
+    if (load) {
+        res = mtd_read_page(cache->parent, _slot_data(cache, slot),
+                            sector * cache->mtd.pages_per_sector, 0,
+                            _sector_size(cache));
+        if (res < 0) {
+            return res;
+        }
+    }
+    slot->sector = sector;
+    slot->valid = true;
+    slot->dirty = false;
+    slot->erased = false;
+    slot->last_use = ++cache->uses;
+    *res_slot = slot;
+    return 0;
+}
+
+static int _init(mtd_dev_t *mtd)
+{
+    mtd_cache_t *cache = container_of(mtd, mtd_cache_t, mtd);
+    mtd_dev_t *parent = cache->parent;
+
+    int res = mtd_init(parent);
+    if (res < 0) {
+        return res;
+    }
+
+    /* inherit physical properties */
+    mtd->sector_count = parent->sector_count;
+    mtd->pages_per_sector = parent->pages_per_sector;
+    mtd->page_size = parent->page_size;
+    /* writes only go to RAM */
+    mtd->write_size = 1;
+
+    /* Configuration sanity check */
+    assert(cache->slots_numof > 0);
+    assert(cache->buf_size >= cache->slots_numof * _sector_size(cache));
+    if (cache->buf_size < cache->slots_numof * _sector_size(cache)) {
+        return -ENOMEM;
+    }
+
+    mutex_lock(&cache->lock);
+    memset(cache->slots, 0, cache->slots_numof * sizeof(*cache->slots));
+    memset(&cache->stats, 0, sizeof(cache->stats));
+    cache->uses = 0;
+    mutex_unlock(&cache->lock);
+    return 0;
+}
+
+static int _read_page(mtd_dev_t *mtd, void *dest, uint32_t page,
+                      uint32_t offset, uint32_t count)
+{
+    mtd_cache_t *cache = container_of(mtd, mtd_cache_t, mtd);
+    uint32_t sector = page / mtd->pages_per_sector;
+    uint32_t sector_offset = (page % mtd->pages_per_sector) * mtd->page_size +
+                             offset;
+    mtd_cache_slot_t *slot;
+    int res = 0;
+
+    /* read up to the end of the sector */
+    count = MIN(count, _sector_size(cache) - sector_offset);
+
+    mutex_lock(&cache->lock);
+    slot = _slot_find(cache, sector);
+    if (slot != NULL) {
+        cache->stats.hits++;
+        memcpy(dest, _slot_data(cache, slot) + sector_offset, count);
+    }
+    else {
+        res = mtd_read_page(cache->parent, dest, page, offset, count);
+    }
+    mutex_unlock(&cache->lock);
+
+    if (res < 0) {
+        return res;
+    }
+
+    /* mtd_read_page() returns 0 on success
+     * but we are expected to return the read byte count */
+    return count;
+}
+
+static int _write_page(mtd_dev_t *mtd, const void *src, uint32_t page,
+                       uint32_t offset, uint32_t count)
+{
+    mtd_cache_t *cache = container_of(mtd, mtd_cache_t, mtd);
+    uint32_t sector = page / mtd->pages_per_sector;
+    uint32_t sector_offset = (page % mtd->pages_per_sector) * mtd->page_size +
+                             offset;
+    mtd_cache_slot_t *slot;
+    int res;
+
+    /* write up to the end of the sector */
+    count = MIN(count, _sector_size(cache) - sector_offset);
+
+    mutex_lock(&cache->lock);
+    /* no need to read a sector that is overwritten completely */
+    res = _slot_get(cache, sector, count < _sector_size(cache), &slot);
+    if (res == 0) {
+        memcpy(_slot_data(cache, slot) + sector_offset, src, count);
+        slot->dirty = true;
+    }
+    mutex_unlock(&cache->lock);
+
+    if (res < 0) {
+        return res;
+    }
+    return count;
+}
+
+static int _erase_sector(mtd_dev_t *mtd, uint32_t sector, uint32_t count)
+{
+    mtd_cache_t *cache = container_of(mtd, mtd_cache_t, mtd);
+    int res;
+
+    mutex_lock(&cache->lock);
+    res = mtd_erase_sector(cache->parent, sector, count);
+    if (res < 0) {
+        mutex_unlock(&cache->lock);
+        return res;
+    }
+    cache->stats.erases += count;
+    for (unsigned i = 0; i < cache->slots_numof; i++) {
+        mtd_cache_slot_t *slot = &cache->slots[i];
+
+        if (!slot->valid || (slot->sector < sector) ||
+            (slot->sector >= sector + count)) {
+            continue;
+        }
+        /* modifications of an erased sector are gone, keep the erased
+         * content cached as it is likely to be written next */
+        slot->dirty = false;
+        slot->valid = false;
+        if (mtd_read_page(cache->parent, _slot_data(cache, slot),
+                          slot->sector * mtd->pages_per_sector, 0,
+                          _sector_size(cache)) == 0) {
+            slot->valid = true;
+            slot->erased = true;
+        }
+    }
+    mutex_unlock(&cache->lock);
+    return 0;
+}
+
+static int _power(mtd_dev_t *mtd, enum mtd_power_state power)
+{
+    mtd_cache_t *cache = container_of(mtd, mtd_cache_t, mtd);
+    int res = 0;
+
+    mutex_lock(&cache->lock);
+    if (power == MTD_POWER_DOWN) {
+        res = _flush(cache);
+    }
+    if (res == 0) {
+        res = mtd_power(cache->parent, power);
+    }
+    mutex_unlock(&cache->lock);
+    return res;
+}
+
+int mtd_cache_flush(mtd_cache_t *cache)
+{
+    mutex_lock(&cache->lock);
+    int res = _flush(cache);
+    mutex_unlock(&cache->lock);
+    return res;
+}
+
+const mtd_desc_t mtd_cache_driver = {
+    .init = _init,
+    .read_page = _read_page,
+    .write_page = _write_page,
+    .erase_sector = _erase_sector,
+    .power = _power,
+    .flags = MTD_DRIVER_FLAG_DIRECT_WRITE,
+};
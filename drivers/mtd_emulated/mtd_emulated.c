@@ -10,9 +10,14 @@
 #include <string.h>
 
 #include "assert.h"
+#include "kernel_defines.h"
 #include "macros/utils.h"
 #include "mtd_emulated.h"
 
+#if IS_USED(MODULE_MTD_ASYNC)
+#include "ztimer.h"
+#endif
+
 static int _init(mtd_dev_t *dev)
 {
     mtd_emulated_t *mtd = (mtd_emulated_t *)dev;
@@ -198,6 +203,54 @@ static int _erase_sector(mtd_dev_t *dev, uint32_t sector, uint32_t num)
     return 0;
 }
 
+#if IS_USED(MODULE_MTD_ASYNC)
+static void _busy_start(mtd_emulated_t *mtd)
+{
+    mtd->busy_until = ztimer_now(ZTIMER_USEC) + mtd->latency_us;
+    mtd->busy = true;
+}
+
+static int _write_page_start(mtd_dev_t *dev, const void *src,
+                             uint32_t page, uint32_t offset, uint32_t size)
+{
+    mtd_emulated_t *mtd = (mtd_emulated_t *)dev;
+
+    /* a page program doesn't cross the page boundary */
+    int res = _write_page(dev, src, page, offset,
+                          MIN(size, dev->page_size - offset));
+
+    if (res >= 0) {
+        _busy_start(mtd);
+    }
+    return res;
+}
+
+static int _erase_sector_start(mtd_dev_t *dev, uint32_t sector)
+{
+    mtd_emulated_t *mtd = (mtd_emulated_t *)dev;
+
+    int res = _erase_sector(dev, sector, 1);
+
+    if (res < 0) {
+        return res;
+    }
+    _busy_start(mtd);
+    return mtd->latency_us;
+}
+
+static int _busy(mtd_dev_t *dev)
+{
+    mtd_emulated_t *mtd = (mtd_emulated_t *)dev;
+
+    if (mtd->busy &&
+        ((int32_t)(ztimer_now(ZTIMER_USEC) - mtd->busy_until) < 0)) {
+        return 1;
+    }
+    mtd->busy = false;
+    return 0;
+}
+#endif
+
 static int _power(mtd_dev_t *dev, enum mtd_power_state power)
 {
     (void)dev;
@@ -213,4 +266,9 @@ const mtd_desc_t _mtd_emulated_driver = {
     .erase = _erase,
     .erase_sector = _erase_sector,
     .power = _power,
+#if IS_USED(MODULE_MTD_ASYNC)
+    .write_page_start = _write_page_start,
+    .erase_sector_start = _erase_sector_start,
+    .busy = _busy,
+#endif
 };
@@ -604,27 +604,37 @@ static int mtd_spi_nor_read(mtd_dev_t *mtd, void *dest, uint32_t addr, uint32_t
     return 0;
 }
 
-static int mtd_spi_nor_write_page(mtd_dev_t *mtd, const void *src, uint32_t page, uint32_t offset,
-                                  uint32_t size)
+static uint32_t _page_program(mtd_dev_t *mtd, const void *src, uint32_t page,
+                              uint32_t offset, uint32_t size)
 {
     const mtd_spi_nor_t *dev = (mtd_spi_nor_t *)mtd;
 
-    DEBUG("mtd_spi_nor_write_page: %p, %p, 0x%" PRIx32 ", 0x%" PRIx32 ", 0x%" PRIx32 "\n",
-          (void *)mtd, src, page, offset, size);
-
     uint32_t remaining = mtd->page_size - offset;
     size = MIN(remaining, size);
 
     uint32_t addr = page * mtd->page_size + offset;
 
-    mtd_spi_acquire(dev);
-
     /* write enable */
     mtd_spi_cmd(dev, dev->params->opcode->wren);
 
     /* Page program */
     mtd_spi_cmd_addr_write(dev, dev->params->opcode->page_program, addr, src, size);
 
+    return size;
+}
+
+static int mtd_spi_nor_write_page(mtd_dev_t *mtd, const void *src, uint32_t page, uint32_t offset,
+                                  uint32_t size)
+{
+    const mtd_spi_nor_t *dev = (mtd_spi_nor_t *)mtd;
+
+    DEBUG("mtd_spi_nor_write_page: %p, %p, 0x%" PRIx32 ", 0x%" PRIx32 ", 0x%" PRIx32 "\n",
+          (void *)mtd, src, page, offset, size);
+
+    mtd_spi_acquire(dev);
+
+    size = _page_program(mtd, src, page, offset, size);
+
     /* waiting for the command to complete before returning */
     wait_for_write_complete(dev, 0);
 
@@ -709,10 +719,79 @@ static int mtd_spi_nor_erase(mtd_dev_t *mtd, uint32_t addr, uint32_t size)
     return 0;
 }
 
+#if IS_USED(MODULE_MTD_ASYNC)
+static int mtd_spi_nor_write_page_start(mtd_dev_t *mtd, const void *src, uint32_t page,
+                                        uint32_t offset, uint32_t size)
+{
+    const mtd_spi_nor_t *dev = (mtd_spi_nor_t *)mtd;
+
+    mtd_spi_acquire(dev);
+    size = _page_program(mtd, src, page, offset, size);
+    mtd_spi_release(dev);
+
+    return size;
+}
+
+static int mtd_spi_nor_erase_sector_start(mtd_dev_t *mtd, uint32_t sector)
+{
+    const mtd_spi_nor_t *dev = (mtd_spi_nor_t *)mtd;
+    uint32_t sector_size = mtd->page_size * mtd->pages_per_sector;
+    uint32_t addr = sector * sector_size;
+    uint8_t opcode;
+    uint32_t us;
+
+    if (sector >= mtd->sector_count) {
+        return -EOVERFLOW;
+    }
+
+    /* sector erase of the size the device was configured with */
+    if ((dev->params->flag & SPI_NOR_F_SECT_4K) && (sector_size == MTD_4K)) {
+        opcode = dev->params->opcode->sector_erase;
+        us = dev->params->wait_sector_erase;
+    }
+    else if ((dev->params->flag & SPI_NOR_F_SECT_32K) && (sector_size == MTD_32K)) {
+        opcode = dev->params->opcode->block_erase_32k;
+        us = dev->params->wait_32k_erase;
+    }
+    else if ((dev->params->flag & SPI_NOR_F_SECT_64K) && (sector_size == MTD_64K)) {
+        opcode = dev->params->opcode->block_erase_64k;
+        us = dev->params->wait_64k_erase;
+    }
+    else {
+        return -ENOTSUP;
+    }
+
+    mtd_spi_acquire(dev);
+    mtd_spi_cmd(dev, dev->params->opcode->wren);
+    mtd_spi_cmd_addr_write(dev, opcode, addr, NULL, 0);
+    mtd_spi_release(dev);
+
+    return us;
+}
+
+static int mtd_spi_nor_busy(mtd_dev_t *mtd)
+{
+    const mtd_spi_nor_t *dev = (mtd_spi_nor_t *)mtd;
+    uint8_t status;
+
+    mtd_spi_acquire(dev);
+    mtd_spi_cmd_read(dev, dev->params->opcode->rdsr, &status, sizeof(status));
+    mtd_spi_release(dev);
+
+    /* write in progress */
+    return status & 1;
+}
+#endif
+
 const mtd_desc_t mtd_spi_nor_driver = {
     .init = mtd_spi_nor_init,
     .read = mtd_spi_nor_read,
     .write_page = mtd_spi_nor_write_page,
     .erase = mtd_spi_nor_erase,
     .power = mtd_spi_nor_power,
+#if IS_USED(MODULE_MTD_ASYNC)
+    .write_page_start = mtd_spi_nor_write_page_start,
+    .erase_sector_start = mtd_spi_nor_erase_sector_start,
+    .busy = mtd_spi_nor_busy,
+#endif
 };
@@ -255,6 +255,11 @@ PSEUDOMODULES += gnrc_sock_check_reuse
 PSEUDOMODULES += gnrc_txtsnd
 PSEUDOMODULES += ieee802154_security
 PSEUDOMODULES += ieee802154_submac
+## @addtogroup net_inet_csum
+## @{
+## Sum word-at-a-time (and with SSE2 where available) instead of byte-wise
+PSEUDOMODULES += inet_csum_fast
+## @}
 PSEUDOMODULES += ipv4
 PSEUDOMODULES += ipv6
 PSEUDOMODULES += l2filter_blacklist
@@ -309,6 +314,7 @@ PSEUDOMODULES += pmp_noexec_ram
 PSEUDOMODULES += mtd_write_page
 PSEUDOMODULES += nanocoap_%
 PSEUDOMODULES += nanocoap_fileserver_callback
+PSEUDOMODULES += nanocoap_fileserver_cache
 PSEUDOMODULES += nanocoap_fileserver_delete
 PSEUDOMODULES += nanocoap_fileserver_put
 PSEUDOMODULES += netdev_default
@@ -329,6 +335,7 @@ PSEUDOMODULES += netstats_neighbor_lqi
 PSEUDOMODULES += netstats_neighbor_tx_time
 PSEUDOMODULES += netstats_ipv6
 PSEUDOMODULES += netstats_rpl
+PSEUDOMODULES += netstats_tcp
 PSEUDOMODULES += nimble
 PSEUDOMODULES += nimble_adv_ext
 PSEUDOMODULES += nimble_autoconn_%
@@ -378,6 +385,7 @@ PSEUDOMODULES += saul_pwm
 PSEUDOMODULES += scanf_float
 PSEUDOMODULES += sched_cb
 PSEUDOMODULES += sched_runq_callback
+PSEUDOMODULES += sched_wakeup_callback
 ## @defgroup pseudomodule_sema_deprecated sema_deprecated
 ## @ingroup sys_sema
 ## @{
@@ -437,6 +445,7 @@ PSEUDOMODULES += shell_cmd_mci
 PSEUDOMODULES += shell_cmd_md5sum
 PSEUDOMODULES += shell_cmd_nanocoap_vfs
 PSEUDOMODULES += shell_cmd_netstats_neighbor
+PSEUDOMODULES += shell_cmd_netstats_tcp
 PSEUDOMODULES += shell_cmd_nice
 PSEUDOMODULES += shell_cmd_nimble_netif
 PSEUDOMODULES += shell_cmd_nimble_statconn
@@ -448,6 +457,7 @@ PSEUDOMODULES += shell_cmd_random
 PSEUDOMODULES += shell_cmd_rtc
 PSEUDOMODULES += shell_cmd_rtt
 PSEUDOMODULES += shell_cmd_saul_reg
+PSEUDOMODULES += shell_cmd_schedprofile
 PSEUDOMODULES += shell_cmd_semtech-loramac
 PSEUDOMODULES += shell_cmd_sha1sum
 PSEUDOMODULES += shell_cmd_sha256sum
@@ -523,6 +533,20 @@ PSEUDOMODULES += vfs_auto_format
 ## some boards if the @ref pseudomodule_vfs_default module is active.
 PSEUDOMODULES += vfs_auto_mount
 
+## @defgroup pseudomodule_vfs_buffered vfs_buffered
+## @brief Buffer reads and writes of files opened with vfs_open
+##
+## When this module is active, regular files opened with @ref vfs_open get a
+## buffer of @ref CONFIG_VFS_BUFFERED_SIZE bytes from a pool of
+## @ref CONFIG_VFS_BUFFERED_NUMOF buffers. Devices and files whose driver does
+## not report `S_IFREG` via `fstat()` stay unbuffered. Small sequential reads are served
+## from a read-ahead and small writes are coalesced until the buffer is full,
+## the file is seeked, synced or closed.
+##
+## Data written to a buffered file only reaches the file system with
+## @ref vfs_fsync or @ref vfs_close, or once the buffer is full.
+PSEUDOMODULES += vfs_buffered
+
 ## @defgroup pseudomodule_vfs_default vfs_default
 ## @brief Enable default assignments of a board's devices to VFS mount points
 ##
@@ -560,6 +584,14 @@ PSEUDOMODULES += ztimer64_%
 ## configuration header board.h. These can be found out by running tests/sys/ztimer_overhead
 PSEUDOMODULES += ztimer_auto_adjust
 
+## @defgroup pseudomodule_ztimer_wheel ztimer_wheel
+## @brief Constant time ztimer_set() / ztimer_remove() for far timers
+##
+## Adds a hierarchical timer wheel in front of the timer list of ZTIMER_MSEC.
+## Other clocks can use one by calling @ref ztimer_wheel_init.
+## This costs an additional pointer per timer object.
+PSEUDOMODULES += ztimer_wheel
+
 # core_lib is not a submodule
 NO_PSEUDOMODULES += core_lib
 
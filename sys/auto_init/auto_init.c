@@ -65,6 +65,11 @@ extern void init_schedstatistics(void);
 AUTO_INIT(init_schedstatistics,
           AUTO_INIT_PRIO_MOD_SCHEDSTATISTICS);
 #endif
+#if IS_USED(MODULE_SCHEDPROFILE)
+extern void init_schedprofile(void);
+AUTO_INIT(init_schedprofile,
+          AUTO_INIT_PRIO_MOD_SCHEDPROFILE);
+#endif
 #if IS_USED(MODULE_SCHED_ROUND_ROBIN)
 extern void sched_round_robin_init(void);
 AUTO_INIT(sched_round_robin_init,
@@ -59,6 +59,13 @@ extern "C" {
  */
 #define AUTO_INIT_PRIO_MOD_SCHEDSTATISTICS              1050
 #endif
+#ifndef AUTO_INIT_PRIO_MOD_SCHEDPROFILE
+/**
+ * @brief   scheduler profiler priority, after schedstatistics as it takes over
+ *          the scheduler callback
+ */
+#define AUTO_INIT_PRIO_MOD_SCHEDPROFILE                 1055
+#endif
 #ifndef AUTO_INIT_PRIO_MOD_SCHED_ROUND_ROBIN
 /**
  * @brief   round robin scheduling priority
@@ -77,7 +77,8 @@ static const cipher_interface_t aes_interface = {
     AES_BLOCK_SIZE,
     aes_init,
     aes_encrypt,
-    aes_decrypt
+    aes_decrypt,
+    aes_encrypt_blocks,
 };
 
 const cipher_id_t CIPHER_AES = &aes_interface;
@@ -1062,23 +1063,12 @@ static int aes_set_decrypt_key(const unsigned char *userKey, const int bits,
 
 #ifndef AES_ASM
 /*
- * Encrypt a single block
+ * Encrypt a single block with an expanded key
  * in and out can overlap
  */
-int aes_encrypt(const cipher_context_t *context, const uint8_t *plainBlock,
-                uint8_t *cipherBlock)
+static void _encrypt_block(const aes_key_t *key, const uint8_t *plainBlock,
+                           uint8_t *cipherBlock)
 {
-    /* setup AES_KEY */
-    int res;
-    aes_key_t aeskey;
-    const aes_key_t *key = &aeskey;
-
-    res = aes_set_encrypt_key((unsigned char *)context->context,
-                              AES_KEY_SIZE(context) * 8, &aeskey);
-    if (res < 0) {
-        return res;
-    }
-
     const u32 *rk;
     u32 s0, s1, s2, s3, t0, t1, t2, t3;
 
@@ -1327,6 +1317,40 @@ int aes_encrypt(const cipher_context_t *context, const uint8_t *plainBlock,
         (Te4((t2) & 0xff)       & 0x000000ff) ^
         rk[3];
     PUTU32(cipherBlock + 12, s3);
+}
+
+/*
+ * Encrypt a single block
+ * in and out can overlap
+ */
+int aes_encrypt(const cipher_context_t *context, const uint8_t *plainBlock,
+                uint8_t *cipherBlock)
+{
+    return aes_encrypt_blocks(context, plainBlock, cipherBlock, 1);
+}
+
+/*
+ * Encrypt consecutive blocks, expanding the key only once
+ * in and out can overlap
+ */
+int aes_encrypt_blocks(const cipher_context_t *context, const uint8_t *plain,
+                       uint8_t *cipher, size_t nblocks)
+{
+    /* setup AES_KEY */
+    int res;
+    aes_key_t aeskey;
+
+    res = aes_set_encrypt_key((unsigned char *)context->context,
+                              AES_KEY_SIZE(context) * 8, &aeskey);
+    if (res < 0) {
+        return res;
+    }
+
+    while (nblocks--) {
+        _encrypt_block(&aeskey, plain, cipher);
+        plain += AES_BLOCK_SIZE;
+        cipher += AES_BLOCK_SIZE;
+    }
     return 1;
 }
 
@@ -1592,4 +1616,24 @@ int aes_decrypt(const cipher_context_t *context, const uint8_t *cipherBlock,
     return 1;
 }
 
+#else /* AES_ASM */
+
+/*
+ * Encrypt consecutive blocks with the assembler aes_encrypt()
+ * in and out can overlap
+ */
+int aes_encrypt_blocks(const cipher_context_t *context, const uint8_t *plain,
+                       uint8_t *cipher, size_t nblocks)
+{
+    while (nblocks--) {
+        int res = aes_encrypt(context, plain, cipher);
+        if (res < 0) {
+            return res;
+        }
+        plain += AES_BLOCK_SIZE;
+        cipher += AES_BLOCK_SIZE;
+    }
+    return 1;
+}
+
 #endif /* AES_ASM */
@@ -43,71 +43,147 @@ static const uint32_t constant[] = {0x61707865,
 /* Padding to add to the poly1305 authentication tag */
 static const uint8_t padding[15] = {0};
 
-/* Single round */
-static void _r(uint32_t *a, uint32_t *b, uint32_t *d, unsigned c)
-{
-    *a += *b;
-    uint32_t tmp = *a ^ *d;
-    *d = (tmp << c) | (tmp >> (32 - c));
-}
+#define CHACHA20_BLOCK_SIZE     64U
+
+/* Keystream blocks computed at once, vector extensions of the compiler are
+ * only used where the target has 128 bit vector registers */
+#if defined(__SSE2__) || defined(__ARM_NEON)
+#define CHACHA20_LANES          4U
+typedef uint32_t chacha20_vec_t __attribute__((vector_size(16)));
+#else
+#define CHACHA20_LANES          1U
+#endif
 
-static void _add_initial(chacha20poly1305_ctx_t *ctx, const uint8_t *key,
-                         const uint8_t *nonce, uint32_t blk)
+/* Works for both scalars and vectors */
+#define ROTL(x, n)      (((x) << (n)) | ((x) >> (32 - (n))))
+
+#define QUARTERROUND(a, b, c, d) \
+    do { \
+        a += b; d ^= a; d = ROTL(d, 16); \
+        c += d; b ^= c; b = ROTL(b, 12); \
+        a += b; d ^= a; d = ROTL(d, 8); \
+        c += d; b ^= c; b = ROTL(b, 7); \
+    } while (0)
+
+#define DOUBLEROUND(x) \
+    do { \
+        QUARTERROUND(x[0], x[4], x[8],  x[12]); \
+        QUARTERROUND(x[1], x[5], x[9],  x[13]); \
+        QUARTERROUND(x[2], x[6], x[10], x[14]); \
+        QUARTERROUND(x[3], x[7], x[11], x[15]); \
+        QUARTERROUND(x[0], x[5], x[10], x[15]); \
+        QUARTERROUND(x[1], x[6], x[11], x[12]); \
+        QUARTERROUND(x[2], x[7], x[8],  x[13]); \
+        QUARTERROUND(x[3], x[4], x[9],  x[14]); \
+    } while (0)
+
+static void _init_state(uint32_t *state, const uint8_t *key,
+                        const uint8_t *nonce)
 {
     for (unsigned i = 0; i < 4; i++) {
-        ctx->state[i] += constant[i];
+        state[i] = constant[i];
     }
     for (unsigned i = 0; i < 8; i++) {
-        ctx->state[i+4] += unaligned_get_u32(key + 4*i);
+        state[i+4] = unaligned_get_u32(key + 4*i);
     }
-    ctx->state[12] += unaligned_get_u32((uint8_t*)&blk);
-    ctx->state[13] += unaligned_get_u32(nonce);
-    ctx->state[14] += unaligned_get_u32(nonce+4);
-    ctx->state[15] += unaligned_get_u32(nonce+8);
+    state[12] = 0;
+    state[13] = unaligned_get_u32(nonce);
+    state[14] = unaligned_get_u32(nonce+4);
+    state[15] = unaligned_get_u32(nonce+8);
 }
 
-static void _keystream(chacha20poly1305_ctx_t *ctx, const uint8_t *key,
-                       const uint8_t *nonce, uint32_t blk)
+/* Single keystream block for the block counter in state[12] */
+static void _keystream(uint32_t *out, const uint32_t *state)
 {
-    /* Initialize block state */
-    memset(ctx->state, 0, sizeof(ctx->state));
-    _add_initial(ctx, key, nonce, blk);
-
-    /* perform rounds */
-    for (unsigned i = 0; i < 80; ++i) {
-        uint32_t *a = &ctx->state[((i                    ) & 3)          ];
-        uint32_t *b = &ctx->state[((i + ((i & 4) ? 1 : 0)) & 3) + (4 * 1)];
-        uint32_t *c = &ctx->state[((i + ((i & 4) ? 2 : 0)) & 3) + (4 * 2)];
-        uint32_t *d = &ctx->state[((i + ((i & 4) ? 3 : 0)) & 3) + (4 * 3)];
-        _r(a, b, d, 16);
-        _r(c, d, b, 12);
-        _r(a, b, d, 8);
-        _r(c, d, b, 7);
+    uint32_t x[16];
+
+    memcpy(x, state, sizeof(x));
+    for (unsigned i = 0; i < 10; i++) {
+        DOUBLEROUND(x);
     }
-    /* add initial state */
-    _add_initial(ctx, key, nonce, blk);
+    for (unsigned i = 0; i < 16; i++) {
+        out[i] = x[i] + state[i];
+    }
+    crypto_secure_wipe(x, sizeof(x));
 }
 
-static void _xcrypt(chacha20poly1305_ctx_t *ctx, const uint8_t *key,
-                    const uint8_t *nonce, const uint8_t *in, uint8_t *out, size_t len)
+#if CHACHA20_LANES > 1
+/* CHACHA20_LANES consecutive keystream blocks starting at the block counter in
+ * state[12], each lane of the vectors holds the state of one block */
+static void _keystream_lanes(uint32_t *out, const uint32_t *state)
 {
-    /* Number of full 64 byte blocks */
-    const size_t num_blocks = len >> 6;
-    size_t pos = 0;
-    /* xcrypt full blocks */
-    for (size_t i = 0; i < num_blocks; i++, pos += 64) {
-        _keystream(ctx, key, nonce, i+1);
-        for (size_t j = 0; j < 64; j++) {
-            out[pos+j] = in[pos+j] ^ ((uint8_t*)ctx->state)[j];
+    chacha20_vec_t init[16];
+    chacha20_vec_t x[16];
+
+    for (unsigned i = 0; i < 16; i++) {
+        init[i] = (chacha20_vec_t){ state[i], state[i], state[i], state[i] };
+    }
+    init[12] += (chacha20_vec_t){ 0, 1, 2, 3 };
+
+    memcpy(x, init, sizeof(x));
+    for (unsigned i = 0; i < 10; i++) {
+        DOUBLEROUND(x);
+    }
+    for (unsigned i = 0; i < 16; i++) {
+        x[i] += init[i];
+    }
+
+    /* transpose into consecutive blocks */
+    for (unsigned lane = 0; lane < CHACHA20_LANES; lane++) {
+        for (unsigned i = 0; i < 16; i++) {
+            out[16 * lane + i] = x[i][lane];
         }
     }
-    /* xcrypt remaining bytes */
-    if (len - pos) {
-        _keystream(ctx, key, nonce, num_blocks+1);
-        for (size_t j = 0; j < len - pos; j++) {
-            out[pos+j] = in[pos+j] ^ ((uint8_t*)ctx->state)[j];
+    crypto_secure_wipe(init, sizeof(init));
+    crypto_secure_wipe(x, sizeof(x));
+}
+#endif
+
+static void _xcrypt(const uint8_t *key, const uint8_t *nonce,
+                    const uint8_t *in, uint8_t *out, size_t len)
+{
+    uint32_t state[16];
+    uint32_t stream[16 * CHACHA20_LANES];
+
+    _init_state(state, key, nonce);
+    /* block 0 is used for the poly1305 key */
+    state[12] = 1;
+
+    while (len) {
+        size_t chunk;
+#if CHACHA20_LANES > 1
+        if (len > CHACHA20_BLOCK_SIZE) {
+            _keystream_lanes(stream, state);
+            state[12] += CHACHA20_LANES;
+            chunk = CHACHA20_LANES * CHACHA20_BLOCK_SIZE;
+        }
+        else
+#endif
+        {
+            _keystream(stream, state);
+            state[12]++;
+            chunk = CHACHA20_BLOCK_SIZE;
         }
+        if (chunk > len) {
+            chunk = len;
+        }
+
+        size_t pos = 0;
+        /* xcrypt full words */
+        for (; pos + 4 <= chunk; pos += 4) {
+            uint32_t word = unaligned_get_u32(in + pos) ^ stream[pos / 4];
+            memcpy(out + pos, &word, sizeof(word));
+        }
+        /* xcrypt remaining bytes */
+        for (; pos < chunk; pos++) {
+            out[pos] = in[pos] ^ ((uint8_t*)stream)[pos];
+        }
+        in += chunk;
+        out += chunk;
+        len -= chunk;
     }
+    crypto_secure_wipe(state, sizeof(state));
+    crypto_secure_wipe(stream, sizeof(stream));
 }
 
 static void _poly1305_padded(poly1305_ctx_t *pctx, const uint8_t *data, size_t len)
@@ -124,7 +200,8 @@ static void _poly1305_gentag(uint8_t *mac, const uint8_t *key, const uint8_t *no
 {
     chacha20poly1305_ctx_t ctx;
     /* generate one time key */
-    _keystream(&ctx, key, nonce, 0);
+    _init_state(ctx.state, key, nonce);
+    _keystream(ctx.state, ctx.state);
     poly1305_init(&ctx.poly, (uint8_t*)ctx.state);
     /* Add aad */
     _poly1305_padded(&ctx.poly, aad, aadlen);
@@ -141,13 +218,10 @@ void chacha20poly1305_encrypt(uint8_t *cipher, const uint8_t *msg,
                               size_t msglen, const uint8_t *aad, size_t aadlen,
                               const uint8_t *key, const uint8_t *nonce)
 {
-    chacha20poly1305_ctx_t ctx;
-    _xcrypt(&ctx, key, nonce, msg, cipher, msglen);
-    crypto_secure_wipe(&ctx, sizeof(ctx));
+    _xcrypt(key, nonce, msg, cipher, msglen);
     /* Generate tag */
     _poly1305_gentag(&cipher[msglen], key, nonce,
                     cipher, msglen, aad, aadlen);
-    /* Wipe structures */
 }
 
 int chacha20poly1305_decrypt(const uint8_t *cipher, size_t cipherlen,
@@ -162,8 +236,6 @@ int chacha20poly1305_decrypt(const uint8_t *cipher, size_t cipherlen,
     if (crypto_equals(cipher+*msglen, mac, CHACHA20POLY1305_TAG_BYTES) == 0) {
         return 0;
     }
-    chacha20poly1305_ctx_t ctx;
-    /* Number of full blocks */
-    _xcrypt(&ctx, key, nonce, cipher, msg, *msglen);
+    _xcrypt(key, nonce, cipher, msg, *msglen);
     return 1;
 }
@@ -70,9 +70,9 @@ static int ccm_compute_cbc_mac(const cipher_t *cipher, const uint8_t iv[16],
     return offset;
 }
 
-static int ccm_create_mac_iv(const cipher_t *cipher, uint8_t auth_data_len, uint8_t M,
-                             uint8_t L, const uint8_t *nonce, uint8_t nonce_len,
-                             size_t plaintext_len, uint8_t X1[16])
+static int ccm_create_b0(uint8_t auth_data_len, uint8_t M,
+                         uint8_t L, const uint8_t *nonce, uint8_t nonce_len,
+                         size_t plaintext_len, uint8_t X1[16])
 {
     uint8_t M_, L_;
 
@@ -100,9 +100,30 @@ static int ccm_create_mac_iv(const cipher_t *cipher, uint8_t auth_data_len, uint
         return CIPHER_ERR_INVALID_LENGTH;
     }
 
-    if (cipher_encrypt(cipher, X1, X1) != 1) {
+    return 0;
+}
+
+/* Encrypts B0 to X1, the IV of the MAC, and A0 to the first stream block.
+ * Both are independent, so they are encrypted together. */
+static int ccm_create_mac_iv_s0(const cipher_t *cipher, uint8_t auth_data_len,
+                                uint8_t M, uint8_t L, const uint8_t *nonce,
+                                uint8_t nonce_len, size_t plaintext_len,
+                                const uint8_t nonce_counter[16],
+                                uint8_t X1[16], uint8_t S0[16])
+{
+    uint8_t blocks[2 * CCM_BLOCK_SIZE];
+
+    if (ccm_create_b0(auth_data_len, M, L, nonce, nonce_len, plaintext_len,
+                      blocks) < 0) {
+        return CIPHER_ERR_INVALID_LENGTH;
+    }
+    memcpy(&blocks[CCM_BLOCK_SIZE], nonce_counter, CCM_BLOCK_SIZE);
+
+    if (cipher_encrypt_blocks(cipher, blocks, blocks, 2) != 1) {
         return CIPHER_ERR_ENC_FAILED;
     }
+    memcpy(X1, blocks, CCM_BLOCK_SIZE);
+    memcpy(S0, &blocks[CCM_BLOCK_SIZE], CCM_BLOCK_SIZE);
     return 0;
 }
 
@@ -181,7 +202,7 @@ int cipher_encrypt_ccm(const cipher_t *cipher,
 {
     int len = -1;
     uint8_t nonce_counter[16] = { 0 }, mac_iv[16] = { 0 }, mac[16] = { 0 },
-            stream_block[16] = { 0 }, zero_block[16] = { 0 }, block_size;
+            stream_block[16] = { 0 }, block_size;
 
     if (mac_length % 2 != 0  || mac_length < 4 || mac_length > 16) {
         return CCM_ERR_INVALID_MAC_LENGTH;
@@ -192,11 +213,18 @@ int cipher_encrypt_ccm(const cipher_t *cipher,
         return CCM_ERR_INVALID_LENGTH_ENCODING;
     }
 
-    /* Create B0, encrypt it (X1) and use it as mac_iv */
     block_size = cipher_get_block_size(cipher);
     assert(block_size == CCM_BLOCK_SIZE);
-    if (ccm_create_mac_iv(cipher, auth_data_len, mac_length, length_encoding,
-                          nonce, nonce_len, input_len, mac_iv) < 0) {
+
+    /* Create B0 and encrypt it (X1) to use it as mac_iv, compute first
+     * stream block */
+    nonce_counter[0] = length_encoding - 1;
+    memcpy(&nonce_counter[1], nonce,
+           min(nonce_len, (size_t)15 - length_encoding));
+    len = ccm_create_mac_iv_s0(cipher, auth_data_len, mac_length,
+                               length_encoding, nonce, nonce_len, input_len,
+                               nonce_counter, mac_iv, stream_block);
+    if (len < 0) {
         return CCM_ERR_INVALID_DATA_LENGTH;
     }
 
@@ -211,16 +239,6 @@ int cipher_encrypt_ccm(const cipher_t *cipher,
         return len;
     }
 
-    /* Compute first stream block */
-    nonce_counter[0] = length_encoding - 1;
-    memcpy(&nonce_counter[1], nonce,
-           min(nonce_len, (size_t)15 - length_encoding));
-    len = cipher_encrypt_ctr(cipher, nonce_counter, block_size,
-                             zero_block, block_size, stream_block);
-    if (len < 0) {
-        return len;
-    }
-
     /* Encrypt message in counter mode  */
     crypto_block_inc_ctr(nonce_counter, block_size - nonce_len);
     len = cipher_encrypt_ctr(cipher, nonce_counter, nonce_len, input,
@@ -247,7 +265,6 @@ int cipher_decrypt_ccm(const cipher_t *cipher,
     int len = -1;
     uint8_t nonce_counter[16] = { 0 }, mac_iv[16] = { 0 }, mac[16] = { 0 },
             mac_recv[16] = { 0 }, stream_block[16] = { 0 },
-            zero_block[16] = { 0 },
             block_size;
     size_t plain_len;
 
@@ -260,20 +277,26 @@ int cipher_decrypt_ccm(const cipher_t *cipher,
         return CCM_ERR_INVALID_LENGTH_ENCODING;
     }
 
-    /* Compute first stream block */
-    nonce_counter[0] = length_encoding - 1;
     block_size = cipher_get_block_size(cipher);
     assert(block_size == CCM_BLOCK_SIZE);
+    plain_len = input_len - mac_length;
+
+    /* Create B0 and encrypt it (X1) to use it as mac_iv, compute first
+     * stream block */
+    nonce_counter[0] = length_encoding - 1;
     memcpy(&nonce_counter[1], nonce, min(nonce_len,
                                          (size_t)15 - length_encoding));
-    len = cipher_encrypt_ctr(cipher, nonce_counter, block_size, zero_block,
-                             block_size, stream_block);
+    len = ccm_create_mac_iv_s0(cipher, auth_data_len, mac_length,
+                               length_encoding, nonce, nonce_len, plain_len,
+                               nonce_counter, mac_iv, stream_block);
+    if (len == CIPHER_ERR_INVALID_LENGTH) {
+        return CCM_ERR_INVALID_DATA_LENGTH;
+    }
     if (len < 0) {
         return len;
     }
 
     /* Decrypt message in counter mode */
-    plain_len = input_len - mac_length;
     crypto_block_inc_ctr(nonce_counter, block_size - nonce_len);
     len = cipher_encrypt_ctr(cipher, nonce_counter, nonce_len, input,
                              plain_len, plain);
@@ -281,12 +304,6 @@ int cipher_decrypt_ccm(const cipher_t *cipher,
         return len;
     }
 
-    /* Create B0, encrypt it (X1) and use it as mac_iv */
-    if (ccm_create_mac_iv(cipher, auth_data_len, mac_length, length_encoding,
-                          nonce, nonce_len, plain_len, mac_iv) < 0) {
-        return CCM_ERR_INVALID_DATA_LENGTH;
-    }
-
     /* MAC calculation (T) with additional data and plaintext */
     len = ccm_compute_adata_mac(cipher, auth_data, auth_data_len, mac_iv);
     if (len < 0) {
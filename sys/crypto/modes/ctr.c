@@ -18,6 +18,8 @@
  * @}
  */
 
+#include <string.h>
+
 #include "crypto/helper.h"
 #include "crypto/modes/ctr.h"
 
@@ -26,24 +28,34 @@ int cipher_encrypt_ctr(const cipher_t *cipher, uint8_t nonce_counter[16],
                        uint8_t *output)
 {
     size_t offset = 0;
-    uint8_t stream_block[16] = { 0 }, block_size;
+    uint8_t stream[CONFIG_CIPHER_CTR_BATCH_BLOCKS * 16], block_size;
 
     block_size = cipher_get_block_size(cipher);
     do {
-        uint8_t block_size_input;
+        size_t nblocks = (length - offset + block_size - 1) / block_size;
+        size_t stream_len;
+
+        /* an empty input still consumes one counter value */
+        nblocks = (nblocks == 0) ? 1 : nblocks;
+        if (nblocks > CONFIG_CIPHER_CTR_BATCH_BLOCKS) {
+            nblocks = CONFIG_CIPHER_CTR_BATCH_BLOCKS;
+        }
 
-        if (cipher_encrypt(cipher, nonce_counter, stream_block) != 1) {
+        for (size_t i = 0; i < nblocks; i++) {
+            memcpy(&stream[i * block_size], nonce_counter, block_size);
+            crypto_block_inc_ctr(nonce_counter, block_size - nonce_len);
+        }
+        if (cipher_encrypt_blocks(cipher, stream, stream, nblocks) != 1) {
             return CIPHER_ERR_ENC_FAILED;
         }
 
-        block_size_input = (length - offset > block_size) ?
-                           block_size : length - offset;
-        for (uint8_t i = 0; i < block_size_input; ++i) {
-            output[offset + i] = stream_block[i] ^ input[offset + i];
+        stream_len = (length - offset > nblocks * block_size) ?
+                     nblocks * block_size : length - offset;
+        for (size_t i = 0; i < stream_len; ++i) {
+            output[offset + i] = stream[i] ^ input[offset + i];
         }
 
-        offset += block_size_input;
-        crypto_block_inc_ctr(nonce_counter, block_size - nonce_len);
+        offset += stream_len;
     } while (offset < length);
 
     return offset;
@@ -21,8 +21,6 @@
 #include <string.h>
 #include "crypto/poly1305.h"
 
-static void poly1305_block(poly1305_ctx_t *ctx, uint8_t c4);
-
 static uint32_t u8to32(const uint8_t *p)
 {
     return
@@ -49,7 +47,59 @@ static void _clear_c(poly1305_ctx_t *ctx)
     ctx->c_idx = 0;
 }
 
-static void poly1305_block(poly1305_ctx_t *ctx, uint8_t c4)
+#if defined(POLY1305_LIMB64)
+__extension__ typedef unsigned __int128 uint128_t;
+
+#define MASK44  0xfffffffffffULL
+#define MASK42  0x3ffffffffffULL
+
+static void poly1305_block(poly1305_ctx_t *ctx, const uint32_t c[4],
+                           uint8_t c4)
+{
+    const uint64_t r0 = ctx->r[0];
+    const uint64_t r1 = ctx->r[1];
+    const uint64_t r2 = ctx->r[2];
+
+    const uint64_t s1 = r1 * (5 << 2);
+    const uint64_t s2 = r2 * (5 << 2);
+
+    const uint64_t t0 = c[0] | ((uint64_t)c[1] << 32);
+    const uint64_t t1 = c[2] | ((uint64_t)c[3] << 32);
+
+    /* h += c, c4 is bit 128 */
+    uint64_t h0 = ctx->h[0] + (t0 & MASK44);
+    uint64_t h1 = ctx->h[1] + (((t0 >> 44) | (t1 << 20)) & MASK44);
+    uint64_t h2 = ctx->h[2] + ((t1 >> 24) & MASK42) + ((uint64_t)c4 << 40);
+
+    /* h *= r */
+    uint128_t d0 = (uint128_t)h0 * r0 + (uint128_t)h1 * s2 +
+                   (uint128_t)h2 * s1;
+    uint128_t d1 = (uint128_t)h0 * r1 + (uint128_t)h1 * r0 +
+                   (uint128_t)h2 * s2;
+    uint128_t d2 = (uint128_t)h0 * r2 + (uint128_t)h1 * r1 +
+                   (uint128_t)h2 * r0;
+
+    /* partial reduction modulo 2^130 - 5 */
+    uint64_t carry = (uint64_t)(d0 >> 44);
+    h0 = (uint64_t)d0 & MASK44;
+    d1 += carry;
+    carry = (uint64_t)(d1 >> 44);
+    h1 = (uint64_t)d1 & MASK44;
+    d2 += carry;
+    carry = (uint64_t)(d2 >> 42);
+    h2 = (uint64_t)d2 & MASK42;
+    h0 += carry * 5;
+    carry = h0 >> 44;
+    h0 &= MASK44;
+    h1 += carry;
+
+    ctx->h[0] = h0;
+    ctx->h[1] = h1;
+    ctx->h[2] = h2;
+}
+#else
+static void poly1305_block(poly1305_ctx_t *ctx, const uint32_t c[4],
+                           uint8_t c4)
 {
     /* Local copies */
     const uint32_t r0 = ctx->r[0];
@@ -63,10 +113,10 @@ static void poly1305_block(poly1305_ctx_t *ctx, uint8_t c4)
     const uint32_t rr3 = (r3 >> 2) + r3;
 
     /* s = h + c, without carry propagation */
-    const uint64_t s0 = ctx->h[0] + (uint64_t)ctx->c[0];
-    const uint64_t s1 = ctx->h[1] + (uint64_t)ctx->c[1];
-    const uint64_t s2 = ctx->h[2] + (uint64_t)ctx->c[2];
-    const uint64_t s3 = ctx->h[3] + (uint64_t)ctx->c[3];
+    const uint64_t s0 = ctx->h[0] + (uint64_t)c[0];
+    const uint64_t s1 = ctx->h[1] + (uint64_t)c[1];
+    const uint64_t s2 = ctx->h[2] + (uint64_t)c[2];
+    const uint64_t s3 = ctx->h[3] + (uint64_t)c[3];
     const uint32_t s4 = ctx->h[4] + c4;
 
     /* (h + c) * r, without carry propagation */
@@ -91,6 +141,7 @@ static void poly1305_block(poly1305_ctx_t *ctx, uint8_t c4)
     ctx->h[3] = (uint32_t)u3;
     ctx->h[4] = (uint32_t)u4;
 }
+#endif
 
 static void _take_input(poly1305_ctx_t *ctx, uint8_t input)
 {
@@ -103,24 +154,60 @@ static void _take_input(poly1305_ctx_t *ctx, uint8_t input)
 
 void poly1305_update(poly1305_ctx_t *ctx, const uint8_t *data, size_t len)
 {
-    for (size_t i = 0; i < len; i++) {
-        _take_input(ctx, data[i]);
-        if (ctx->c_idx == 16) {
-            poly1305_block(ctx, 1);
+    /* complete a pending chunk */
+    while (ctx->c_idx && len) {
+        _take_input(ctx, *data++);
+        len--;
+        if (ctx->c_idx == POLY1305_BLOCK_SIZE) {
+            poly1305_block(ctx, ctx->c, 1);
             _clear_c(ctx);
         }
     }
+
+    /* full blocks are processed straight from the input */
+    for (; len >= POLY1305_BLOCK_SIZE; len -= POLY1305_BLOCK_SIZE) {
+        const uint32_t c[4] = {
+            u8to32(data), u8to32(data + 4), u8to32(data + 8), u8to32(data + 12)
+        };
+
+        poly1305_block(ctx, c, 1);
+        data += POLY1305_BLOCK_SIZE;
+    }
+
+    while (len--) {
+        _take_input(ctx, *data++);
+    }
 }
 
 void poly1305_init(poly1305_ctx_t *ctx, const uint8_t *key)
 {
-    /* load and clamp key */
-    ctx->r[0] = u8to32(key) & 0x0fffffff;
-    for (size_t i = 1; i < 4; i++) {
-        ctx->r[i] = u8to32(&key[4 * i]) & 0x0ffffffc;
+    /* the key may overlap with the context, load it completely first */
+    uint32_t k[8];
+
+    for (size_t i = 0; i < 8; i++) {
+        k[i] = u8to32(&key[4 * i]);
+    }
+
+    /* clamp key */
+    k[0] &= 0x0fffffff;
+    k[1] &= 0x0ffffffc;
+    k[2] &= 0x0ffffffc;
+    k[3] &= 0x0ffffffc;
+
+#if defined(POLY1305_LIMB64)
+    const uint64_t t0 = k[0] | ((uint64_t)k[1] << 32);
+    const uint64_t t1 = k[2] | ((uint64_t)k[3] << 32);
+
+    ctx->r[0] = t0 & MASK44;
+    ctx->r[1] = ((t0 >> 44) | (t1 << 20)) & MASK44;
+    ctx->r[2] = (t1 >> 24) & MASK42;
+#else
+    for (size_t i = 0; i < 4; i++) {
+        ctx->r[i] = k[i];
     }
+#endif
     for (size_t i = 0; i < 4; i++) {
-        ctx->pad[i] = u8to32(&key[16 + i * 4]);
+        ctx->pad[i] = k[4 + i];
     }
 
     /* Zero the hash */
@@ -128,6 +215,7 @@ void poly1305_init(poly1305_ctx_t *ctx, const uint8_t *key)
     _clear_c(ctx);
 }
 
+#if defined(POLY1305_LIMB64)
 void poly1305_finish(poly1305_ctx_t *ctx, uint8_t *mac)
 {
     /* Process the last block if there is data remaining */
@@ -136,9 +224,80 @@ void poly1305_finish(poly1305_ctx_t *ctx, uint8_t *mac)
         /* (We may add less than 2^130 to the last input block) */
         _take_input(ctx, 1);
         /* And update hash */
-        poly1305_block(ctx, 0);
+        poly1305_block(ctx, ctx->c, 0);
     }
 
+    uint64_t h0 = ctx->h[0];
+    uint64_t h1 = ctx->h[1];
+    uint64_t h2 = ctx->h[2];
+    uint64_t carry;
+
+    /* fully carry h */
+    carry = h1 >> 44;
+    h1 &= MASK44;
+    h2 += carry;
+    carry = h2 >> 42;
+    h2 &= MASK42;
+    h0 += carry * 5;
+    carry = h0 >> 44;
+    h0 &= MASK44;
+    h1 += carry;
+    carry = h1 >> 44;
+    h1 &= MASK44;
+    h2 += carry;
+    carry = h2 >> 42;
+    h2 &= MASK42;
+    h0 += carry * 5;
+    carry = h0 >> 44;
+    h0 &= MASK44;
+    h1 += carry;
+
+    /* g = h - (2^130 - 5) */
+    uint64_t g0 = h0 + 5;
+    carry = g0 >> 44;
+    g0 &= MASK44;
+    uint64_t g1 = h1 + carry;
+    carry = g1 >> 44;
+    g1 &= MASK44;
+    uint64_t g2 = h2 + carry - (1ULL << 42);
+
+    /* select h if h < 2^130 - 5, g otherwise, in constant time */
+    uint64_t mask = (g2 >> 63) - 1;
+    h0 = (h0 & ~mask) | (g0 & mask);
+    h1 = (h1 & ~mask) | (g1 & mask);
+    h2 = (h2 & ~mask) | (g2 & mask);
+
+    /* h + pad */
+    const uint64_t t0 = ctx->pad[0] | ((uint64_t)ctx->pad[1] << 32);
+    const uint64_t t1 = ctx->pad[2] | ((uint64_t)ctx->pad[3] << 32);
+
+    h0 += t0 & MASK44;
+    carry = h0 >> 44;
+    h0 &= MASK44;
+    h1 += (((t0 >> 44) | (t1 << 20)) & MASK44) + carry;
+    carry = h1 >> 44;
+    h1 &= MASK44;
+    h2 += ((t1 >> 24) & MASK42) + carry;
+
+    /* mac = h % 2^128 */
+    h0 = h0 | (h1 << 44);
+    h1 = (h1 >> 20) | (h2 << 24);
+    u32to8(mac, h0);
+    u32to8(mac + 4, h0 >> 32);
+    u32to8(mac + 8, h1);
+    u32to8(mac + 12, h1 >> 32);
+}
+#else
+void poly1305_finish(poly1305_ctx_t *ctx, uint8_t *mac)
+{
+    /* Process the last block if there is data remaining */
+    if (ctx->c_idx) {
+        /* move the final 1 according to remaining input length */
+        /* (We may add less than 2^130 to the last input block) */
+        _take_input(ctx, 1);
+        /* And update hash */
+        poly1305_block(ctx, ctx->c, 0);
+    }
     /* check if we should subtract 2^130-5 by performing the
      * corresponding carry propagation. */
     const uint64_t u0 = (uint64_t)5 + ctx->h[0];    // <= 1_00000004
@@ -160,8 +319,8 @@ void poly1305_finish(poly1305_ctx_t *ctx, uint8_t *mac)
 
     const uint64_t uu3 = (uu2 >> 32)   + ctx->h[3] + ctx->pad[3];
     u32to8(mac + 12, uu3);
-
 }
+#endif
 
 void poly1305_auth(uint8_t *mac, const uint8_t *data, size_t len,
                    const uint8_t *key)
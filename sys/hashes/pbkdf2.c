@@ -21,6 +21,7 @@
 #include <string.h>
 
 #include "hashes/sha256.h"
+#include "hashes/sha2xx_common.h"
 #include "hashes/pbkdf2.h"
 #include "crypto/helper.h"
 
@@ -32,6 +33,16 @@ static void inplace_xor_scalar(uint8_t *bytes, size_t len, uint8_t c)
     }
 }
 
+static void state_to_digest(uint8_t *digest, const uint32_t *state)
+{
+    for (unsigned i = 0; i < SHA256_DIGEST_LENGTH / 4; i++) {
+        digest[4 * i]     = state[i] >> 24;
+        digest[4 * i + 1] = state[i] >> 16;
+        digest[4 * i + 2] = state[i] >> 8;
+        digest[4 * i + 3] = state[i];
+    }
+}
+
 static void inplace_xor_digests(uint8_t *d1, const uint8_t *d2)
 {
     int len = SHA256_DIGEST_LENGTH;
@@ -51,7 +62,6 @@ void pbkdf2_sha256(const void *password, size_t password_len,
     sha256_context_t inner;
     sha256_context_t outer;
     uint8_t tmp_digest[SHA256_DIGEST_LENGTH];
-    int first_iter = 1;
 
     {
         uint8_t processed_pass[SHA256_INTERNAL_BLOCK_SIZE] = {0};
@@ -82,17 +92,11 @@ void pbkdf2_sha256(const void *password, size_t password_len,
 
     memset(output, 0, SHA256_DIGEST_LENGTH);
 
-    while (iterations--) {
+    if (iterations > 0) {
         sha256_context_t inner_copy = inner, outer_copy = outer;
 
-        if (first_iter) {
-            sha256_update(&inner_copy, salt, salt_len);
-            sha256_update(&inner_copy, "\x00\x00\x00\x01", 4);
-            first_iter = 0;
-        } else {
-            sha256_update(&inner_copy, tmp_digest, sizeof(tmp_digest));
-        }
-
+        sha256_update(&inner_copy, salt, salt_len);
+        sha256_update(&inner_copy, "\x00\x00\x00\x01", 4);
         sha256_final(&inner_copy, tmp_digest);
 
         sha256_update(&outer_copy, tmp_digest, sizeof(tmp_digest));
@@ -100,12 +104,37 @@ void pbkdf2_sha256(const void *password, size_t password_len,
 
         inplace_xor_digests(output, tmp_digest);
 
-        if (iterations == 0) {
-            crypto_secure_wipe(&inner_copy, sizeof(inner_copy));
-            crypto_secure_wipe(&outer_copy, sizeof(outer_copy));
-        }
+        crypto_secure_wipe(&inner_copy, sizeof(inner_copy));
+        crypto_secure_wipe(&outer_copy, sizeof(outer_copy));
+    }
+
+    /* All further iterations hash a single digest after the key block, so
+     * both the inner and the outer hash are a single padded block that is
+     * compressed directly. */
+    uint8_t block[SHA256_INTERNAL_BLOCK_SIZE] = {0};
+    uint32_t state[8];
+    const uint32_t bitlen = (SHA256_INTERNAL_BLOCK_SIZE +
+                             SHA256_DIGEST_LENGTH) * 8;
+
+    block[SHA256_DIGEST_LENGTH] = 0x80;
+    block[sizeof(block) - 2] = bitlen >> 8;
+    block[sizeof(block) - 1] = bitlen & 0xff;
+
+    for (int i = 1; i < iterations; i++) {
+        memcpy(block, tmp_digest, sizeof(tmp_digest));
+        memcpy(state, inner.state, sizeof(state));
+        sha2xx_transform(state, block);
+        state_to_digest(block, state);
+
+        memcpy(state, outer.state, sizeof(state));
+        sha2xx_transform(state, block);
+        state_to_digest(tmp_digest, state);
+
+        inplace_xor_digests(output, tmp_digest);
     }
 
+    crypto_secure_wipe(block, sizeof(block));
+    crypto_secure_wipe(state, sizeof(state));
     crypto_secure_wipe(&inner, sizeof(inner));
     crypto_secure_wipe(&outer, sizeof(outer));
     crypto_secure_wipe(&tmp_digest, sizeof(tmp_digest));
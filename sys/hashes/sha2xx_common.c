@@ -130,42 +130,78 @@ static const uint32_t K[64] = {
     0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2,
 };
 
+/*
+ * Single round of the compression, the working variables are renamed by the
+ * caller instead of being moved around. d and h are updated in place.
+ */
+#define RND(a, b, c, d, e, f, g, h, w, k) \
+    do { \
+        uint32_t t0 = h + S1(e) + Ch(e, f, g) + (w) + (k); \
+        uint32_t t1 = S0(a) + Maj(a, b, c); \
+        d += t0; \
+        h = t0 + t1; \
+    } while (0)
+
+/* Eight rounds starting at round i, after which the names line up again */
+#define RND8(w) \
+    do { \
+        RND(a, b, c, d, e, f, g, h, w(0), K[i + 0]); \
+        RND(h, a, b, c, d, e, f, g, w(1), K[i + 1]); \
+        RND(g, h, a, b, c, d, e, f, w(2), K[i + 2]); \
+        RND(f, g, h, a, b, c, d, e, w(3), K[i + 3]); \
+        RND(e, f, g, h, a, b, c, d, w(4), K[i + 4]); \
+        RND(d, e, f, g, h, a, b, c, w(5), K[i + 5]); \
+        RND(c, d, e, f, g, h, a, b, w(6), K[i + 6]); \
+        RND(b, c, d, e, f, g, h, a, w(7), K[i + 7]); \
+    } while (0)
+
+/* Message words of the first 16 rounds */
+#define W_BLOCK(j)  W[i + (j)]
+
+/* Message schedule of the remaining rounds, only the last 16 words are kept */
+#define W_NEXT(j) \
+    (W[(i + (j)) & 15] += s1(W[(i + (j) - 2) & 15]) + W[(i + (j) - 7) & 15] + \
+                          s0(W[(i + (j) - 15) & 15]))
+
 /*
  * SHA256 block compression function.  The 256-bit state is transformed via
  * the 512-bit input block to produce a new state.
  */
-static void sha2xx_transform(uint32_t *state, const unsigned char block[64])
+void sha2xx_transform(uint32_t *state, const void *block)
 {
-    uint32_t W[64];
-    uint32_t S[8];
+    uint32_t W[16];
+    unsigned i;
 
-    /* 1. Prepare message schedule W. */
+    /* 1. Load the message block. */
     be32dec_vect(W, block, 64);
-    for (int i = 16; i < 64; i++) {
-        W[i] = s1(W[i - 2]) + W[i - 7] + s0(W[i - 15]) + W[i - 16];
-    }
 
     /* 2. Initialize working variables. */
-    memcpy(S, state, 32);
-
-    /* 3. Mix. */
-    for (int i = 0; i < 64; ++i) {
-        uint32_t e = S[(68 - i) % 8], f = S[(69 - i) % 8];
-        uint32_t g = S[(70 - i) % 8], h = S[(71 - i) % 8];
-        uint32_t t0 = h + S1(e) + Ch(e, f, g) + W[i] + K[i];
-
-        uint32_t a = S[(64 - i) % 8], b = S[(65 - i) % 8];
-        uint32_t c = S[(66 - i) % 8], d = S[(67 - i) % 8];
-        uint32_t t1 = S0(a) + Maj(a, b, c);
-
-        S[(67 - i) % 8] = d + t0;
-        S[(71 - i) % 8] = t0 + t1;
+    uint32_t a = state[0];
+    uint32_t b = state[1];
+    uint32_t c = state[2];
+    uint32_t d = state[3];
+    uint32_t e = state[4];
+    uint32_t f = state[5];
+    uint32_t g = state[6];
+    uint32_t h = state[7];
+
+    /* 3. Mix, while extending the message schedule. */
+    for (i = 0; i < 16; i += 8) {
+        RND8(W_BLOCK);
+    }
+    for (; i < 64; i += 8) {
+        RND8(W_NEXT);
     }
 
     /* 4. Mix local working variables into global state */
-    for (int i = 0; i < 8; i++) {
-        state[i] += S[i];
-    }
+    state[0] += a;
+    state[1] += b;
+    state[2] += c;
+    state[3] += d;
+    state[4] += e;
+    state[5] += f;
+    state[6] += g;
+    state[7] += h;
 }
 
 static unsigned char PAD[64] = {
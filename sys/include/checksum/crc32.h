@@ -27,13 +27,29 @@
 extern "C" {
 #endif
 
+/**
+ * @brief   Number of lookup tables used by the `crc32_fast` module
+ *
+ * Each table takes 1 KiB of flash. With 4 or 8 tables, 4 or 8 bytes are
+ * processed with a single lookup per byte and without a dependency between
+ * the lookups ("slice-by-4/8"). 1 processes the input byte by byte.
+ */
+#ifndef CONFIG_CRC32_FAST_SLICES
+#define CONFIG_CRC32_FAST_SLICES    1
+#endif
+
+#if (CONFIG_CRC32_FAST_SLICES != 1) && (CONFIG_CRC32_FAST_SLICES != 4) && \
+    (CONFIG_CRC32_FAST_SLICES != 8)
+#error "CONFIG_CRC32_FAST_SLICES must be 1, 4 or 8"
+#endif
+
 /**
  * @brief   CRC-32 checksum
  *
  * Uses the `0xedb88320` polynomial
  *
  * @note enable the `crc32_fast` module for a look-up table based implementation
- *       that trades code size for speed.
+ *       that trades code size for speed, see @ref CONFIG_CRC32_FAST_SLICES.
  *
  * @param[in] buf   The data to checksum
  * @param[in] size  Length of the data in bytes
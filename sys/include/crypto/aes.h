@@ -30,6 +30,7 @@
 #ifndef CRYPTO_AES_H
 #define CRYPTO_AES_H
 
+#include <stddef.h>
 #include <stdint.h>
 #include "crypto/ciphers.h"
 
@@ -105,6 +106,26 @@ int aes_init(cipher_context_t *context, const uint8_t *key, uint8_t keySize);
 int aes_encrypt(const cipher_context_t *context, const uint8_t *plain_block,
                 uint8_t *cipher_block);
 
+/**
+ * @brief   encrypts consecutive blocks of plaintext
+ *
+ * Same as calling @ref aes_encrypt for every block, but the key schedule is
+ * computed only once.
+ *
+ * @param       context       the cipher_context_t-struct to use for this
+ *                            encryption
+ * @param       plain         a pointer to @p nblocks plaintext blocks
+ * @param       cipher        a pointer to the place where the @p nblocks
+ *                            ciphertext blocks will be stored
+ * @param       nblocks       number of blocks
+ *
+ * @return  1 on success
+ * @return  A negative value if the cipher key cannot be expanded with the
+ *          AES key schedule
+ */
+int aes_encrypt_blocks(const cipher_context_t *context, const uint8_t *plain,
+                       uint8_t *cipher, size_t nblocks);
+
 /**
  * @brief   decrypts one cipher-block and saves the plain-block in plainBlock.
  *          decrypts one blocksize long block of ciphertext pointed to by
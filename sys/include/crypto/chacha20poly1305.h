@@ -43,9 +43,9 @@ extern "C" {
  */
 typedef union {
     /* We need both the state matrix and the poly1305 state, but nearly not at
-     * the same time. This works as long as the first 8 members of state
-     * overlap fully or completely not with the first and second key parts
-     * from the @ref poly1305_ctx_t struct */
+     * the same time. This works as poly1305_init() reads the complete key
+     * from the first 8 members of state before initializing the
+     * @ref poly1305_ctx_t struct */
     uint32_t state[16];     /**< The current state of the key stream. */
     poly1305_ctx_t poly;    /**< Poly1305 state for the MAC */
 } chacha20poly1305_ctx_t;
@@ -22,6 +22,7 @@
 #ifndef CRYPTO_CIPHERS_H
 #define CRYPTO_CIPHERS_H
 
+#include <stddef.h>
 #include <stdint.h>
 #include "modules.h"
 
@@ -102,6 +103,16 @@ typedef struct cipher_interface_st {
     /** @brief the decrypt function */
     int (*decrypt)(const cipher_context_t *ctx, const uint8_t *cipher_block,
                    uint8_t *plain_block);
+
+    /**
+     * @brief the multi-block encrypt function
+     *
+     * Optional, encrypts @p nblocks independent blocks. Ciphers can process
+     * several blocks cheaper than one by one, e.g. by preparing the key only
+     * once.
+     */
+    int (*encrypt_blocks)(const cipher_context_t *ctx, const uint8_t *plain,
+                          uint8_t *cipher, size_t nblocks);
 } cipher_interface_t;
 
 /** Pointer type to BlockCipher-Interface for the Cipher-Algorithms */
@@ -157,6 +168,25 @@ int cipher_init(cipher_t *cipher, cipher_id_t cipher_id, const uint8_t *key,
 int cipher_encrypt(const cipher_t *cipher, const uint8_t *input,
                    uint8_t *output);
 
+/**
+ * @brief Encrypt consecutive blocks of BLOCK_SIZE length
+ *
+ * Same as calling @ref cipher_encrypt for every block, but faster if the
+ * cipher supports processing multiple blocks at once.
+ *
+ * @param cipher     Already initialized cipher struct
+ * @param input      pointer to @p nblocks blocks of input data to encrypt
+ * @param output     pointer to allocated memory for encrypted data. It has to
+ *                   be of size @p nblocks * BLOCK_SIZE
+ * @param nblocks    number of blocks
+ *
+ * @return           The result of the encrypt operation of the underlying
+ *                   cipher, which is always 1 in case of success
+ * @return           A negative value for an error
+ */
+int cipher_encrypt_blocks(const cipher_t *cipher, const uint8_t *input,
+                          uint8_t *output, size_t nblocks);
+
 /**
  * @brief Decrypt data of BLOCK_SIZE length
  * *
@@ -26,6 +26,16 @@
 extern "C" {
 #endif
 
+/**
+ * @brief Number of key stream blocks computed at once in counter mode
+ *
+ * The key stream is computed with @ref cipher_encrypt_blocks. Each block
+ * takes 16 bytes of stack.
+ */
+#ifndef CONFIG_CIPHER_CTR_BATCH_BLOCKS
+#define CONFIG_CIPHER_CTR_BATCH_BLOCKS  4
+#endif
+
 /**
  * @brief Encrypt data of arbitrary length in counter mode.
  *
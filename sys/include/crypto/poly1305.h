@@ -40,13 +40,26 @@ extern "C" {
  */
 #define POLY1305_BLOCK_SIZE 16
 
+/**
+ * @brief Poly1305 uses 44 bit limbs and 128 bit products if the compiler
+ *        supports 128 bit integers, 32 bit limbs otherwise
+ */
+#if defined(__SIZEOF_INT128__) || DOXYGEN
+#define POLY1305_LIMB64     1
+#endif
+
 /**
  * @brief Poly1305 context
  */
 typedef struct {
+#if defined(POLY1305_LIMB64)
+    uint64_t r[3];                          /**< first key part         */
+    uint64_t h[3];                          /**< Hash                   */
+#else
     uint32_t r[4];                          /**< first key part         */
-    uint32_t pad[4];                        /**< Second key part        */
     uint32_t h[5];                          /**< Hash                   */
+#endif
+    uint32_t pad[4];                        /**< Second key part        */
     uint32_t c[4];                          /**< Message chunk          */
     size_t c_idx;                           /**< Chunk length            */
 } poly1305_ctx_t;
@@ -68,6 +68,18 @@ typedef struct {
     unsigned char buf[64];
 } sha2xx_context_t;
 
+/**
+ * @brief SHA-2XX block compression
+ *
+ * Mixes one complete block into @p state. Neither the buffer nor the bit
+ * count of a context are touched, the caller has to do the padding of the
+ * last block.
+ *
+ * @param state     state of a sha2xx_context_t to update
+ * @param[in] block 64 byte input block
+ */
+void sha2xx_transform(uint32_t *state, const void *block);
+
 /**
  * @brief SHA-2XX initialization.  Begins a SHA-2XX operation.
  *
@@ -565,6 +565,22 @@ extern "C" {
 #define CONFIG_GCOAP_OBS_REGISTRATIONS_MAX     (2)
 #endif
 
+/**
+ * @ingroup net_gcoap_conf
+ * @brief   Use hash indices to look up request and observe memos
+ *
+ * Without this, every incoming message is matched by a linear search over
+ * all @ref CONFIG_GCOAP_REQ_WAITING_MAX open requests and all
+ * @ref CONFIG_GCOAP_OBS_REGISTRATIONS_MAX observe registrations. With this,
+ * open requests are indexed by message ID and token, observers by endpoint
+ * and observe registrations by token and resource. This is worth it if these
+ * limits are raised considerably. It costs 12 bytes of RAM per open request
+ * and per observe registration, and 6 bytes per observe client.
+ */
+#ifndef CONFIG_GCOAP_MEMO_HASH
+#define CONFIG_GCOAP_MEMO_HASH                 0
+#endif
+
 /**
  * @name    States for the memo used to track Observe registrations
  * @{
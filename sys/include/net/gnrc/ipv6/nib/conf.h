@@ -234,6 +234,30 @@ extern "C" {
 #ifndef CONFIG_GNRC_IPV6_NIB_MULTIHOP_DAD
 #define CONFIG_GNRC_IPV6_NIB_MULTIHOP_DAD             0
 #endif
+
+/**
+ * @brief   Use a trie for longest-prefix-match lookups in the off-link entries
+ *
+ * Route lookups then scale with the prefix length instead of with
+ * @ref CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF, at the cost of
+ * 2 * @ref CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF trie nodes of RAM. Worth it for
+ * routers with many forwarding table entries, e.g. RPL root nodes.
+ */
+#ifndef CONFIG_GNRC_IPV6_NIB_OFFL_TRIE
+#define CONFIG_GNRC_IPV6_NIB_OFFL_TRIE                0
+#endif
+
+/**
+ * @brief   Use a hash index for address lookups in the on-link entries
+ *
+ * Neighbor cache lookups then take constant time instead of scaling with
+ * @ref CONFIG_GNRC_IPV6_NIB_NUMOF, at the cost of
+ * 4 * @ref CONFIG_GNRC_IPV6_NIB_NUMOF bytes of RAM. Worth it for border
+ * routers serving many hosts.
+ */
+#ifndef CONFIG_GNRC_IPV6_NIB_NC_HASH
+#define CONFIG_GNRC_IPV6_NIB_NC_HASH                  0
+#endif
 /** @} */
 
 /**
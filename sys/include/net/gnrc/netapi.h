@@ -93,6 +93,30 @@ extern "C" {
  */
 #define GNRC_NETAPI_MSG_TYPE_ACK        (0x0205)
 
+/**
+ * @brief   @ref core_msg type for passing a batch of @ref net_gnrc_pkt down
+ *          the network stack
+ *
+ * The message carries a batch container as created by
+ * @ref gnrc_netapi_send_batch(). The receiver takes over the packets in the
+ * batch and releases the container.
+ *
+ * @see     gnrc_netapi_batch_numof(), gnrc_netapi_batch_get()
+ */
+#define GNRC_NETAPI_MSG_TYPE_SND_BATCH  (0x0207)
+
+/**
+ * @brief   @ref core_msg type for passing a batch of @ref net_gnrc_pkt up
+ *          the network stack
+ *
+ * The message carries a batch container as created by
+ * @ref gnrc_netapi_receive_batch(). The receiver takes over the packets in
+ * the batch and releases the container.
+ *
+ * @see     gnrc_netapi_batch_numof(), gnrc_netapi_batch_get()
+ */
+#define GNRC_NETAPI_MSG_TYPE_RCV_BATCH  (0x0208)
+
 /**
  * @brief   Data structure to be send for setting (@ref GNRC_NETAPI_MSG_TYPE_SET)
  *          and getting (@ref GNRC_NETAPI_MSG_TYPE_GET) options
@@ -119,6 +143,29 @@ typedef struct {
  */
 int _gnrc_netapi_send_recv(kernel_pid_t pid, gnrc_pktsnip_t *pkt, uint16_t type);
 
+/**
+ * @brief   Shortcut function for sending @ref GNRC_NETAPI_MSG_TYPE_SND_BATCH
+ *          or @ref GNRC_NETAPI_MSG_TYPE_RCV_BATCH messages
+ *
+ * The pointers in @p pkts are copied into a batch container in the packet
+ * buffer, so @p pkts may live on the stack of the caller.
+ *
+ * @param[in] pid       PID of the targeted network module
+ * @param[in] pkts      packets to send
+ * @param[in] numof     number of packets in @p pkts, must be > 0
+ * @param[in] type      type of the message to send. Must be either
+ *                      @ref GNRC_NETAPI_MSG_TYPE_SND_BATCH or
+ *                      @ref GNRC_NETAPI_MSG_TYPE_RCV_BATCH
+ *
+ * @return              1 if the batch was successfully delivered
+ * @return              -1 on error (invalid PID or no space in queue)
+ * @return              -ENOBUFS if no batch container could be allocated
+ *
+ * @note    On error the caller keeps the ownership of the packets in @p pkts.
+ */
+int _gnrc_netapi_send_recv_batch(kernel_pid_t pid, gnrc_pktsnip_t *const *pkts,
+                                 unsigned numof, uint16_t type);
+
 /**
  * @brief   Shortcut function for sending @ref GNRC_NETAPI_MSG_TYPE_GET or
  *          @ref GNRC_NETAPI_MSG_TYPE_SET messages and parsing the returned
@@ -155,6 +202,31 @@ static inline int gnrc_netapi_send(kernel_pid_t pid, gnrc_pktsnip_t *pkt)
     return _gnrc_netapi_send_recv(pid, pkt, GNRC_NETAPI_MSG_TYPE_SND);
 }
 
+/**
+ * @brief   Shortcut function for sending @ref GNRC_NETAPI_MSG_TYPE_SND_BATCH
+ *          messages
+ *
+ * Hands a train of packets to @p pid with a single message, e.g. all
+ * fragments of a datagram, so the receiver can process them in one wakeup.
+ *
+ * @param[in] pid       PID of the targeted network module
+ * @param[in] pkts      packets to send
+ * @param[in] numof     number of packets in @p pkts, must be > 0
+ *
+ * @return              1 if the batch was successfully delivered
+ * @return              -1 on error (invalid PID or no space in queue)
+ * @return              -ENOBUFS if no batch container could be allocated
+ *
+ * @note    On error the caller keeps the ownership of the packets in @p pkts.
+ */
+static inline int gnrc_netapi_send_batch(kernel_pid_t pid,
+                                         gnrc_pktsnip_t *const *pkts,
+                                         unsigned numof)
+{
+    return _gnrc_netapi_send_recv_batch(pid, pkts, numof,
+                                        GNRC_NETAPI_MSG_TYPE_SND_BATCH);
+}
+
 /**
  * @brief   Sends @p cmd to all subscribers to (@p type, @p demux_ctx).
  *
@@ -198,6 +270,59 @@ static inline int gnrc_netapi_receive(kernel_pid_t pid, gnrc_pktsnip_t *pkt)
     return _gnrc_netapi_send_recv(pid, pkt, GNRC_NETAPI_MSG_TYPE_RCV);
 }
 
+/**
+ * @brief   Shortcut function for sending @ref GNRC_NETAPI_MSG_TYPE_RCV_BATCH
+ *          messages
+ *
+ * @param[in] pid       PID of the targeted network module
+ * @param[in] pkts      received packets
+ * @param[in] numof     number of packets in @p pkts, must be > 0
+ *
+ * @return              1 if the batch was successfully delivered
+ * @return              -1 on error (invalid PID or no space in queue)
+ * @return              -ENOBUFS if no batch container could be allocated
+ *
+ * @note    On error the caller keeps the ownership of the packets in @p pkts.
+ */
+static inline int gnrc_netapi_receive_batch(kernel_pid_t pid,
+                                            gnrc_pktsnip_t *const *pkts,
+                                            unsigned numof)
+{
+    return _gnrc_netapi_send_recv_batch(pid, pkts, numof,
+                                        GNRC_NETAPI_MSG_TYPE_RCV_BATCH);
+}
+
+/**
+ * @brief   Gets the number of packets in a batch container
+ *
+ * @param[in] batch     batch container received with a
+ *                      @ref GNRC_NETAPI_MSG_TYPE_SND_BATCH or
+ *                      @ref GNRC_NETAPI_MSG_TYPE_RCV_BATCH message
+ *
+ * @return  number of packets in @p batch
+ */
+static inline unsigned gnrc_netapi_batch_numof(const gnrc_pktsnip_t *batch)
+{
+    return batch->size / sizeof(gnrc_pktsnip_t *);
+}
+
+/**
+ * @brief   Gets a packet from a batch container
+ *
+ * @param[in] batch     batch container received with a
+ *                      @ref GNRC_NETAPI_MSG_TYPE_SND_BATCH or
+ *                      @ref GNRC_NETAPI_MSG_TYPE_RCV_BATCH message
+ * @param[in] idx       index of the packet, must be lesser than
+ *                      gnrc_netapi_batch_numof(@p batch)
+ *
+ * @return  the packet at @p idx
+ */
+static inline gnrc_pktsnip_t *gnrc_netapi_batch_get(const gnrc_pktsnip_t *batch,
+                                                    unsigned idx)
+{
+    return ((gnrc_pktsnip_t **)batch->data)[idx];
+}
+
 /**
  * @brief   Sends a @ref GNRC_NETAPI_MSG_TYPE_RCV command to all subscribers to
  *          (@p type, @p demux_ctx).
@@ -735,6 +735,25 @@ static inline int gnrc_netif_send(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt)
     return gnrc_netapi_send(netif->pid, pkt);
 }
 
+/**
+ * @brief   Send a batch of GNRC packets via a given @ref gnrc_netif_t
+ *          interface with a single message.
+ *
+ * @param netif         pointer to the interface
+ * @param pkts          packets to be sent.
+ * @param numof         number of packets in @p pkts, must be > 0
+ *
+ * @return              1 if the packets were successfully delivered
+ * @return              -1 or -ENOBUFS on error. The packets in @p pkts are
+ *                      not released in that case.
+ */
+static inline int gnrc_netif_send_batch(gnrc_netif_t *netif,
+                                        gnrc_pktsnip_t *const *pkts,
+                                        unsigned numof)
+{
+    return gnrc_netapi_send_batch(netif->pid, pkts, numof);
+}
+
 #if defined(MODULE_GNRC_NETIF_BUS) || DOXYGEN
 /**
  * @brief   Get a message bus of a given @ref gnrc_netif_t interface.
@@ -35,6 +35,25 @@
 extern "C" {
 #endif
 
+/**
+ * @defgroup net_gnrc_netreg_conf GNRC NETREG compile configurations
+ * @ingroup net_gnrc_conf
+ * @{
+ */
+/**
+ * @brief   Number of hash buckets for UDP registrations
+ *
+ * UDP registrations are demultiplexed by port, so with many sockets the lookup
+ * of a port dominates the delivery of a datagram. With more than one bucket
+ * the registrations are spread over buckets by port and a lookup only walks
+ * the registrations in the bucket of the port. Each bucket costs one pointer
+ * of RAM. Set to 1 to keep all UDP registrations in a single list.
+ */
+#ifndef CONFIG_GNRC_NETREG_UDP_BUCKETS
+#define CONFIG_GNRC_NETREG_UDP_BUCKETS  (4U)
+#endif
+/** @} */
+
 #if defined(MODULE_GNRC_NETAPI_MBOX) || defined(MODULE_GNRC_NETAPI_CALLBACKS) || \
     defined(DOXYGEN)
 /**
@@ -342,6 +361,8 @@ static inline void gnrc_netreg_entry_init_cb(gnrc_netreg_entry_t *entry,
  *
  * @warning Call gnrc_netreg_unregister() *before* you leave the context you
  *          allocated @p entry in. Otherwise it might get overwritten.
+ * @warning Do not change gnrc_netreg_entry_t::demux_ctx of @p entry while it
+ *          is registered.
  *
  * @pre The calling thread must provide a [message queue](@ref msg_init_queue)
  *      when using @ref GNRC_NETREG_TYPE_DEFAULT for gnrc_netreg_entry_t::type
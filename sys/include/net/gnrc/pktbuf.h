@@ -18,6 +18,18 @@
  *          this *will* lead to alignment problems and can potentially result
  *          in segmentation/hard faults and other unexpected behaviour.
  *
+ * There are three implementations of this interface:
+ *
+ * - `gnrc_pktbuf_static` (default) manages a static arena of
+ *   @ref CONFIG_GNRC_PKTBUF_SIZE bytes with a first-fit free list.
+ * - `gnrc_pktbuf_slab` keeps static pools of fixed-size blocks, one for
+ *   packet snip descriptors and three for data of increasing size (see
+ *   @ref CONFIG_GNRC_PKTBUF_SLAB_HDR_SIZE and following). Allocating and
+ *   releasing takes constant time and the buffer can not fragment, at the
+ *   cost of the space left unused in each block. gnrc_pktbuf_mark() never
+ *   copies.
+ * - `gnrc_pktbuf_malloc` uses the system's `malloc()`.
+ *
  * @{
  *
  * @file
@@ -63,6 +75,67 @@ extern "C" {
 #ifndef CONFIG_GNRC_PKTBUF_SIZE
 #define CONFIG_GNRC_PKTBUF_SIZE    (6144)
 #endif
+
+/**
+ * @brief   Number of packet snip descriptors in the packet buffer of
+ *          `gnrc_pktbuf_slab`
+ */
+#ifndef CONFIG_GNRC_PKTBUF_SLAB_SNIP_NUMOF
+#define CONFIG_GNRC_PKTBUF_SLAB_SNIP_NUMOF      (48)
+#endif
+
+/**
+ * @brief   Size of the smallest data blocks of `gnrc_pktbuf_slab`
+ *
+ * Sized to fit the @ref gnrc_netif_hdr_t of a received packet including its
+ * addresses or a fixed-size header such as the IPv6 header.
+ */
+#ifndef CONFIG_GNRC_PKTBUF_SLAB_HDR_SIZE
+#define CONFIG_GNRC_PKTBUF_SLAB_HDR_SIZE        (48)
+#endif
+
+/**
+ * @brief   Number of blocks of @ref CONFIG_GNRC_PKTBUF_SLAB_HDR_SIZE bytes
+ */
+#ifndef CONFIG_GNRC_PKTBUF_SLAB_HDR_NUMOF
+#define CONFIG_GNRC_PKTBUF_SLAB_HDR_NUMOF       (24)
+#endif
+
+/**
+ * @brief   Size of the data blocks of `gnrc_pktbuf_slab` for small payloads
+ *
+ * Sized to fit a full IEEE 802.15.4 frame.
+ */
+#ifndef CONFIG_GNRC_PKTBUF_SLAB_SMALL_SIZE
+#define CONFIG_GNRC_PKTBUF_SLAB_SMALL_SIZE      (128)
+#endif
+
+/**
+ * @brief   Number of blocks of @ref CONFIG_GNRC_PKTBUF_SLAB_SMALL_SIZE bytes
+ */
+#ifndef CONFIG_GNRC_PKTBUF_SLAB_SMALL_NUMOF
+#define CONFIG_GNRC_PKTBUF_SLAB_SMALL_NUMOF     (16)
+#endif
+
+/**
+ * @brief   Size of the largest data blocks of `gnrc_pktbuf_slab`
+ *
+ * This is the maximum size of a single allocation. Sized to fit a full-MTU
+ * IPv6 packet or an Ethernet frame.
+ */
+#ifndef CONFIG_GNRC_PKTBUF_SLAB_MTU_SIZE
+#define CONFIG_GNRC_PKTBUF_SLAB_MTU_SIZE        (1536)
+#endif
+
+/**
+ * @brief   Number of blocks of @ref CONFIG_GNRC_PKTBUF_SLAB_MTU_SIZE bytes
+ *
+ * As for @ref CONFIG_GNRC_PKTBUF_SIZE, this leaves room for 2 incoming and 2
+ * outgoing full-MTU packets.
+ */
+#ifndef CONFIG_GNRC_PKTBUF_SLAB_MTU_NUMOF
+#define CONFIG_GNRC_PKTBUF_SLAB_MTU_NUMOF       (4)
+#endif
 /** @} */
 
 /**
@@ -129,6 +202,22 @@ gnrc_pktsnip_t *gnrc_pktbuf_add(gnrc_pktsnip_t *next, const void *data, size_t s
  */
 gnrc_pktsnip_t *gnrc_pktbuf_mark(gnrc_pktsnip_t *pkt, size_t size, gnrc_nettype_t type);
 
+/**
+ * @brief   Gets the number of bytes to put in front of a header so it can be
+ *          marked without moving the data behind it.
+ *
+ * Depending on the packet buffer implementation, gnrc_pktbuf_mark() may need
+ * to copy the remainder of the packet if the marked size does not meet its
+ * alignment. A receive path that knows the length of the first header
+ * beforehand can write the received frame `pad` bytes into the snip and mark
+ * `pad + hdr_len` bytes instead, so the data behind the header stays in place.
+ *
+ * @param[in] hdr_len   Length of the header to mark.
+ *
+ * @return  Number of padding bytes to put in front of the header.
+ */
+size_t gnrc_pktbuf_mark_pad(size_t hdr_len);
+
 /**
  * @brief   Reallocates gnrc_pktsnip_t::data of @p pkt in the packet buffer, without
  *          changing the content.
@@ -57,6 +57,24 @@ extern "C" {
 #define CONFIG_GNRC_SIXLOWPAN_MSG_QUEUE_SIZE_EXP   (3U)
 #endif
 
+/**
+ * @brief   Number of flows compressed and decompressed IPv6 headers are
+ *          cached for
+ *
+ * For a flow, i.e. the same interface, link-layer addresses and IPv6 header
+ * apart from the payload length, IPHC always yields the same compressed
+ * header. The last @ref CONFIG_GNRC_SIXLOWPAN_IPHC_CACHE_SIZE flows sent and
+ * received are remembered, so their headers are copied instead of looking up
+ * contexts and interface identifiers again. Each entry takes about 110 bytes
+ * for either direction. 0 disables the cache.
+ *
+ * @note    Only applicable with
+ *          [gnrc_sixlowpan_iphc](@ref net_gnrc_sixlowpan_iphc) module
+ */
+#ifndef CONFIG_GNRC_SIXLOWPAN_IPHC_CACHE_SIZE
+#define CONFIG_GNRC_SIXLOWPAN_IPHC_CACHE_SIZE      (0U)
+#endif
+
 /**
  * @brief   Number of datagrams that can be fragmented simultaneously
  *
@@ -74,6 +92,24 @@ extern "C" {
 #endif  /* defined(MODULE_GNRC_SIXLOWPAN_FRAG_SFR) */
 #endif
 
+/**
+ * @brief   Maximum number of fragments handed to the network interface with
+ *          a single message
+ *
+ * The fragments of a datagram are created in trains of up to this many
+ * fragments which are passed to the interface with one
+ * @ref GNRC_NETAPI_MSG_TYPE_SND_BATCH message, so the interface thread sends
+ * them in one wakeup. A train takes up to this many link-layer frames in the
+ * packet buffer at once. Set to 1 to hand out every fragment with its own
+ * @ref GNRC_NETAPI_MSG_TYPE_SND message.
+ *
+ * @note    Only applicable with
+ *          [gnrc_sixlowpan_frag](@ref net_gnrc_sixlowpan_frag) module
+ */
+#ifndef CONFIG_GNRC_SIXLOWPAN_FRAG_TX_BATCH
+#define CONFIG_GNRC_SIXLOWPAN_FRAG_TX_BATCH        (4U)
+#endif
+
 /**
  * @brief   Size of the reassembly buffer
  *
@@ -125,6 +161,47 @@ extern "C" {
 #define CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_DEL_TIMER              (0U)
 #endif
 
+/**
+ * @brief   Number of hash buckets to index the reassembly buffer with
+ *
+ * @note    Only applicable with
+ *          [gnrc_sixlowpan_frag_rb](@ref net_gnrc_sixlowpan_frag_rb) module
+ *
+ * Reassembly buffer entries are hashed by their link-layer source and
+ * destination address and their datagram tag, so the entry for an incoming
+ * fragment is found without comparing it to every other entry. Costs
+ * `CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_BUCKETS + 2 * CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE`
+ * bytes of RAM. With 1 the reassembly buffer is searched linearly. Must be
+ * lesser than 256, as must be @ref CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE if
+ * larger than 1.
+ */
+#ifndef CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_BUCKETS
+#define CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_BUCKETS                (1U)
+#endif
+
+/**
+ * @brief   Track received fragments in a bitmap per reassembly buffer entry
+ *
+ * @note    Only applicable with
+ *          [gnrc_sixlowpan_frag_rb](@ref net_gnrc_sixlowpan_frag_rb) module
+ *          and without the
+ *          [gnrc_sixlowpan_frag_vrb](@ref net_gnrc_sixlowpan_frag_vrb) module.
+ *          The virtual reassembly buffer takes over the fragment intervals of
+ *          reassembly buffer entries, so with it the fragment intervals are
+ *          always used.
+ *
+ * When set, each reassembly buffer entry marks the received 8-octet units of
+ * its datagram and the units fragments start at in two bitmaps of
+ * `2 * (`@ref SIXLOWPAN_FRAG_MAX_LEN` + 1) / 8` bits in total instead of
+ * allocating gnrc_sixlowpan_frag_rb_int_t entries from a shared pool.
+ * Overlapping and duplicate fragments are detected with a granularity of 8
+ * octets, which is exact for fragments following
+ * [RFC 4944](https://tools.ietf.org/html/rfc4944#section-5.3).
+ */
+#ifdef DOXYGEN
+#define CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_BITMAP
+#endif
+
 /**
  * @brief   Registration lifetime in minutes for the address registration option
  *
@@ -118,14 +118,23 @@ gnrc_sixlowpan_ctx_t *gnrc_sixlowpan_ctx_update(uint8_t id, const ipv6_addr_t *p
 /**
  * @brief   Removes context.
  *
+ * @note    Can be called from interrupt context.
+ *
  * @param[in] id    A context ID.
  */
-static inline void gnrc_sixlowpan_ctx_remove(uint8_t id)
-{
-    if (IS_USED(MODULE_GNRC_SIXLOWPAN_CTX)) {
-        gnrc_sixlowpan_ctx_lookup_id(id)->prefix_len = 0;
-    }
-}
+void gnrc_sixlowpan_ctx_remove(uint8_t id);
+
+/**
+ * @brief   Gets the generation of the context buffer
+ *
+ * The generation changes whenever a context is added or removed or its prefix
+ * or flags are updated. Users caching the results of context lookups can
+ * compare it to tell if their results are still valid. Contexts that expire
+ * only lose @ref GNRC_SIXLOWPAN_CTX_FLAGS_COMP, which is not reflected.
+ *
+ * @return  The current generation of the context buffer.
+ */
+uint32_t gnrc_sixlowpan_ctx_generation(void);
 
 /**
  * @brief   Check if a prefix matches a compression context
@@ -25,8 +25,10 @@
 #include <stdalign.h>
 
 #include "architecture.h"
+#include "bitfield.h"
 #include "net/gnrc/netif/hdr.h"
 #include "net/gnrc/pkt.h"
+#include "net/sixlowpan.h"
 #ifdef MODULE_GNRC_SIXLOWPAN_FRAG_SFR
 #include "net/sixlowpan/sfr.h"
 #endif  /* MODULE_GNRC_SIXLOWPAN_FRAG_SFR */
@@ -41,6 +43,21 @@ extern "C" {
  */
 #define GNRC_SIXLOWPAN_FRAG_RB_GC_MSG       (0x0226)
 
+/**
+ * @brief   Reassembly buffer entries track received fragments in a bitmap
+ *
+ * @see     @ref CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_BITMAP
+ */
+#define GNRC_SIXLOWPAN_FRAG_RB_BITMAP \
+    (IS_ACTIVE(CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_BITMAP) && \
+     !IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_VRB))
+
+/**
+ * @brief   Number of 8-octet units of the largest datagram that can be
+ *          fragmented
+ */
+#define GNRC_SIXLOWPAN_FRAG_RB_UNITS        ((SIXLOWPAN_FRAG_MAX_LEN + 1) / 8)
+
 /**
  * @brief   Fragment intervals to identify limits of fragments and duplicates.
  *
@@ -113,6 +130,21 @@ typedef struct {
     int8_t offset_diff;                         /**< offset change due to
                                                  *   recompression */
 #endif /* IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_SFR) */
+#if GNRC_SIXLOWPAN_FRAG_RB_BITMAP || defined(DOXYGEN)
+    /**
+     * @brief   Received 8-octet units of the datagram
+     *
+     * @note    Only available with @ref GNRC_SIXLOWPAN_FRAG_RB_BITMAP.
+     *          gnrc_sixlowpan_frag_rb_base_t::ints is unused then.
+     */
+    BITFIELD(units, GNRC_SIXLOWPAN_FRAG_RB_UNITS);
+    /**
+     * @brief   8-octet units of the datagram a received fragment starts at
+     *
+     * @note    Only available with @ref GNRC_SIXLOWPAN_FRAG_RB_BITMAP.
+     */
+    BITFIELD(starts, GNRC_SIXLOWPAN_FRAG_RB_UNITS);
+#endif /* GNRC_SIXLOWPAN_FRAG_RB_BITMAP */
 } gnrc_sixlowpan_frag_rb_t;
 
 /**
@@ -55,6 +55,19 @@ void gnrc_sixlowpan_dispatch_recv(gnrc_pktsnip_t *pkt, void *context,
 void gnrc_sixlowpan_dispatch_send(gnrc_pktsnip_t *pkt, void *context,
                                   unsigned page);
 
+/**
+ * @brief   Delegates a batch of packets to the network interface with a
+ *          single message
+ *
+ * All packets must be sent over the same interface. The interface is taken
+ * from the first packet.
+ *
+ * @param[in] pkts      Packets
+ * @param[in] numof     Number of packets in @p pkts, must be > 0
+ */
+void gnrc_sixlowpan_dispatch_send_batch(gnrc_pktsnip_t *const *pkts,
+                                        unsigned numof);
+
 /**
  * @brief   Checks if packet fits over interface (and fragments if @ref
  *          net_gnrc_sixlowpan_frag is available and required)
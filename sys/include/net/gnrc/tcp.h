@@ -23,8 +23,10 @@
 #define NET_GNRC_TCP_H
 
 #include <stdint.h>
+#include "kernel_defines.h"
 #include "net/gnrc/pkt.h"
 #include "net/gnrc/tcp/tcb.h"
+#include "net/gnrc/tcp/netstats.h"
 
 #ifdef SOCK_HAS_IPV6
 #include "net/sock.h"
@@ -214,6 +216,9 @@ int gnrc_tcp_accept(gnrc_tcp_tcb_queue_t *queue, gnrc_tcp_tcb_t **tcb,
  * @pre @p data must not be NULL.
  *
  * @note Blocks until up to @p len bytes were transmitted or an error occurred.
+ *       Up to @ref CONFIG_GNRC_TCP_SND_QUEUE_SIZE segments are sent before
+ *       waiting for their acknowledgment. If the user timeout expires, segments
+ *       that were not acknowledged yet are no longer retransmitted.
  *
  * @param[in,out] tcb                        TCB holding the connection information.
  * @param[in]     data                       Pointer to the data that should be transmitted.
@@ -367,6 +372,17 @@ int gnrc_tcp_calc_csum(const gnrc_pktsnip_t *hdr, const gnrc_pktsnip_t *pseudo_h
  */
 gnrc_pktsnip_t *gnrc_tcp_hdr_build(gnrc_pktsnip_t *payload, uint16_t src, uint16_t dst);
 
+#if IS_USED(MODULE_NETSTATS_TCP) || DOXYGEN
+/**
+ * @brief Statistics on TCP operations
+ *
+ * @note Only available with module `netstats_tcp`. The counters are updated
+ *       with IRQs disabled, disable IRQs while reading them for consistent
+ *       values.
+ */
+extern netstats_tcp_t gnrc_tcp_netstats;
+#endif
+
 #ifdef __cplusplus
 }
 #endif
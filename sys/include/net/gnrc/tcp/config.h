@@ -20,6 +20,8 @@
 #ifndef NET_GNRC_TCP_CONFIG_H
 #define NET_GNRC_TCP_CONFIG_H
 
+#include <assert.h>
+
 #include "timex.h"
 
 #ifdef __cplusplus
@@ -108,6 +110,65 @@ extern "C" {
 #define GNRC_TCP_RCV_BUF_SIZE (CONFIG_GNRC_TCP_DEFAULT_WINDOW)
 #endif
 
+/**
+ * @brief Maximum number of unacknowledged segments in flight
+ *
+ * Sent segments are kept in the packet buffer until they were acknowledged by
+ * the peer. Larger values allow a higher throughput on links with a large
+ * bandwidth-delay product at the cost of packet buffer space.
+ */
+#ifndef CONFIG_GNRC_TCP_SND_QUEUE_SIZE
+#define CONFIG_GNRC_TCP_SND_QUEUE_SIZE (2U)
+#endif
+
+static_assert(CONFIG_GNRC_TCP_SND_QUEUE_SIZE <= 32,
+              "CONFIG_GNRC_TCP_SND_QUEUE_SIZE exceeds the 32 bit SACK bitmap");
+
+/**
+ * @brief Number of duplicate acknowledgments triggering a fast retransmit
+ *        (see RFC 5681)
+ *
+ * @note At most @ref CONFIG_GNRC_TCP_SND_QUEUE_SIZE - 1 duplicate
+ *       acknowledgments can arrive for the segments in flight. A larger
+ *       threshold is lowered to that number.
+ */
+#ifndef CONFIG_GNRC_TCP_DUP_ACK_THRESHOLD
+#define CONFIG_GNRC_TCP_DUP_ACK_THRESHOLD (3U)
+#endif
+
+/**
+ * @brief Enable selective acknowledgments (SACK, see RFC 2018). Disabled by default.
+ *
+ * @note If enabled, the SACK-permitted option is negotiated on connection setup.
+ *       SACK blocks received from the peer are used to retransmit only the lost
+ *       segments after duplicate acknowledgments.
+ */
+#ifndef CONFIG_GNRC_TCP_SACK_EN
+#define CONFIG_GNRC_TCP_SACK_EN 0
+#endif
+
+/**
+ * @brief Maximum number of segments received out of order that are kept until
+ *        the missing data arrived
+ *
+ * Segments are only kept if they fit into the receive window. Queued segments
+ * occupy packet buffer space until they are merged into the receive buffer.
+ */
+#ifndef CONFIG_GNRC_TCP_RCV_OOO_SIZE
+#define CONFIG_GNRC_TCP_RCV_OOO_SIZE (2U)
+#endif
+
+/**
+ * @brief Maximum time in milliseconds an acknowledgment is delayed
+ *        (see RFC 1122). Zero acknowledges every segment immediately.
+ *
+ * @note Every second segment and every segment received out of
+ *       order is acknowledged immediately.
+ */
+#ifndef CONFIG_GNRC_TCP_DELAYED_ACK_MS
+#define CONFIG_GNRC_TCP_DELAYED_ACK_MS (40U)
+#endif
+
 /**
  * @brief Lower bound for RTO in milliseconds. Default is 1 sec (see RFC 6298)
  *
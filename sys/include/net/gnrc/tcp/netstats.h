@@ -0,0 +1,56 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    net_netstats_tcp Packet statistics for TCP
+ * @ingroup     net_netstats
+ * @brief       Packet statistics for GNRC TCP
+ * @{
+ *
+ * @file
+ * @brief       Definition of TCP related packet statistics
+ */
+
+#ifndef NET_GNRC_TCP_NETSTATS_H
+#define NET_GNRC_TCP_NETSTATS_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief       TCP statistics struct
+ */
+typedef struct {
+    uint32_t rx_ooo_count;              /**< segments received out of order
+                                             and queued */
+    uint32_t rx_ooo_merged;             /**< queued segments merged into the
+                                             receive buffer after the missing
+                                             data arrived, each one saved a
+                                             retransmission */
+    uint32_t rx_ooo_dropped;            /**< segments received out of order
+                                             that could not be queued */
+    uint32_t tx_ack_count;              /**< segments sent without data,
+                                             mostly pure acknowledgments */
+    uint32_t tx_ack_coalesced;          /**< delayed acknowledgments covered
+                                             by a later segment */
+    uint32_t tx_retransmit_count;       /**< segments retransmitted after the
+                                             retransmission timer expired */
+    uint32_t tx_fast_retransmit_count;  /**< segments retransmitted after
+                                             duplicate or partial
+                                             acknowledgments */
+} netstats_tcp_t;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NET_GNRC_TCP_NETSTATS_H */
+/** @} */
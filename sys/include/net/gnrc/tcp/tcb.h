@@ -55,6 +55,9 @@ typedef struct sock_tcp {
     uint32_t snd_una;      /**< Send unacknowledged */
     uint32_t snd_nxt;      /**< Send next */
     uint16_t snd_wnd;      /**< Send window */
+    uint32_t snd_cwnd;     /**< Congestion window */
+    uint32_t snd_ssthresh; /**< Slow start threshold */
+    uint32_t snd_recover;  /**< Send next at the time loss recovery started */
     uint32_t snd_wl1;      /**< SeqNo. from last window update */
     uint32_t snd_wl2;      /**< AckNo. from last window update */
     uint32_t rcv_nxt;      /**< Receive next */
@@ -63,14 +66,25 @@ typedef struct sock_tcp {
     uint32_t irs;          /**< Initial received sequence number */
     uint16_t mss;          /**< The peers MSS */
     uint32_t rtt_start;    /**< Timer value for rtt estimation */
+    uint32_t rtt_seq;      /**< Sequence number acknowledging the segment used for rtt estimation */
     int32_t rtt_var;       /**< Round trip time variance */
     int32_t srtt;          /**< Smoothed round trip time */
     int32_t rto;           /**< Retransmission timeout duration */
     uint8_t retries;       /**< Number of retransmissions */
+    uint8_t dup_acks;      /**< Number of duplicate acknowledgments received in a row */
     evtimer_msg_event_t event_retransmit; /**< Retransmission event */
     evtimer_msg_event_t event_timeout;    /**< Timeout event */
+    evtimer_msg_event_t event_ack;        /**< Delayed acknowledgment event */
     evtimer_mbox_event_t event_misc;      /**< General purpose event */
-    gnrc_pktsnip_t *pkt_retransmit;       /**< Pointer to packet in "retransmit queue" */
+    gnrc_pktsnip_t *pkt_retransmit[CONFIG_GNRC_TCP_SND_QUEUE_SIZE]; /**< Packets in "retransmit queue",
+                                                                         ordered by sequence number */
+    uint8_t pkt_retransmit_numof; /**< Number of packets in "retransmit queue" */
+    uint32_t pkt_sacked;     /**< Bitmap of packets in "retransmit queue" covered by SACK blocks */
+    gnrc_pktsnip_t *pkt_ooo[CONFIG_GNRC_TCP_RCV_OOO_SIZE]; /**< Segments received out of order,
+                                                                ordered by sequence number */
+    uint8_t pkt_ooo_numof;   /**< Number of segments received out of order */
+    uint32_t pkt_ooo_last;   /**< Sequence number of the last segment received out of order */
+    uint8_t ack_pending;     /**< Flag: Acknowledgment of received data is delayed */
     mbox_t *mbox;            /**< TCB mbox for synchronization */
     uint8_t *rcv_buf_raw;    /**< Pointer to the receive buffer */
     ringbuffer_t rcv_buf;    /**< Receive buffer data structure */
@@ -55,6 +55,15 @@ extern "C" {
 #define CONFIG_NANOCOAP_CACHE_RESPONSE_SIZE    (128)
 #endif
 
+/**
+ * @brief The number of buckets of the hash table to look up cache entries.
+ *
+ * Cache keys are digests, so their first bytes are used as hash value.
+ */
+#ifndef CONFIG_NANOCOAP_CACHE_BUCKETS
+#define CONFIG_NANOCOAP_CACHE_BUCKETS          (CONFIG_NANOCOAP_CACHE_ENTRIES)
+#endif
+
 /**
  * @brief   Cache container that holds a @p coap_pkt_t struct.
  */
@@ -93,6 +102,15 @@ typedef struct {
     uint32_t max_age;
 } nanocoap_cache_entry_t;
 
+/**
+ * @brief   Cache statistics
+ */
+typedef struct {
+    uint32_t hits;          /**< lookups that found an entry */
+    uint32_t misses;        /**< lookups that did not find an entry */
+    uint32_t evictions;     /**< entries replaced to make room for another */
+} nanocoap_cache_stats_t;
+
 /**
  * @brief Typedef for the cache replacement strategy on full cache list.
  *
@@ -137,6 +155,16 @@ size_t nanocoap_cache_used_count(void);
  */
 size_t nanocoap_cache_free_count(void);
 
+/**
+ * @brief   Returns the cache statistics since nanocoap_cache_init().
+ *
+ * Only lookups with nanocoap_cache_key_lookup() and
+ * nanocoap_cache_request_lookup() are counted.
+ *
+ * @param[out] stats    The statistics
+ */
+void nanocoap_cache_stats_get(nanocoap_cache_stats_t *stats);
+
 /**
  * @brief   Determines if a response is cacheable and modifies the cache
  *          as reflected in RFC7252, Section 5.9.
@@ -67,6 +67,22 @@
  *   If you want to support ``PUT`` and `DELETE`, you need to enable the modules
  *   ``nanocoap_fileserver_put`` and ``nanocoap_fileserver_delete``.
  *
+ * # Block-wise downloads
+ *
+ * By default, every Block2 request resolves the path of the file, computes its
+ * ETag and opens, seeks and closes the file. With the module
+ * ``nanocoap_fileserver_cache``, the file of a download is kept open between
+ * the Block2 requests of a client, together with its ETag and size. A request
+ * for the next block is then served by a single read into the response
+ * payload. Blocks are only read when requested, they are not prefetched.
+ * Files are closed once the last block was sent, after
+ * @ref CONFIG_NANOCOAP_FILESERVER_CACHE_TIMEOUT_MS without further requests,
+ * or on any ``PUT`` or ``DELETE`` request handled by the file server.
+ *
+ * @note With ``nanocoap_fileserver_cache``, modifications of a file that are
+ *       not done through the file server are not noticed by an ongoing
+ *       download. Also, the mount point of an open file can not be unmounted.
+ *
  * @{
  *
  * @file
@@ -84,6 +100,31 @@ extern "C" {
 
 #include "net/nanocoap.h"
 
+/**
+ * @defgroup net_nanocoap_fileserver_conf  CoAP file server compile configurations
+ * @ingroup  net_nanocoap_conf
+ * @{
+ */
+/**
+ * @brief   Number of downloads for which the file is kept open
+ *
+ * Requires the `nanocoap_fileserver_cache` module.
+ */
+#ifndef CONFIG_NANOCOAP_FILESERVER_CACHE_NUMOF
+#define CONFIG_NANOCOAP_FILESERVER_CACHE_NUMOF      (1)
+#endif
+
+/**
+ * @brief   Time in milliseconds after which the file of a download without
+ *          further Block2 requests is closed
+ *
+ * Requires the `nanocoap_fileserver_cache` module.
+ */
+#ifndef CONFIG_NANOCOAP_FILESERVER_CACHE_TIMEOUT_MS
+#define CONFIG_NANOCOAP_FILESERVER_CACHE_TIMEOUT_MS (10000)
+#endif
+/** @} */
+
 /**
  * @brief   Randomly generated Etag, used by a client when a directory should only be
  *          deleted, if it is empty
@@ -0,0 +1,209 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    sys_schedprofile Scheduler profiler
+ * @ingroup     sys
+ * @brief       Per-thread CPU and scheduling latency profiler
+ *
+ * When this module is used, the following is recorded for every thread on
+ * each @ref sched_run():
+ *
+ * - the number of times the thread was scheduled and its total runtime,
+ * - the longest time the thread ran without being unscheduled (run slice),
+ * - how often the thread was preempted, i.e. unscheduled while still
+ *   runnable (this includes @ref thread_yield),
+ * - the latency from the thread becoming runnable to it being scheduled as a
+ *   histogram and as maximum, separately for wakeups from thread context and
+ *   from interrupt context (IRQ-to-thread latency).
+ *
+ * Bucket `0` of a latency histogram counts latencies below 1 µs, bucket `i`
+ * counts latencies from 2^(i-1) µs to below 2^i µs. The last bucket also counts
+ * all longer latencies. Histogram counters saturate at `UINT16_MAX`.
+ *
+ * The profile is printed by the `schedprofile` shell command. For processing
+ * on a host @ref schedprofile_export dumps it in a compact binary format,
+ * all values in little endian:
+ *
+ * | Offset | Size | Content                                               |
+ * |-------:|-----:|:------------------------------------------------------|
+ * |      0 |    2 | magic `"SP"`                                          |
+ * |      2 |    1 | format version (@ref SCHEDPROFILE_EXPORT_VERSION)     |
+ * |      3 |    1 | number of histogram buckets `n`                       |
+ *
+ * followed by a record for each thread that was scheduled at least once, the
+ * number of records follows from the size of the dump:
+ *
+ * | Offset | Size | Content                                               |
+ * |-------:|-----:|:------------------------------------------------------|
+ * |      0 |    1 | PID                                                   |
+ * |      1 |    4 | number of schedules                                   |
+ * |      5 |    8 | runtime in µs                                         |
+ * |     13 |    4 | longest run slice in µs                               |
+ * |     17 |    4 | preemptions                                           |
+ * |     21 |    4 | maximum latency after a wakeup from a thread in µs    |
+ * |     25 |    4 | maximum latency after a wakeup from an IRQ in µs      |
+ * |     29 |  2n | latency histogram of wakeups from a thread            |
+ * |  29+2n |  2n | latency histogram of wakeups from an IRQ              |
+ *
+ * If both this module and @ref schedstatistics are used, @ref schedstatistics
+ * is still updated.
+ *
+ * @note        If auto_init is disabled `init_schedprofile()` needs to be
+ *              called after ztimer was initialized.
+ * @{
+ *
+ * @file
+ * @brief       Scheduler profiler definitions
+ */
+
+#ifndef SCHEDPROFILE_H
+#define SCHEDPROFILE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "sched.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Number of buckets of a latency histogram
+ *
+ * With the default of 16 buckets the last bucket counts latencies of 16.384 ms
+ * and longer.
+ */
+#ifndef CONFIG_SCHEDPROFILE_HIST_SIZE
+#define CONFIG_SCHEDPROFILE_HIST_SIZE   (16U)
+#endif
+
+/**
+ * @brief   Version of the binary format written by @ref schedprofile_export
+ */
+#define SCHEDPROFILE_EXPORT_VERSION     (1U)
+
+/**
+ * @brief   Size of the header of the binary format
+ */
+#define SCHEDPROFILE_EXPORT_HDR_SIZE    (4U)
+
+/**
+ * @brief   Size of a thread record of the binary format
+ */
+#define SCHEDPROFILE_EXPORT_REC_SIZE    (29U + \
+                                         4U * CONFIG_SCHEDPROFILE_HIST_SIZE)
+
+/**
+ * @brief   Wakeup sources a latency is recorded for
+ */
+typedef enum {
+    SCHEDPROFILE_WAKEUP_THREAD = 0,     /**< woken up from thread context */
+    SCHEDPROFILE_WAKEUP_IRQ,            /**< woken up from interrupt context */
+    SCHEDPROFILE_WAKEUP_NUMOF,          /**< number of wakeup sources */
+} schedprofile_wakeup_t;
+
+/**
+ * @brief   Profile of a thread
+ */
+typedef struct {
+    uint32_t laststart;         /**< Time stamp of the last time this thread
+                                     was scheduled to run */
+    uint32_t wakeup;            /**< Time stamp of the last time this thread
+                                     became runnable */
+    uint32_t schedules;         /**< How often the thread was scheduled */
+    uint64_t runtime_us;        /**< Total runtime in microseconds */
+    uint32_t max_slice_us;      /**< Longest run slice in microseconds */
+    uint32_t preemptions;       /**< How often the thread was unscheduled while
+                                     still runnable */
+    /**
+     * @brief   Maximum wakeup latency per wakeup source in microseconds
+     */
+    uint32_t max_latency_us[SCHEDPROFILE_WAKEUP_NUMOF];
+    /**
+     * @brief   Wakeup latency histograms per wakeup source
+     */
+    uint16_t latency[SCHEDPROFILE_WAKEUP_NUMOF][CONFIG_SCHEDPROFILE_HIST_SIZE];
+    uint8_t pending;            /**< Wakeup source + 1 of a wakeup not yet
+                                     followed by a schedule, 0 if none */
+} schedprofile_t;
+
+/**
+ * @brief   Profiles of all threads, indexed by PID
+ *
+ * When core_idle_thread is not used, the entry of KERNEL_PID_UNDEF is used to
+ * track the idle time.
+ *
+ * @warning Disable interrupts while reading an entry to get a consistent view.
+ */
+extern schedprofile_t schedprofile_pidlist[KERNEL_PID_LAST + 1];
+
+/**
+ * @brief   Registers the profiler and starts profiling
+ */
+void init_schedprofile(void);
+
+/**
+ * @brief   Clears the profiles of all threads
+ */
+void schedprofile_reset(void);
+
+/**
+ * @brief   Get the lower bound of a latency histogram bucket
+ *
+ * @param[in] bucket    index of the bucket
+ *
+ * @return  smallest latency in microseconds counted in @p bucket
+ */
+static inline uint32_t schedprofile_bucket_min(unsigned bucket)
+{
+    return (bucket == 0) ? 0 : (1UL << (bucket - 1));
+}
+
+/**
+ * @brief   Write the header of the binary format
+ *
+ * @param[out] buf      buffer of at least @ref SCHEDPROFILE_EXPORT_HDR_SIZE
+ *                      bytes
+ */
+void schedprofile_export_hdr(void *buf);
+
+/**
+ * @brief   Write the record of a thread in binary format
+ *
+ * @param[in] pid       PID of the thread
+ * @param[out] buf      buffer of at least @ref SCHEDPROFILE_EXPORT_REC_SIZE
+ *                      bytes
+ *
+ * @return  true, if the record was written
+ * @return  false, if @p pid was never scheduled
+ */
+bool schedprofile_export_rec(kernel_pid_t pid, void *buf);
+
+/**
+ * @brief   Dump the profiles of all threads in binary format
+ *
+ * Only complete thread records are written, records of threads that do not
+ * fit into @p buf are dropped.
+ *
+ * @param[out] buf      buffer to write to
+ * @param[in] len       size of @p buf
+ *
+ * @return  number of bytes written
+ * @return  0 if @p buf cannot even hold the header
+ */
+size_t schedprofile_export(void *buf, size_t len);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SCHEDPROFILE_H */
+/** @} */
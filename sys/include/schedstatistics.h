@@ -31,6 +31,8 @@
 
 #include <stdint.h>
 
+#include "sched.h"
+
 #ifdef __cplusplus
  extern "C" {
 #endif
@@ -56,6 +58,15 @@ extern schedstat_t sched_pidlist[KERNEL_PID_LAST + 1];
  */
 void init_schedstatistics(void);
 
+/**
+ *  @brief  Scheduler callback updating the statistics, registered by
+ *          @ref init_schedstatistics
+ *
+ *  @param[in] active_thread    Pid of the active thread
+ *  @param[in] next_thread      Pid of the next scheduled thread
+ */
+void sched_statistics_cb(kernel_pid_t active_thread, kernel_pid_t next_thread);
+
 #ifdef __cplusplus
 }
 #endif
@@ -61,6 +61,7 @@
 #include "sched.h"
 #include "clist.h"
 #include "iolist.h"
+#include "list.h"
 #include "macros/utils.h"
 #include "mtd.h"
 #ifdef MODULE_NANOCOAP_FS
@@ -302,6 +303,32 @@ extern "C" {
 #define VFS_NAME_MAX (31)
 #endif
 
+/**
+ * @defgroup sys_vfs_buffered_config VFS file buffer configuration
+ * @ingroup  config
+ * @brief    Configuration of the @ref pseudomodule_vfs_buffered module
+ * @{
+ */
+#ifndef CONFIG_VFS_BUFFERED_NUMOF
+/**
+ * @brief Number of file buffers
+ *
+ * Files opened with @ref vfs_open get a buffer assigned as long as one is
+ * available, further files are accessed unbuffered.
+ */
+#define CONFIG_VFS_BUFFERED_NUMOF (2)
+#endif
+
+#ifndef CONFIG_VFS_BUFFERED_SIZE
+/**
+ * @brief Size of a file buffer in bytes
+ *
+ * Reads and writes of at least this size bypass the buffer.
+ */
+#define CONFIG_VFS_BUFFERED_SIZE (64)
+#endif
+/** @} */
+
 /**
  * @brief Used with vfs_bind to bind to any available fd number
  */
@@ -384,6 +411,7 @@ typedef struct {
  */
 struct vfs_mount_struct {
     clist_node_t list_entry;     /**< List entry for the _vfs_mount_list list */
+    list_node_t index_entry;     /**< Entry in the mount index, sorted by mount_point_len */
     const vfs_file_system_t *fs; /**< The file system driver for the mount point */
     const char *mount_point;     /**< Mount point, e.g. "/mnt/cdrom" */
     size_t mount_point_len;      /**< Length of mount_point string (set by vfs_mount) */
@@ -897,6 +925,8 @@ ssize_t vfs_write_iol(int fd, const iolist_t *iolist);
  * @brief Synchronize a file on storage
  *        Any pending writes are written out to storage.
  *
+ * This includes data held back by the @ref pseudomodule_vfs_buffered module.
+ *
  * @param[in]  fd       fd number obtained from vfs_open
  *
  * @return 0 on success
@@ -1195,6 +1225,32 @@ const vfs_mount_t *vfs_iterate_mounts(const vfs_mount_t *cur);
  */
 bool vfs_iterate_mount_dirs(vfs_DIR *dir);
 
+/**
+ * @brief Statistics of the @ref pseudomodule_vfs_buffered module
+ *
+ * The difference between the calls to the VFS and the calls to the file system
+ * driver is the number of driver calls saved by buffering.
+ */
+typedef struct {
+    uint32_t reads;         /**< Reads of buffered files, one per byte in vfs_readline */
+    uint32_t driver_reads;  /**< Resulting read calls of the file system driver */
+    uint32_t writes;        /**< Writes to buffered files */
+    uint32_t driver_writes; /**< Resulting write calls of the file system driver */
+} vfs_buffered_stats_t;
+
+/**
+ * @brief Get the statistics of the @ref pseudomodule_vfs_buffered module
+ *
+ * @param[out] stats    Statistics since boot or the last call of
+ *                      @ref vfs_buffered_stats_reset
+ */
+void vfs_buffered_stats(vfs_buffered_stats_t *stats);
+
+/**
+ * @brief Reset the statistics of the @ref pseudomodule_vfs_buffered module
+ */
+void vfs_buffered_stats_reset(void);
+
 /**
  * @brief   Get information about the file for internal purposes
  *
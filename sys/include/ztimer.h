@@ -157,6 +157,16 @@
  * to be shown whether the increased complexity would lead to better
  * performance for any reasonable amount of active timers.
  *
+ * For clocks that have to handle many concurrent timeouts, the module
+ * `ztimer_wheel` adds a hierarchical timer wheel in front of the list (see
+ * @ref ztimer_wheel_init()). Only timers that are due within the current
+ * 2^@ref ZTIMER_WHEEL_NEAR_BITS tick window are kept in the list, all others
+ * are put into a slot of the wheel in constant time and are moved towards the
+ * list by a single internal timer whenever the start of a non-empty slot is
+ * reached. With `ztimer_wheel`, ZTIMER_MSEC uses a timer wheel by default.
+ * Each timer object gains a "previous" pointer, so timers are also removed
+ * from the wheel in constant time.
+ *
  *
  * ## Clock extension
  *
@@ -299,6 +309,10 @@ typedef void (*ztimer_callback_t)(void *arg);
 struct ztimer_base {
     ztimer_base_t *next;        /**< next timer in list */
     uint32_t offset;            /**< offset from last timer in list */
+#if MODULE_ZTIMER_WHEEL || DOXYGEN
+    ztimer_base_t *prev;        /**< previous timer in timer wheel slot,
+                                     NULL if not in a timer wheel       */
+#endif
 };
 
 /**
@@ -335,6 +349,50 @@ typedef struct {
     void *arg;                      /**< timer callback argument */
 } ztimer_t;
 
+#if MODULE_ZTIMER_WHEEL || DOXYGEN
+/**
+ * @brief   log2 of the number of ticks that are kept in a clock's sorted
+ *          timer list instead of the timer wheel
+ */
+#define ZTIMER_WHEEL_NEAR_BITS  (4U)
+
+/**
+ * @brief   log2 of the number of slots per timer wheel level
+ */
+#define ZTIMER_WHEEL_SLOT_BITS  (4U)
+
+/**
+ * @brief   Number of slots per timer wheel level
+ */
+#define ZTIMER_WHEEL_SLOTS      (1U << ZTIMER_WHEEL_SLOT_BITS)
+
+/**
+ * @brief   Number of timer wheel levels needed to cover 32 bit
+ */
+#define ZTIMER_WHEEL_LEVELS     ((32U - ZTIMER_WHEEL_NEAR_BITS + \
+                                  ZTIMER_WHEEL_SLOT_BITS - 1) / \
+                                 ZTIMER_WHEEL_SLOT_BITS)
+
+/**
+ * @brief   Hierarchical timer wheel of a clock
+ *
+ * Level `l` of the wheel sorts timers into slots of
+ * 2^(@ref ZTIMER_WHEEL_NEAR_BITS + `l` * @ref ZTIMER_WHEEL_SLOT_BITS) ticks.
+ * Timers are moved to lower levels and finally to the clock's list once the
+ * start of their slot is reached.
+ *
+ * @see ztimer_wheel_init()
+ */
+typedef struct {
+    ztimer_t timer;                 /**< fires at the start of the next
+                                         non-empty slot                     */
+    ztimer_base_t *slots[ZTIMER_WHEEL_LEVELS][ZTIMER_WHEEL_SLOTS]; /**< slots */
+    uint16_t pending[ZTIMER_WHEEL_LEVELS]; /**< bitmap of non-empty slots   */
+    uint32_t now;                   /**< time the slots are relative to     */
+    uint32_t next;                  /**< time ztimer_wheel_t::timer is set to */
+} ztimer_wheel_t;
+#endif
+
 /**
  * @brief   ztimer backend method structure
  *
@@ -403,6 +461,9 @@ struct ztimer_clock {
     uint8_t block_pm_mode;          /**< min. pm mode to block for the clock to run
                                          don't use in combination with ztimer_ondemand! */
 #endif
+#if MODULE_ZTIMER_WHEEL || DOXYGEN
+    ztimer_wheel_t *wheel;          /**< timer wheel for far timers, may be NULL */
+#endif
 };
 
 /**
@@ -820,6 +881,22 @@ int ztimer_rmutex_lock_timeout(ztimer_clock_t *clock, rmutex_t *rmutex,
  */
 void ztimer_init(void);
 
+#if MODULE_ZTIMER_WHEEL || DOXYGEN
+/**
+ * @brief   Attach a timer wheel to a clock
+ *
+ * Afterwards, ztimer_set() and ztimer_remove() are constant time operations
+ * for all timers on @p clock that are not due within the next
+ * 2^@ref ZTIMER_WHEEL_NEAR_BITS ticks.
+ *
+ * @pre No timer is set on @p clock.
+ *
+ * @param[in]   clock       ztimer clock to operate on
+ * @param[out]  wheel       timer wheel to use for @p clock
+ */
+void ztimer_wheel_init(ztimer_clock_t *clock, ztimer_wheel_t *wheel);
+#endif
+
 #if defined(MODULE_ZTIMER_EXTEND) || defined(DOXYGEN)
 /**
  * @brief   Initialize possible ztimer extension intermediate timer
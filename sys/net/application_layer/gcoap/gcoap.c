@@ -148,6 +148,156 @@ static uint8_t _listen_buf[CONFIG_GCOAP_PDU_BUF_SIZE];
 static sock_udp_t _sock_udp;
 static event_callback_t _receive_from_cache;
 
+#if IS_ACTIVE(CONFIG_GCOAP_MEMO_HASH)
+/* Chained hash index over the slots of one of the arrays in _coap_state.
+ * A slot is only unlinked when it is linked again, so freed slots may remain
+ * in a chain and every slot found has to be verified. */
+typedef struct {
+    uint16_t *heads;        /* first slot + 1 of each bucket, 0 if empty */
+    uint16_t *next;         /* next slot + 1 in the same bucket, 0 at end */
+    uint16_t *bucket;       /* bucket + 1 the slot is linked into, 0 if none */
+    uint16_t numof;         /* number of slots, also number of buckets */
+} _slot_idx_t;
+
+#define _SLOT_IDX_DEFINE(name, numof)                                   \
+    static uint16_t name ## _heads[numof];                              \
+    static uint16_t name ## _next[numof];                               \
+    static uint16_t name ## _bucket[numof];                             \
+    static _slot_idx_t name = {                                         \
+        name ## _heads, name ## _next, name ## _bucket, numof           \
+    }
+
+_SLOT_IDX_DEFINE(_reqs_by_mid, CONFIG_GCOAP_REQ_WAITING_MAX);
+_SLOT_IDX_DEFINE(_reqs_by_token, CONFIG_GCOAP_REQ_WAITING_MAX);
+_SLOT_IDX_DEFINE(_observers_by_ep, CONFIG_GCOAP_OBS_CLIENTS_MAX);
+_SLOT_IDX_DEFINE(_obs_memos_by_token, CONFIG_GCOAP_OBS_REGISTRATIONS_MAX);
+_SLOT_IDX_DEFINE(_obs_memos_by_resource, CONFIG_GCOAP_OBS_REGISTRATIONS_MAX);
+
+static_assert((CONFIG_GCOAP_REQ_WAITING_MAX < UINT16_MAX) &&
+              (CONFIG_GCOAP_OBS_CLIENTS_MAX < UINT16_MAX) &&
+              (CONFIG_GCOAP_OBS_REGISTRATIONS_MAX < UINT16_MAX),
+              "too many gcoap memos for CONFIG_GCOAP_MEMO_HASH");
+
+static void _slot_idx_reset(_slot_idx_t *idx)
+{
+    memset(idx->heads, 0, idx->numof * sizeof(idx->heads[0]));
+    memset(idx->next, 0, idx->numof * sizeof(idx->next[0]));
+    memset(idx->bucket, 0, idx->numof * sizeof(idx->bucket[0]));
+}
+
+static void _slot_idx_unlink(_slot_idx_t *idx, unsigned slot)
+{
+    uint16_t *ptr;
+
+    if (idx->bucket[slot] == 0) {
+        return;
+    }
+    for (ptr = &idx->heads[idx->bucket[slot] - 1]; *ptr != (slot + 1);
+         ptr = &idx->next[*ptr - 1]) {}
+    *ptr = idx->next[slot];
+    idx->bucket[slot] = 0;
+}
+
+static void _slot_idx_link(_slot_idx_t *idx, unsigned slot, uint32_t hash)
+{
+    unsigned bucket = hash % idx->numof;
+
+    _slot_idx_unlink(idx, slot);
+    idx->next[slot] = idx->heads[bucket];
+    idx->heads[bucket] = slot + 1;
+    idx->bucket[slot] = bucket + 1;
+}
+
+/* returns the first slot of the bucket for hash, or -1 */
+static inline int _slot_idx_first(const _slot_idx_t *idx, uint32_t hash)
+{
+    return (int)idx->heads[hash % idx->numof] - 1;
+}
+
+/* returns the slot following slot in its bucket, or -1 */
+static inline int _slot_idx_next(const _slot_idx_t *idx, int slot)
+{
+    return (int)idx->next[slot] - 1;
+}
+
+/* FNV-1a */
+static uint32_t _hash_bytes(uint32_t hash, const void *buf, size_t len)
+{
+    const uint8_t *bytes = buf;
+
+    for (size_t i = 0; i < len; i++) {
+        hash = (hash ^ bytes[i]) * 16777619U;
+    }
+    return hash;
+}
+
+static inline uint32_t _hash_token(const uint8_t *token, size_t tkl)
+{
+    return _hash_bytes(2166136261U, token, tkl);
+}
+
+static uint32_t _hash_ep(const sock_udp_ep_t *ep)
+{
+    uint32_t hash = _hash_bytes(2166136261U, &ep->port, sizeof(ep->port));
+
+    /* only hash what sock_udp_ep_equal() compares */
+    switch (ep->family) {
+#ifdef SOCK_HAS_IPV4
+    case AF_INET:
+        return _hash_bytes(hash, ep->addr.ipv4, sizeof(ep->addr.ipv4));
+#endif
+#ifdef SOCK_HAS_IPV6
+    case AF_INET6:
+        return _hash_bytes(hash, ep->addr.ipv6, sizeof(ep->addr.ipv6));
+#endif
+    default:
+        return hash;
+    }
+}
+
+static inline uint32_t _hash_resource(const coap_resource_t *resource)
+{
+    return (uintptr_t)resource / sizeof(*resource);
+}
+
+/* indexes an open request memo, once its header and remote are set */
+static void _req_memo_index(gcoap_request_memo_t *memo)
+{
+    unsigned slot = memo - _coap_state.open_reqs;
+    /* no need to initialize struct; we only care about buffer contents below */
+    coap_pkt_t memo_pdu;
+
+    memo_pdu.hdr = gcoap_request_memo_get_hdr(memo);
+
+    _slot_idx_link(&_reqs_by_mid, slot, memo_pdu.hdr->id);
+    _slot_idx_link(&_reqs_by_token, slot,
+                   _hash_token(coap_get_token(&memo_pdu),
+                               coap_get_token_len(&memo_pdu)));
+}
+
+/* indexes an observer, once its endpoint is set */
+static void _observer_index(sock_udp_ep_t *observer)
+{
+    _slot_idx_link(&_observers_by_ep, observer - _coap_state.observers,
+                   _hash_ep(observer));
+}
+
+/* indexes an observe memo, once its token and resource are set */
+static void _obs_memo_index(gcoap_observe_memo_t *memo)
+{
+    unsigned slot = memo - _coap_state.observe_memos;
+
+    _slot_idx_link(&_obs_memos_by_token, slot,
+                   _hash_token(memo->token, memo->token_len));
+    _slot_idx_link(&_obs_memos_by_resource, slot,
+                   _hash_resource(memo->resource));
+}
+#else   /* CONFIG_GCOAP_MEMO_HASH */
+#define _req_memo_index(memo)       (void)memo
+#define _observer_index(observer)   (void)observer
+#define _obs_memo_index(memo)       (void)memo
+#endif  /* CONFIG_GCOAP_MEMO_HASH */
+
 #if IS_USED(MODULE_GCOAP_DTLS)
 /* DTLS variables and definitions */
 #define SOCK_DTLS_CLIENT_TAG (2)
@@ -705,6 +855,7 @@ static size_t _handle_req(gcoap_socket_t *sock, coap_pkt_t *pdu, uint8_t *buf,
                     if (obs_slot >= 0) {
                         observer = &_coap_state.observers[obs_slot];
                         memcpy(observer, remote, sizeof(sock_udp_ep_t));
+                        _observer_index(observer);
                     } else {
                         DEBUG("gcoap: can't register observer\n");
                     }
@@ -728,6 +879,7 @@ static size_t _handle_req(gcoap_socket_t *sock, coap_pkt_t *pdu, uint8_t *buf,
             if (memo->token_len) {
                 memcpy(&memo->token[0], coap_get_token(pdu), memo->token_len);
             }
+            _obs_memo_index(memo);
             DEBUG("gcoap: Registered observer for: %s\n", memo->resource->path);
         }
 
@@ -885,32 +1037,53 @@ static int _find_resource(gcoap_socket_type_t tl_type,
  *
  * return         Registered request memo, or NULL if not found
  */
-static gcoap_request_memo_t* _find_req_memo_by_token(const sock_udp_ep_t *remote,
-                                            const uint8_t *token, size_t tkl)
+static inline bool _req_memo_matches_token(gcoap_request_memo_t *memo,
+                                           const sock_udp_ep_t *remote,
+                                           const uint8_t *token, size_t tkl)
 {
     /* no need to initialize struct; we only care about buffer contents below */
     coap_pkt_t memo_pdu_data;
     coap_pkt_t *memo_pdu = &memo_pdu_data;
 
-    for (int i = 0; i < CONFIG_GCOAP_REQ_WAITING_MAX; i++) {
-        if (_coap_state.open_reqs[i].state == GCOAP_MEMO_UNUSED) {
-            continue;
-        }
+    if (memo->state == GCOAP_MEMO_UNUSED) {
+        return false;
+    }
+    memo_pdu->hdr = gcoap_request_memo_get_hdr(memo);
+
+    return (coap_get_token_len(memo_pdu) == tkl) &&
+           (memcmp(token, coap_get_token(memo_pdu), tkl) == 0) &&
+           (sock_udp_ep_equal(&memo->remote_ep, remote)
+            /* Multicast addresses are not considered in matching responses */
+            || sock_udp_ep_is_multicast(&memo->remote_ep));
+}
+
+static gcoap_request_memo_t* _find_req_memo_by_token(const sock_udp_ep_t *remote,
+                                            const uint8_t *token, size_t tkl)
+{
+#if IS_ACTIVE(CONFIG_GCOAP_MEMO_HASH)
+    gcoap_request_memo_t *res = NULL;
 
+    for (int i = _slot_idx_first(&_reqs_by_token, _hash_token(token, tkl));
+         i >= 0; i = _slot_idx_next(&_reqs_by_token, i)) {
         gcoap_request_memo_t *memo = &_coap_state.open_reqs[i];
-        memo_pdu->hdr = gcoap_request_memo_get_hdr(memo);
-
-        if (coap_get_token_len(memo_pdu) == tkl) {
-            if ((memcmp(token, coap_get_token(memo_pdu), tkl) == 0)
-                    && (sock_udp_ep_equal(&memo->remote_ep, remote)
-                      /* Multicast addresses are not considered in matching responses */
-                      || sock_udp_ep_is_multicast(&memo->remote_ep)
-                    )) {
-                return memo;
-            }
+
+        /* first match in open_reqs wins as with a linear search */
+        if (_req_memo_matches_token(memo, remote, token, tkl) &&
+            ((res == NULL) || (memo < res))) {
+            res = memo;
+        }
+    }
+    return res;
+#else
+    for (int i = 0; i < CONFIG_GCOAP_REQ_WAITING_MAX; i++) {
+        gcoap_request_memo_t *memo = &_coap_state.open_reqs[i];
+
+        if (_req_memo_matches_token(memo, remote, token, tkl)) {
+            return memo;
         }
     }
     return NULL;
+#endif
 }
 
 /*
@@ -941,21 +1114,40 @@ static gcoap_request_memo_t* _find_req_memo_by_pdu_token(
  *
  * return         Registered request memo, or NULL if not found
  */
+static inline bool _req_memo_matches_mid(gcoap_request_memo_t *memo,
+                                         const sock_udp_ep_t *remote,
+                                         uint16_t mid)
+{
+    return (memo->state != GCOAP_MEMO_UNUSED) &&
+           (mid == gcoap_request_memo_get_hdr(memo)->id) &&
+           sock_udp_ep_equal(&memo->remote_ep, remote);
+}
+
 static gcoap_request_memo_t* _find_req_memo_by_mid(const sock_udp_ep_t *remote, uint16_t mid)
 {
-    for (int i = 0; i < CONFIG_GCOAP_REQ_WAITING_MAX; i++) {
-        if (_coap_state.open_reqs[i].state == GCOAP_MEMO_UNUSED) {
-            continue;
-        }
+#if IS_ACTIVE(CONFIG_GCOAP_MEMO_HASH)
+    gcoap_request_memo_t *res = NULL;
 
+    for (int i = _slot_idx_first(&_reqs_by_mid, mid); i >= 0;
+         i = _slot_idx_next(&_reqs_by_mid, i)) {
         gcoap_request_memo_t *memo = &_coap_state.open_reqs[i];
 
-        if ((mid == gcoap_request_memo_get_hdr(memo)->id) &&
-            sock_udp_ep_equal(&memo->remote_ep, remote)) {
+        if (_req_memo_matches_mid(memo, remote, mid) &&
+            ((res == NULL) || (memo < res))) {
+            res = memo;
+        }
+    }
+    return res;
+#else
+    for (int i = 0; i < CONFIG_GCOAP_REQ_WAITING_MAX; i++) {
+        gcoap_request_memo_t *memo = &_coap_state.open_reqs[i];
+
+        if (_req_memo_matches_mid(memo, remote, mid)) {
             return memo;
         }
     }
     return NULL;
+#endif
 }
 
 /* Calls handler callback on receipt of a timeout message. */
@@ -1014,6 +1206,27 @@ static int _find_observer(sock_udp_ep_t **observer, sock_udp_ep_t *remote)
 {
     int empty_slot = -1;
     *observer      = NULL;
+#if IS_ACTIVE(CONFIG_GCOAP_MEMO_HASH)
+    for (int i = _slot_idx_first(&_observers_by_ep, _hash_ep(remote)); i >= 0;
+         i = _slot_idx_next(&_observers_by_ep, i)) {
+        sock_udp_ep_t *ep = &_coap_state.observers[i];
+
+        if ((ep->family != AF_UNSPEC) && sock_udp_ep_equal(ep, remote) &&
+            ((*observer == NULL) || (ep < *observer))) {
+            *observer = ep;
+        }
+    }
+    if (*observer != NULL) {
+        return empty_slot;
+    }
+    /* only an unknown remote needs an empty slot, the last one is used as
+     * with a linear search */
+    for (int i = CONFIG_GCOAP_OBS_CLIENTS_MAX - 1; i >= 0; i--) {
+        if (_coap_state.observers[i].family == AF_UNSPEC) {
+            return i;
+        }
+    }
+#else
     for (unsigned i = 0; i < CONFIG_GCOAP_OBS_CLIENTS_MAX; i++) {
 
         if (_coap_state.observers[i].family == AF_UNSPEC) {
@@ -1024,6 +1237,7 @@ static int _find_observer(sock_udp_ep_t **observer, sock_udp_ep_t *remote)
             break;
         }
     }
+#endif
     return empty_slot;
 }
 
@@ -1046,6 +1260,36 @@ static int _find_obs_memo(gcoap_observe_memo_t **memo, sock_udp_ep_t *remote,
     sock_udp_ep_t *remote_observer = NULL;
     _find_observer(&remote_observer, remote);
 
+#if IS_ACTIVE(CONFIG_GCOAP_MEMO_HASH)
+    /* matching only on remote is rare, so only the token is indexed */
+    if (pdu != NULL) {
+        unsigned tkl = coap_get_token_len(pdu);
+        uint8_t *token = coap_get_token(pdu);
+
+        /* memos without token or observer never match */
+        for (int i = _slot_idx_first(&_obs_memos_by_token, _hash_token(token, tkl));
+             (i >= 0) && (tkl > 0) && (remote_observer != NULL);
+             i = _slot_idx_next(&_obs_memos_by_token, i)) {
+            gcoap_observe_memo_t *obs_memo = &_coap_state.observe_memos[i];
+
+            if ((obs_memo->observer == remote_observer) &&
+                (obs_memo->token_len == tkl) &&
+                (memcmp(obs_memo->token, token, tkl) == 0) &&
+                ((*memo == NULL) || (obs_memo < *memo))) {
+                *memo = obs_memo;
+            }
+        }
+        if (*memo != NULL) {
+            return empty_slot;
+        }
+        for (int i = CONFIG_GCOAP_OBS_REGISTRATIONS_MAX - 1; i >= 0; i--) {
+            if (_coap_state.observe_memos[i].observer == NULL) {
+                return i;
+            }
+        }
+        return empty_slot;
+    }
+#endif
     for (unsigned i = 0; i < CONFIG_GCOAP_OBS_REGISTRATIONS_MAX; i++) {
         if (_coap_state.observe_memos[i].observer == NULL) {
             empty_slot = i;
@@ -1126,6 +1370,17 @@ static void _find_obs_memo_resource(gcoap_observe_memo_t **memo,
                                    const coap_resource_t *resource)
 {
     *memo = NULL;
+#if IS_ACTIVE(CONFIG_GCOAP_MEMO_HASH)
+    for (int i = _slot_idx_first(&_obs_memos_by_resource, _hash_resource(resource));
+         i >= 0; i = _slot_idx_next(&_obs_memos_by_resource, i)) {
+        gcoap_observe_memo_t *obs_memo = &_coap_state.observe_memos[i];
+
+        if ((obs_memo->observer != NULL) && (obs_memo->resource == resource) &&
+            ((*memo == NULL) || (obs_memo < *memo))) {
+            *memo = obs_memo;
+        }
+    }
+#else
     for (int i = 0; i < CONFIG_GCOAP_OBS_REGISTRATIONS_MAX; i++) {
         if (_coap_state.observe_memos[i].observer != NULL
                 && _coap_state.observe_memos[i].resource == resource) {
@@ -1133,6 +1388,7 @@ static void _find_obs_memo_resource(gcoap_observe_memo_t **memo,
             break;
         }
     }
+#endif
 }
 
 /*
@@ -1504,6 +1760,13 @@ kernel_pid_t gcoap_init(void)
     memset(&_coap_state.observers[0], 0, sizeof(_coap_state.observers));
     memset(&_coap_state.observe_memos[0], 0, sizeof(_coap_state.observe_memos));
     memset(&_coap_state.resend_bufs[0], 0, sizeof(_coap_state.resend_bufs));
+#if IS_ACTIVE(CONFIG_GCOAP_MEMO_HASH)
+    _slot_idx_reset(&_reqs_by_mid);
+    _slot_idx_reset(&_reqs_by_token);
+    _slot_idx_reset(&_observers_by_ep);
+    _slot_idx_reset(&_obs_memos_by_token);
+    _slot_idx_reset(&_obs_memos_by_resource);
+#endif
     /* randomize initial value */
     atomic_init(&_coap_state.next_message_id, (unsigned)random_uint32());
 
@@ -1699,6 +1962,9 @@ ssize_t gcoap_req_send(const uint8_t *buf, size_t len,
             DEBUG("gcoap: illegal msg type %u\n", msg_type);
             break;
         }
+        if (memo->state != GCOAP_MEMO_UNUSED) {
+            _req_memo_index(memo);
+        }
         mutex_unlock(&_coap_state.lock);
         if (memo->state == GCOAP_MEMO_UNUSED) {
             return 0;
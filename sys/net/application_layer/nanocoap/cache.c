@@ -18,6 +18,7 @@
  * @}
  */
 
+#include <assert.h>
 #include <string.h>
 
 #include "kernel_defines.h"
@@ -27,36 +28,135 @@
 #define ENABLE_DEBUG 0
 #include "debug.h"
 
+/* marks the end of a list of entry indices */
+#define _NIL    (UINT16_MAX)
+
+static_assert(CONFIG_NANOCOAP_CACHE_ENTRIES < _NIL,
+              "CONFIG_NANOCOAP_CACHE_ENTRIES too large");
+static_assert(CONFIG_NANOCOAP_CACHE_BUCKETS > 0,
+              "CONFIG_NANOCOAP_CACHE_BUCKETS must not be 0");
+
+/**
+ * @brief   Bookkeeping of a cache entry, indices into _cache_entries
+ */
+typedef struct {
+    uint16_t prev;      /**< next less recently used entry */
+    uint16_t next;      /**< next more recently used entry */
+    uint16_t chain;     /**< next entry in the same bucket */
+    bool used;          /**< entry is in the cache */
+} _cache_link_t;
+
 static int _cache_replacement_lru(void);
 static int _cache_update_lru(clist_node_t *node);
 
-static clist_node_t _cache_list_head = { NULL };
 static clist_node_t _empty_list_head = { NULL };
 
 static nanocoap_cache_entry_t _cache_entries[CONFIG_NANOCOAP_CACHE_ENTRIES];
+static _cache_link_t _cache_links[CONFIG_NANOCOAP_CACHE_ENTRIES];
+static uint16_t _cache_buckets[CONFIG_NANOCOAP_CACHE_BUCKETS];
+/* least and most recently used entries */
+static uint16_t _lru = _NIL;
+static uint16_t _mru = _NIL;
+static size_t _used_count;
+static nanocoap_cache_stats_t _stats;
 
 static const nanocoap_cache_replacement_strategy_t _replacement_strategy = _cache_replacement_lru;
 static const nanocoap_cache_update_strategy_t _update_strategy = _cache_update_lru;
 
+static unsigned _bucket(const uint8_t *cache_key)
+{
+    uint32_t hash = 0;
+
+    /* the cache key is a digest, its first bytes are as good as any hash */
+    for (unsigned i = 0; i < MIN(sizeof(hash), CONFIG_NANOCOAP_CACHE_KEY_LENGTH); i++) {
+        hash = (hash << 8) | cache_key[i];
+    }
+    return hash % CONFIG_NANOCOAP_CACHE_BUCKETS;
+}
+
+static void _lru_remove(uint16_t idx)
+{
+    _cache_link_t *link = &_cache_links[idx];
+
+    if (link->prev == _NIL) {
+        _lru = link->next;
+    }
+    else {
+        _cache_links[link->prev].next = link->next;
+    }
+    if (link->next == _NIL) {
+        _mru = link->prev;
+    }
+    else {
+        _cache_links[link->next].prev = link->prev;
+    }
+}
+
+static void _lru_append(uint16_t idx)
+{
+    _cache_link_t *link = &_cache_links[idx];
+
+    link->prev = _mru;
+    link->next = _NIL;
+    if (_mru == _NIL) {
+        _lru = idx;
+    }
+    else {
+        _cache_links[_mru].next = idx;
+    }
+    _mru = idx;
+}
+
+static void _hash_insert(uint16_t idx)
+{
+    uint16_t *bucket = &_cache_buckets[_bucket(_cache_entries[idx].cache_key)];
+
+    _cache_links[idx].chain = *bucket;
+    *bucket = idx;
+}
+
+static void _hash_remove(uint16_t idx)
+{
+    uint16_t *pos = &_cache_buckets[_bucket(_cache_entries[idx].cache_key)];
+
+    while (*pos != idx) {
+        assert(*pos != _NIL);
+        pos = &_cache_links[*pos].chain;
+    }
+    *pos = _cache_links[idx].chain;
+}
+
 static int _cache_replacement_lru(void)
 {
-    clist_node_t *lru_node = clist_lpeek(&_cache_list_head);
+    uint32_t now = ztimer_now(ZTIMER_SEC);
+    uint16_t victim = _lru;
 
     /* no element in the list */
-    if (!lru_node) {
+    if (victim == _NIL) {
         return -1;
     }
 
-    nanocoap_cache_entry_t *lru_ce = container_of(lru_node, nanocoap_cache_entry_t, node);
-    return nanocoap_cache_del(lru_ce);
+    /* prefer the least recently used entry that is not fresh anymore */
+    for (uint16_t idx = _lru; idx != _NIL; idx = _cache_links[idx].next) {
+        if (nanocoap_cache_entry_is_stale(&_cache_entries[idx], now)) {
+            victim = idx;
+            break;
+        }
+    }
+    _stats.evictions++;
+    return nanocoap_cache_del(&_cache_entries[victim]);
 }
 
 static int _cache_update_lru(clist_node_t *node)
 {
-    if (clist_remove(&_cache_list_head, node)) {
+    nanocoap_cache_entry_t *ce = container_of(node, nanocoap_cache_entry_t, node);
+    uint16_t idx = ce - _cache_entries;
+
+    if (_cache_links[idx].used) {
         /* Move an accessed node to the end of the list. Least
          * recently used nodes are at the beginning of this list */
-        clist_rpush(&_cache_list_head, node);
+        _lru_remove(idx);
+        _lru_append(idx);
         return 0;
     }
     return -1;
@@ -64,9 +164,16 @@ static int _cache_update_lru(clist_node_t *node)
 
 void nanocoap_cache_init(void)
 {
-    _cache_list_head.next = NULL;
     _empty_list_head.next = NULL;
+    _lru = _NIL;
+    _mru = _NIL;
+    _used_count = 0;
+    memset(&_stats, 0, sizeof(_stats));
     memset(_cache_entries, 0, sizeof(_cache_entries));
+    memset(_cache_links, 0, sizeof(_cache_links));
+    for (unsigned i = 0; i < CONFIG_NANOCOAP_CACHE_BUCKETS; i++) {
+        _cache_buckets[i] = _NIL;
+    }
     /* construct list of empty entries */
     for (unsigned i = 0; i < CONFIG_NANOCOAP_CACHE_ENTRIES; i++) {
         clist_rpush(&_empty_list_head, &_cache_entries[i].node);
@@ -75,12 +182,17 @@ void nanocoap_cache_init(void)
 
 size_t nanocoap_cache_used_count(void)
 {
-    return clist_count(&_cache_list_head);
+    return _used_count;
 }
 
 size_t nanocoap_cache_free_count(void)
 {
-    return clist_count(&_empty_list_head);
+    return CONFIG_NANOCOAP_CACHE_ENTRIES - _used_count;
+}
+
+void nanocoap_cache_stats_get(nanocoap_cache_stats_t *stats)
+{
+    *stats = _stats;
 }
 
 static void _cache_key_digest_opts(const coap_pkt_t *req, sha256_context_t *ctx,
@@ -154,31 +266,33 @@ ssize_t nanocoap_cache_key_compare(uint8_t *cache_key1, uint8_t *cache_key2)
     return memcmp(cache_key1, cache_key2, CONFIG_NANOCOAP_CACHE_KEY_LENGTH);
 }
 
-static int _compare_cache_keys(clist_node_t *ce, void *arg)
+static nanocoap_cache_entry_t *_lookup(const uint8_t *key)
 {
-    nanocoap_cache_entry_t *iterator = container_of(ce, nanocoap_cache_entry_t, node);
-    uint8_t *cache_key = (uint8_t *) arg;
+    uint16_t idx = _cache_buckets[_bucket(key)];
 
-    if (!memcmp(iterator->cache_key, cache_key, CONFIG_NANOCOAP_CACHE_KEY_LENGTH)) {
-        return 1;
-    }
-    return 0;
-}
+    while (idx != _NIL) {
+        nanocoap_cache_entry_t *ce = &_cache_entries[idx];
 
-static clist_node_t *_nanocoap_cache_foreach(const uint8_t *key)
-{
-    return clist_foreach(&_cache_list_head, _compare_cache_keys, (uint8_t *)key);
+        if (!memcmp(ce->cache_key, key, CONFIG_NANOCOAP_CACHE_KEY_LENGTH)) {
+            _update_strategy(&ce->node);
+            return ce;
+        }
+        idx = _cache_links[idx].chain;
+    }
+    return NULL;
 }
 
 nanocoap_cache_entry_t *nanocoap_cache_key_lookup(const uint8_t *key)
 {
-    clist_node_t *node = _nanocoap_cache_foreach(key);
+    nanocoap_cache_entry_t *ce = _lookup(key);
 
-    if (node) {
-        _update_strategy(node);
+    if (ce) {
+        _stats.hits++;
     }
-
-    return container_of(node, nanocoap_cache_entry_t, node);
+    else {
+        _stats.misses++;
+    }
+    return ce;
 }
 
 nanocoap_cache_entry_t *nanocoap_cache_request_lookup(const coap_pkt_t *req)
@@ -199,7 +313,7 @@ nanocoap_cache_entry_t *nanocoap_cache_process(const uint8_t *cache_key, unsigne
                                                const coap_pkt_t *resp, size_t resp_len)
 {
     nanocoap_cache_entry_t *ce;
-    ce = nanocoap_cache_key_lookup(cache_key);
+    ce = _lookup(cache_key);
 
     /* This response is not cacheable. */
     if (resp->hdr->code == COAP_CODE_CREATED) {
@@ -277,7 +391,7 @@ nanocoap_cache_entry_t *nanocoap_cache_add_by_key(const uint8_t *cache_key,
                                                   const coap_pkt_t *resp,
                                                   size_t resp_len)
 {
-    nanocoap_cache_entry_t *ce = nanocoap_cache_key_lookup(cache_key);
+    nanocoap_cache_entry_t *ce = _lookup(cache_key);
     bool add_to_cache = false;
 
     if (resp_len > CONFIG_NANOCOAP_CACHE_RESPONSE_SIZE) {
@@ -321,7 +435,12 @@ nanocoap_cache_entry_t *nanocoap_cache_add_by_key(const uint8_t *cache_key,
     ce->max_age = ztimer_now(ZTIMER_SEC) + max_age;
 
     if (add_to_cache) {
-        clist_rpush(&_cache_list_head, &ce->node);
+        uint16_t idx = ce - _cache_entries;
+
+        _cache_links[idx].used = true;
+        _hash_insert(idx);
+        _lru_append(idx);
+        _used_count++;
     }
 
     return ce;
@@ -344,12 +463,20 @@ nanocoap_cache_entry_t *nanocoap_cache_add_by_req(const coap_pkt_t *req,
 
 int nanocoap_cache_del(const nanocoap_cache_entry_t *ce)
 {
-    clist_node_t *entry = clist_find(&_cache_list_head, &ce->node);
+    if ((ce < _cache_entries) ||
+        (ce >= &_cache_entries[CONFIG_NANOCOAP_CACHE_ENTRIES])) {
+        return -1;
+    }
+
+    uint16_t idx = ce - _cache_entries;
 
-    if (entry) {
-        clist_remove(&_cache_list_head, entry);
-        memset(entry, 0, sizeof(nanocoap_cache_entry_t));
-        clist_rpush(&_empty_list_head, entry);
+    if (_cache_links[idx].used) {
+        _hash_remove(idx);
+        _lru_remove(idx);
+        _cache_links[idx].used = false;
+        _used_count--;
+        memset(&_cache_entries[idx], 0, sizeof(nanocoap_cache_entry_t));
+        clist_rpush(&_empty_list_head, &_cache_entries[idx].node);
         return 0;
     }
 
@@ -23,10 +23,16 @@
 
 #include "kernel_defines.h"
 #include "checksum/fletcher32.h"
+#include "mutex.h"
 #include "net/nanocoap/fileserver.h"
 #include "vfs.h"
 #include "vfs_util.h"
 
+#if IS_USED(MODULE_NANOCOAP_FILESERVER_CACHE)
+#include "net/sock/util.h"
+#include "ztimer.h"
+#endif
+
 #define ENABLE_DEBUG 0
 #include "debug.h"
 
@@ -70,8 +76,37 @@ struct requestdata {
     /** 0-terminated expanded file name in the VFS */
     char namebuf[COAPFILESERVER_PATH_MAX];
     struct requestoptions options;
+    /** Remote endpoint of the request, may be NULL */
+    const sock_udp_ep_t *remote;
+};
+
+#if IS_USED(MODULE_NANOCOAP_FILESERVER_CACHE)
+/**
+ * @brief   File kept open between the Block2 requests of a download
+ */
+struct cached_file {
+    char path[COAPFILESERVER_PATH_MAX]; /**< VFS path of the file */
+    sock_udp_ep_t remote;               /**< Client downloading the file */
+    bool has_remote;                    /**< remote is valid */
+    bool in_use;                        /**< Entry holds an open file */
+    int fd;                             /**< Open file */
+    uint32_t etag;                      /**< Etag of the file when it was opened */
+    uint32_t size;                      /**< Size of the file when it was opened */
+    uint32_t pos;                       /**< Position of fd, start of the next block */
+    uint32_t last_used;                 /**< Time of the last request in ms */
 };
 
+/**
+ * @brief   Files of ongoing downloads
+ */
+static struct cached_file _cache[CONFIG_NANOCOAP_FILESERVER_CACHE_NUMOF];
+
+/**
+ * @brief   Protects _cache from concurrent access
+ */
+static mutex_t _cache_mtx = MUTEX_INIT;
+#endif
+
 /**
  * @brief  Return true if path/name is a directory.
  */
@@ -201,14 +236,139 @@ static inline void _event_file(nanocoap_fileserver_event_t event, struct request
     }
 }
 
-static ssize_t _get_file(coap_pkt_t *pdu, uint8_t *buf, size_t len,
-                         struct requestdata *request)
+#if IS_USED(MODULE_NANOCOAP_FILESERVER_CACHE)
+static void _cache_close(struct cached_file *entry)
 {
-    int err;
-    uint32_t etag, size_total;
+    vfs_close(entry->fd);
+    entry->in_use = false;
+}
+#endif
+
+/** Find the file of an ongoing download of @p request and get its open fd,
+ * ETag, size and position, closing all files of downloads that timed out */
+static struct cached_file *_cache_find(const struct requestdata *request, int *fd,
+                                       uint32_t *etag, uint32_t *size, uint32_t *pos)
+{
+#if IS_USED(MODULE_NANOCOAP_FILESERVER_CACHE)
+    struct cached_file *found = NULL;
+    uint32_t now = ztimer_now(ZTIMER_MSEC);
+
+    for (unsigned i = 0; i < ARRAY_SIZE(_cache); i++) {
+        struct cached_file *entry = &_cache[i];
+        if (!entry->in_use) {
+            continue;
+        }
+        if (now - entry->last_used > CONFIG_NANOCOAP_FILESERVER_CACHE_TIMEOUT_MS) {
+            DEBUG("nanocoap_fileserver: download of %s timed out\n", entry->path);
+            _cache_close(entry);
+            continue;
+        }
+        if (strcmp(entry->path, request->namebuf) ||
+            (entry->has_remote != (request->remote != NULL)) ||
+            (entry->has_remote && !sock_udp_ep_equal(&entry->remote, request->remote))) {
+            continue;
+        }
+        *fd = entry->fd;
+        *etag = entry->etag;
+        *size = entry->size;
+        *pos = entry->pos;
+        found = entry;
+    }
+    return found;
+#else
+    (void)request;
+    (void)fd;
+    (void)etag;
+    (void)size;
+    (void)pos;
+    return NULL;
+#endif
+}
+
+/** Keep @p fd open for the next block of the download, or close it if the
+ * download is complete */
+static void _cache_update(struct cached_file *entry, const struct requestdata *request,
+                          int fd, uint32_t etag, uint32_t size, uint32_t pos, bool more)
+{
+#if IS_USED(MODULE_NANOCOAP_FILESERVER_CACHE)
+    if (!more) {
+        if (entry) {
+            _cache_close(entry);
+        }
+        else {
+            vfs_close(fd);
+        }
+        return;
+    }
+    if (entry == NULL) {
+        /* use a free entry or replace the least recently used one */
+        entry = &_cache[0];
+        for (unsigned i = 0; i < ARRAY_SIZE(_cache) && entry->in_use; i++) {
+            if (!_cache[i].in_use || (_cache[i].last_used < entry->last_used)) {
+                entry = &_cache[i];
+            }
+        }
+        if (entry->in_use) {
+            _cache_close(entry);
+        }
+        strcpy(entry->path, request->namebuf);
+        entry->has_remote = request->remote != NULL;
+        if (entry->has_remote) {
+            entry->remote = *request->remote;
+        }
+        entry->in_use = true;
+        entry->fd = fd;
+        entry->etag = etag;
+        entry->size = size;
+    }
+    entry->pos = pos;
+    entry->last_used = ztimer_now(ZTIMER_MSEC);
+#else
+    (void)entry;
+    (void)request;
+    (void)etag;
+    (void)size;
+    (void)pos;
+    (void)more;
+    vfs_close(fd);
+#endif
+}
+
+/** Close all files kept open for downloads, e.g. because they are modified */
+static inline void _cache_clear(void)
+{
+#if IS_USED(MODULE_NANOCOAP_FILESERVER_CACHE)
+    mutex_lock(&_cache_mtx);
+    for (unsigned i = 0; i < ARRAY_SIZE(_cache); i++) {
+        if (_cache[i].in_use) {
+            _cache_close(&_cache[i]);
+        }
+    }
+    mutex_unlock(&_cache_mtx);
+#endif
+}
+
+static ssize_t _get_file_locked(coap_pkt_t *pdu, uint8_t *buf, size_t len,
+                                struct requestdata *request)
+{
+    int err, fd = -1;
+    uint32_t etag, size_total, pos = 0;
+    /* an ongoing download continues without resolving the path again */
+    struct cached_file *entry = _cache_find(request, &fd, &etag, &size_total, &pos);
 
     coap_block1_t block2 = { .szx = CONFIG_NANOCOAP_BLOCK_SIZE_EXP_MAX };
-    {
+    if (request->options.exists.block2 && !coap_get_block2(pdu, &block2)) {
+        return _error_handler(pdu, buf, len, COAP_CODE_BAD_OPTION);
+    }
+    if ((entry != NULL) && (block2.blknum == 0)) {
+        /* a new download, the file may have been changed via the VFS since
+         * the ETag was taken */
+        _cache_update(entry, request, fd, etag, size_total, 0, false);
+        entry = NULL;
+        fd = -1;
+        pos = 0;
+    }
+    if (entry == NULL) {
         struct stat stat;
         if ((err = vfs_stat(request->namebuf, &stat)) < 0) {
             return _error_handler(pdu, buf, len, err);
@@ -216,9 +376,6 @@ static ssize_t _get_file(coap_pkt_t *pdu, uint8_t *buf, size_t len,
         size_total = stat.st_size;
         stat_etag(&stat, &etag);
     }
-    if (request->options.exists.block2 && !coap_get_block2(pdu, &block2)) {
-        return _error_handler(pdu, buf, len, COAP_CODE_BAD_OPTION);
-    }
     if (request->options.exists.if_match &&
         memcmp(&etag, &request->options.if_match, request->options.if_match_len)) {
         return _error_handler(pdu, buf, len, COAP_CODE_PRECONDITION_FAILED);
@@ -230,9 +387,11 @@ static ssize_t _get_file(coap_pkt_t *pdu, uint8_t *buf, size_t len,
         return coap_opt_finish(pdu, COAP_OPT_FINISH_NONE);
     }
 
-    int fd = vfs_open(request->namebuf, O_RDONLY, 0);
     if (fd < 0) {
-        return _error_handler(pdu, buf, len, fd);
+        fd = vfs_open(request->namebuf, O_RDONLY, 0);
+        if (fd < 0) {
+            return _error_handler(pdu, buf, len, fd);
+        }
     }
 
     _resp_init(pdu, buf, len, COAP_CODE_CONTENT);
@@ -250,9 +409,11 @@ static ssize_t _get_file(coap_pkt_t *pdu, uint8_t *buf, size_t len,
 
     size_t resp_len = coap_opt_finish(pdu, COAP_OPT_FINISH_PAYLOAD);
 
-    err = vfs_lseek(fd, slicer.start, SEEK_SET);
-    if (err < 0) {
-        goto late_err;
+    if (pos != slicer.start) {
+        err = vfs_lseek(fd, slicer.start, SEEK_SET);
+        if (err < 0) {
+            goto late_err;
+        }
     }
 
     if (block2.blknum == 0) {
@@ -267,14 +428,26 @@ static ssize_t _get_file(coap_pkt_t *pdu, uint8_t *buf, size_t len,
      * */
     assert(pdu->payload + slicer.end - slicer.start <= buf + len);
     bool more = 1;
-    int read = vfs_read(fd, pdu->payload, slicer.end - slicer.start + more);
-    if (read < 0) {
-        goto late_err;
+    int read;
+    if (IS_USED(MODULE_NANOCOAP_FILESERVER_CACHE)) {
+        /* the file is kept open with a known size, so don't read the first
+         * byte of the next block to find out whether there is one */
+        read = vfs_read(fd, pdu->payload, slicer.end - slicer.start);
+        if (read < 0) {
+            goto late_err;
+        }
+        more = slicer.start + read < size_total;
+    }
+    else {
+        read = vfs_read(fd, pdu->payload, slicer.end - slicer.start + more);
+        if (read < 0) {
+            goto late_err;
+        }
+        more = (unsigned)read > slicer.end - slicer.start;
+        read -= more;
     }
-    more = (unsigned)read > slicer.end - slicer.start;
-    read -= more;
 
-    vfs_close(fd);
+    _cache_update(entry, request, fd, etag, size_total, slicer.start + read, more);
 
     slicer.cur = slicer.end + more;
     coap_block2_finish(&slicer);
@@ -291,11 +464,24 @@ static ssize_t _get_file(coap_pkt_t *pdu, uint8_t *buf, size_t len,
     return resp_len + read;
 
 late_err:
-    vfs_close(fd);
+    _cache_update(entry, request, fd, etag, size_total, 0, false);
     coap_hdr_set_code(pdu->hdr, COAP_CODE_INTERNAL_SERVER_ERROR);
     return coap_get_total_hdr_len(pdu);
 }
 
+static ssize_t _get_file(coap_pkt_t *pdu, uint8_t *buf, size_t len,
+                         struct requestdata *request)
+{
+#if IS_USED(MODULE_NANOCOAP_FILESERVER_CACHE)
+    mutex_lock(&_cache_mtx);
+    ssize_t res = _get_file_locked(pdu, buf, len, request);
+    mutex_unlock(&_cache_mtx);
+    return res;
+#else
+    return _get_file_locked(pdu, buf, len, request);
+#endif
+}
+
 #if IS_USED(MODULE_NANOCOAP_FILESERVER_PUT)
 static ssize_t _put_file(coap_pkt_t *pdu, uint8_t *buf, size_t len,
                          struct requestdata *request)
@@ -304,6 +490,7 @@ static ssize_t _put_file(coap_pkt_t *pdu, uint8_t *buf, size_t len,
     uint32_t etag;
     struct stat stat;
     coap_block1_t block1 = {0};
+    _cache_clear();
     bool create = (vfs_stat(request->namebuf, &stat) == -ENOENT);
     if (create) {
         /* While a file 'f' is initially being created,
@@ -431,6 +618,7 @@ static ssize_t _delete_file(coap_pkt_t *pdu, uint8_t *buf, size_t len,
 
     _event_file(NANOCOAP_FILESERVER_DELETE_FILE, request);
 
+    _cache_clear();
     if ((ret = vfs_unlink(request->namebuf)) < 0) {
         return _error_handler(pdu, buf, len, ret);
     }
@@ -552,6 +740,7 @@ static ssize_t _delete_directory(coap_pkt_t *pdu, uint8_t *buf, size_t len,
                                  struct requestdata *request)
 {
     int err;
+    _cache_clear();
     if (request->options.exists.if_match && request->options.if_match_len) {
         if (request->options.if_match != byteorder_htonl(COAPFILESERVER_DIR_DELETE_ETAG).u32) {
             return _error_handler(pdu, buf, len, COAP_CODE_PRECONDITION_FAILED);
@@ -596,7 +785,9 @@ ssize_t nanocoap_fileserver_handler(coap_pkt_t *pdu, uint8_t *buf, size_t len,
                                  coap_request_ctx_t *ctx) {
     const char *root = coap_request_ctx_get_context(ctx);
     const char *resource = coap_request_ctx_get_path(ctx);
-    struct requestdata request = {0};
+    struct requestdata request = {
+        .remote = coap_request_ctx_get_remote_udp(ctx),
+    };
 
     /** Index in request.namebuf. Must not point at the last entry as that will be
      * zeroed to get a 0-terminated string. */
@@ -922,13 +922,7 @@ static unsigned _size2szx(size_t size)
 static unsigned _slicer2blkopt(coap_block_slicer_t *slicer, bool more)
 {
     size_t blksize = slicer->end - slicer->start;
-    size_t start = slicer->start;
-    unsigned blknum = 0;
-
-    while (start > 0) {
-        start -= blksize;
-        blknum++;
-    }
+    unsigned blknum = slicer->start / blksize;
 
     return (blknum << 4) | _size2szx(blksize) | (more ? 0x8 : 0);
 }
@@ -14,14 +14,107 @@
 
 #include <inttypes.h>
 #include <stdio.h>
+#include <string.h>
 
+#include "byteorder.h"
 #include "modules.h"
 #include "od.h"
 #include "net/inet_csum.h"
 
+#if IS_USED(MODULE_INET_CSUM_FAST) && defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
 #define ENABLE_DEBUG 0
 #include "debug.h"
 
+#if IS_USED(MODULE_INET_CSUM_FAST)
+/* buf is only ever accessed through these at suitably aligned addresses */
+typedef uint16_t __attribute__((may_alias)) _u16_alias_t;
+typedef uint32_t __attribute__((may_alias)) _u32_alias_t;
+
+static inline uint16_t _fold(uint64_t acc)
+{
+    while (acc >> 16) {
+        acc = (acc & 0xffff) + (acc >> 16);
+    }
+    return acc;
+}
+
+/* Sums up buf as 16-bit words in host byte order. Since the one's complement
+ * sum is independent of byte order, the result only needs to be swapped to
+ * network byte order afterwards (see RFC 1071, section 2 (B)). buf must be
+ * 2-byte aligned. */
+static uint64_t _sum_host(const uint8_t *buf, uint16_t len)
+{
+    uint64_t acc = 0;
+
+    if (((uintptr_t)buf & 0x2) && (len >= 2)) {
+        acc += *(const _u16_alias_t *)buf;
+        buf += 2;
+        len -= 2;
+    }
+#ifdef __SSE2__
+    if (len >= 16) {
+        const __m128i zero = _mm_setzero_si128();
+        __m128i lo = zero, hi = zero;
+        uint32_t lanes[4];
+
+        /* with len < 2^16 the 32-bit lanes can't overflow */
+        for (; len >= 16; buf += 16, len -= 16) {
+            __m128i v = _mm_loadu_si128((const __m128i *)buf);
+
+            lo = _mm_add_epi32(lo, _mm_unpacklo_epi16(v, zero));
+            hi = _mm_add_epi32(hi, _mm_unpackhi_epi16(v, zero));
+        }
+        _mm_storeu_si128((__m128i *)lanes, _mm_add_epi32(lo, hi));
+        acc += (uint64_t)lanes[0] + lanes[1] + lanes[2] + lanes[3];
+    }
+#endif
+    /* carries are collected in the upper half of acc and only folded back
+     * once at the end */
+    for (; len >= 16; buf += 16, len -= 16) {
+        const _u32_alias_t *w = (const _u32_alias_t *)buf;
+
+        acc += (uint64_t)w[0] + w[1] + w[2] + w[3];
+    }
+    for (; len >= 4; buf += 4, len -= 4) {
+        acc += *(const _u32_alias_t *)buf;
+    }
+    if (len >= 2) {
+        acc += *(const _u16_alias_t *)buf;
+        buf += 2;
+        len -= 2;
+    }
+    if (len) {
+        /* last byte is top half of a 16-bit word in network byte order */
+        uint8_t last[2] = { *buf, 0 };
+        uint16_t word;
+
+        memcpy(&word, last, sizeof(word));
+        acc += word;
+    }
+    return acc;
+}
+
+/* Sums up buf as 16-bit words in network byte order, padding an odd last
+ * byte */
+static uint16_t _sum(const uint8_t *buf, uint16_t len)
+{
+    if (len == 0) {
+        return 0;
+    }
+    if ((uintptr_t)buf & 0x1) {
+        /* sum up words starting at the second byte instead and rotate them
+         * into place */
+        uint16_t rest = _sum(buf + 1, len - 1);
+
+        return _fold(((uint32_t)*buf << 8) + byteorder_swaps(rest));
+    }
+    return ntohs(_fold(_sum_host(buf, len)));
+}
+#endif  /* MODULE_INET_CSUM_FAST */
+
 uint16_t inet_csum_slice(uint16_t sum, const uint8_t *buf, uint16_t len, size_t accum_len)
 {
     uint32_t csum = sum;
@@ -47,6 +140,9 @@ uint16_t inet_csum_slice(uint16_t sum, const uint8_t *buf, uint16_t len, size_t
         accum_len++;
     }
 
+#if IS_USED(MODULE_INET_CSUM_FAST)
+    csum += _sum(buf, len);
+#else
     for (unsigned i = 0; i < (len >> 1); buf += 2, i++) {
         csum += (uint16_t)(*buf << 8) + *(buf + 1); /* group bytes by 16-byte words */
                                                     /* and add them */
@@ -54,6 +150,7 @@ uint16_t inet_csum_slice(uint16_t sum, const uint8_t *buf, uint16_t len, size_t
 
     if ((accum_len + len) & 1)          /* if accumulated length is odd */
         csum += (uint16_t)(*buf << 8);  /* add last byte as top half of 16-byte word */
+#endif
 
     while (csum >> 16) {
         uint16_t carry = csum >> 16;
@@ -66,6 +66,27 @@ int _gnrc_netapi_send_recv(kernel_pid_t pid, gnrc_pktsnip_t *pkt, uint16_t type)
     return ret;
 }
 
+int _gnrc_netapi_send_recv_batch(kernel_pid_t pid, gnrc_pktsnip_t *const *pkts,
+                                 unsigned numof, uint16_t type)
+{
+    gnrc_pktsnip_t *batch;
+    int ret;
+
+    assert(numof > 0);
+    batch = gnrc_pktbuf_add(NULL, pkts, numof * sizeof(*pkts),
+                            GNRC_NETTYPE_UNDEF);
+    if (batch == NULL) {
+        DEBUG("gnrc_netapi: unable to allocate batch of %u packets\n", numof);
+        return -ENOBUFS;
+    }
+    ret = _gnrc_netapi_send_recv(pid, batch, type);
+    if (ret < 1) {
+        /* packets stay with the caller */
+        gnrc_pktbuf_release(batch);
+    }
+    return ret;
+}
+
 #ifdef MODULE_GNRC_NETAPI_MBOX
 static inline int _snd_rcv_mbox(mbox_t *mbox, uint16_t type, gnrc_pktsnip_t *pkt)
 {
@@ -178,8 +178,13 @@ static gnrc_pktsnip_t *_recv(gnrc_netif_t *netif)
     int bytes_expected = dev->driver->recv(dev, NULL, 0, NULL);
 
     if (bytes_expected > 0) {
+        /* the frame is read in behind some padding, so the Ethernet header
+         * can be marked without copying the payload */
+        size_t pad = gnrc_pktbuf_mark_pad(sizeof(ethernet_hdr_t));
+        uint8_t *frame;
+
         pkt = gnrc_pktbuf_add(NULL, NULL,
-                              bytes_expected,
+                              pad + bytes_expected,
                               GNRC_NETTYPE_UNDEF);
 
         if (!pkt) {
@@ -191,7 +196,8 @@ static gnrc_pktsnip_t *_recv(gnrc_netif_t *netif)
             goto out;
         }
 
-        int nread = dev->driver->recv(dev, pkt->data, bytes_expected, &rx_info);
+        frame = (uint8_t *)pkt->data + pad;
+        int nread = dev->driver->recv(dev, frame, bytes_expected, &rx_info);
         if (nread <= 0) {
             DEBUG("gnrc_netif_ethernet: read error.\n");
             goto safe_out;
@@ -206,23 +212,24 @@ static gnrc_pktsnip_t *_recv(gnrc_netif_t *netif)
              * so free the unused space.*/
 
             DEBUG("gnrc_netif_ethernet: reallocating.\n");
-            gnrc_pktbuf_realloc_data(pkt, nread);
+            gnrc_pktbuf_realloc_data(pkt, pad + nread);
         }
 
         DEBUG("gnrc_netif_ethernet: received packet from %s of length %d\n",
-              gnrc_netif_addr_to_str(pkt->data, ETHERNET_ADDR_LEN, addr_str),
+              gnrc_netif_addr_to_str(frame, ETHERNET_ADDR_LEN, addr_str),
               nread);
 #if defined(MODULE_OD) && ENABLE_DEBUG
-        od_hex_dump(pkt->data, nread, OD_WIDTH_DEFAULT);
+        od_hex_dump(frame, nread, OD_WIDTH_DEFAULT);
 #endif
         /* mark ethernet header */
-        gnrc_pktsnip_t *eth_hdr = gnrc_pktbuf_mark(pkt, sizeof(ethernet_hdr_t), GNRC_NETTYPE_UNDEF);
+        gnrc_pktsnip_t *eth_hdr = gnrc_pktbuf_mark(pkt, pad + sizeof(ethernet_hdr_t),
+                                                   GNRC_NETTYPE_UNDEF);
         if (!eth_hdr) {
             DEBUG("gnrc_netif_ethernet: no space left in packet buffer\n");
             goto safe_out;
         }
 
-        ethernet_hdr_t *hdr = (ethernet_hdr_t *)eth_hdr->data;
+        ethernet_hdr_t *hdr = (ethernet_hdr_t *)((uint8_t *)eth_hdr->data + pad);
 
 #ifdef MODULE_L2FILTER
         if (!l2filter_pass(dev->filter, hdr->src, ETHERNET_ADDR_LEN)) {
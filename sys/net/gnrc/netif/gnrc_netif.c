@@ -1925,6 +1925,29 @@ static void _send(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt, bool push_back)
 #endif
 }
 
+#if IS_USED(MODULE_NETDEV_NEW_API)
+/* frames of a batch are handed to the device back to back, so wait for the
+ * frame in flight instead of dropping the next one with -EBUSY */
+static void _await_tx_done(gnrc_netif_t *netif)
+{
+    while (netif->tx_pkt != NULL) {
+        event_t *evp = _gnrc_netif_fetch_event(netif);
+
+        if (evp == NULL) {
+            thread_flags_wait_any(THREAD_FLAG_EVENT);
+        }
+        else if (evp->handler) {
+            evp->handler(evp);
+        }
+    }
+}
+#else
+static inline void _await_tx_done(gnrc_netif_t *netif)
+{
+    (void)netif;
+}
+#endif
+
 static void *_gnrc_netif_thread(void *args)
 {
     _netif_ctx_t *ctx = args;
@@ -1993,6 +2016,25 @@ static void *_gnrc_netif_thread(void *args)
                 last_wakeup = ztimer_now(ZTIMER_USEC);
 #endif
                 break;
+            case GNRC_NETAPI_MSG_TYPE_SND_BATCH:
+                DEBUG("gnrc_netif: GNRC_NETAPI_MSG_TYPE_SND_BATCH received\n");
+                for (unsigned i = 0; i < gnrc_netapi_batch_numof(msg.content.ptr);
+                     i++) {
+                    _await_tx_done(netif);
+                    _send(netif, gnrc_netapi_batch_get(msg.content.ptr, i),
+                          false);
+#if (CONFIG_GNRC_NETIF_MIN_WAIT_AFTER_SEND_US > 0U)
+                    ztimer_periodic_wakeup(
+                            ZTIMER_USEC,
+                            &last_wakeup,
+                            CONFIG_GNRC_NETIF_MIN_WAIT_AFTER_SEND_US
+                        );
+                    last_wakeup = ztimer_now(ZTIMER_USEC);
+#endif
+                }
+                /* the packets are handed over, only release the container */
+                gnrc_pktbuf_release(msg.content.ptr);
+                break;
             case GNRC_NETAPI_MSG_TYPE_SET:
                 opt = msg.content.ptr;
 #ifdef MODULE_NETOPT
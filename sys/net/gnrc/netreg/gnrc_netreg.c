@@ -34,6 +34,30 @@
 /* The registry as lookup table by gnrc_nettype_t */
 static gnrc_netreg_entry_t *netreg[GNRC_NETTYPE_NUMOF];
 
+#if IS_USED(MODULE_GNRC_NETTYPE_UDP) && (CONFIG_GNRC_NETREG_UDP_BUCKETS > 1)
+#define _HASH_UDP    1
+/* UDP registrations hashed by port. Entries with the same demux context end
+ * up in the same bucket, so a bucket can be walked just like a type list. */
+static gnrc_netreg_entry_t *_udp_buckets[CONFIG_GNRC_NETREG_UDP_BUCKETS];
+#endif
+
+/**
+ * @brief   Returns the list holding the entries of @p type with @p demux_ctx
+ *
+ * @pre `type` is valid
+ */
+static gnrc_netreg_entry_t **_list(gnrc_nettype_t type, uint32_t demux_ctx)
+{
+#ifdef _HASH_UDP
+    if (type == GNRC_NETTYPE_UDP) {
+        return &_udp_buckets[demux_ctx % CONFIG_GNRC_NETREG_UDP_BUCKETS];
+    }
+#else
+    (void)demux_ctx;
+#endif
+    return &netreg[type];
+}
+
 /** Held while accessing _lock_counter, and also while the exclusive lock is held */
 static mutex_t _lock_for_counter = MUTEX_INIT;
 /** Number of shared locks on netreg. Saturating arithmetic is used; if this
@@ -64,6 +88,9 @@ void gnrc_netreg_init(void)
 {
     /* set all pointers in registry to NULL */
     memset(netreg, 0, GNRC_NETTYPE_NUMOF * sizeof(gnrc_netreg_entry_t *));
+#ifdef _HASH_UDP
+    memset(_udp_buckets, 0, sizeof(_udp_buckets));
+#endif
 }
 
 void gnrc_netreg_acquire_shared(void) {
@@ -153,13 +180,15 @@ int gnrc_netreg_register(gnrc_nettype_t type, gnrc_netreg_entry_t *entry)
 
     _gnrc_netreg_acquire_exclusive();
 
+    gnrc_netreg_entry_t **list = _list(type, entry->demux_ctx);
+
     /* don't add the same entry twice */
     gnrc_netreg_entry_t *e;
-    LL_FOREACH(netreg[type], e) {
+    LL_FOREACH(*list, e) {
         assert(entry != e);
     }
 
-    LL_PREPEND(netreg[type], entry);
+    LL_PREPEND(*list, entry);
     _gnrc_netreg_release_exclusive();
 
     return 0;
@@ -171,8 +200,10 @@ void gnrc_netreg_unregister(gnrc_nettype_t type, gnrc_netreg_entry_t *entry)
         return;
     }
 
+    gnrc_netreg_entry_t **list = _list(type, entry->demux_ctx);
+
     _gnrc_netreg_acquire_exclusive();
-    LL_DELETE(netreg[type], entry);
+    LL_DELETE(*list, entry);
     /* We can release now already: No new references to this entry can be made
      * any more, and the caller is only allowed to reuse the entry and the mbox
      * target referenced by it after *this* function returned, not when the
@@ -214,7 +245,7 @@ static gnrc_netreg_entry_t *_netreg_lookup(gnrc_netreg_entry_t *from,
     gnrc_netreg_entry_t *res = NULL;
 
     if (from || !_INVALID_TYPE(type)) {
-        gnrc_netreg_entry_t *head = (from) ? from->next : netreg[type];
+        gnrc_netreg_entry_t *head = (from) ? from->next : *_list(type, demux_ctx);
         LL_SEARCH_SCALAR(head, res, demux_ctx, demux_ctx);
     }
 
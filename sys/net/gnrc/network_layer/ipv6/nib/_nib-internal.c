@@ -29,6 +29,7 @@
 
 #include "_nib-internal.h"
 #include "_nib-router.h"
+#include "_nib-trie.h"
 
 #define ENABLE_DEBUG 0
 #include "debug.h"
@@ -50,6 +51,17 @@ static char addr_str[IPV6_ADDR_MAX_STR_LEN];
 
 evtimer_msg_t _nib_evtimer;
 
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_NC_HASH)
+#define _NODES_IDX_SIZE     (2 * CONFIG_GNRC_IPV6_NIB_NUMOF)
+
+/* Linear probing index of _nodes with a specified address, hashed by that
+ * address. Slots hold the position in _nodes + 1, 0 marks a free slot.
+ * With at most half of the slots used probe sequences stay short. */
+static uint16_t _nodes_idx[_NODES_IDX_SIZE];
+static_assert(CONFIG_GNRC_IPV6_NIB_NUMOF < UINT16_MAX,
+              "CONFIG_GNRC_IPV6_NIB_NUMOF too large for neighbor cache index");
+#endif  /* CONFIG_GNRC_IPV6_NIB_NC_HASH */
+
 static void _override_node(const ipv6_addr_t *addr, unsigned iface,
                            _nib_onl_entry_t *node);
 static inline bool _node_unreachable(_nib_onl_entry_t *node);
@@ -62,10 +74,14 @@ void _nib_init(void)
     memset(_nodes, 0, sizeof(_nodes));
     memset(_def_routers, 0, sizeof(_def_routers));
     memset(_dsts, 0, sizeof(_dsts));
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_NC_HASH)
+    memset(_nodes_idx, 0, sizeof(_nodes_idx));
+#endif  /* CONFIG_GNRC_IPV6_NIB_NC_HASH */
 #if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_MULTIHOP_P6C)
     memset(_abrs, 0, sizeof(_abrs));
 #endif  /* CONFIG_GNRC_IPV6_NIB_MULTIHOP_P6C */
 #endif  /* TEST_SUITES */
+    _nib_trie_init();
     evtimer_init_msg(&_nib_evtimer);
     /* TODO: load ABR information from persistent memory */
 }
@@ -87,6 +103,103 @@ static inline bool _addr_equals(const ipv6_addr_t *addr,
            (ipv6_addr_equal(addr, &node->ipv6));
 }
 
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_NC_HASH)
+static inline unsigned _nodes_idx_home(const ipv6_addr_t *addr)
+{
+    uint32_t hash = addr->u32[0].u32 ^ addr->u32[1].u32 ^
+                    addr->u32[2].u32 ^ addr->u32[3].u32;
+
+    /* mix all bits, so sequential interface identifiers are spread
+     * independent of byte order */
+    hash = ((hash >> 16) ^ hash) * 0x45d9f3bU;
+    hash = (hash >> 16) ^ hash;
+    return hash % _NODES_IDX_SIZE;
+}
+
+static inline unsigned _nodes_idx_next(unsigned i)
+{
+    return ((i + 1) < _NODES_IDX_SIZE) ? (i + 1) : 0;
+}
+
+static inline _nib_onl_entry_t *_nodes_idx_entry(unsigned i)
+{
+    return &_nodes[_nodes_idx[i] - 1];
+}
+
+static void _nodes_idx_add(const _nib_onl_entry_t *node)
+{
+    unsigned i = _nodes_idx_home(&node->ipv6);
+
+    while (_nodes_idx[i] != 0) {
+        i = _nodes_idx_next(i);
+    }
+    _nodes_idx[i] = (node - _nodes) + 1;
+}
+
+void _nib_onl_unindex(const _nib_onl_entry_t *node)
+{
+    uint16_t pos = (node - _nodes) + 1;
+    unsigned i;
+
+    if (ipv6_addr_is_unspecified(&node->ipv6)) {
+        /* only nodes with a specified address are indexed */
+        return;
+    }
+    for (i = _nodes_idx_home(&node->ipv6); _nodes_idx[i] != pos;
+         i = _nodes_idx_next(i)) {
+        if (_nodes_idx[i] == 0) {
+            return;
+        }
+    }
+    /* shift following entries of the probe sequence back into the gap so
+     * lookups don't stop early */
+    for (unsigned j = _nodes_idx_next(i); _nodes_idx[j] != 0;
+         j = _nodes_idx_next(j)) {
+        unsigned home = _nodes_idx_home(&_nodes_idx_entry(j)->ipv6);
+
+        if ((i <= j) ? ((i < home) && (home <= j))
+                     : ((i < home) || (home <= j))) {
+            /* entry at j can't be moved before its home slot */
+            continue;
+        }
+        _nodes_idx[i] = _nodes_idx[j];
+        i = j;
+    }
+    _nodes_idx[i] = 0;
+}
+
+static _nib_onl_entry_t *_nodes_idx_get(const ipv6_addr_t *addr,
+                                        unsigned iface)
+{
+    _nib_onl_entry_t *res = NULL;
+
+    for (unsigned i = _nodes_idx_home(addr); _nodes_idx[i] != 0;
+         i = _nodes_idx_next(i)) {
+        _nib_onl_entry_t *node = _nodes_idx_entry(i);
+
+        /* same address may be in the NIB for multiple interfaces, so the
+         * first one in _nodes wins as with a linear search */
+        if ((_nib_onl_get_if(node) == iface) &&
+            ipv6_addr_equal(&node->ipv6, addr) &&
+            ((res == NULL) || (node < res))) {
+            res = node;
+        }
+    }
+    return res;
+}
+#else   /* CONFIG_GNRC_IPV6_NIB_NC_HASH */
+#define _nodes_idx_add(node)    (void)node
+#endif  /* CONFIG_GNRC_IPV6_NIB_NC_HASH */
+
+static void _set_addr(_nib_onl_entry_t *node, const ipv6_addr_t *addr)
+{
+    _nib_onl_unindex(node);
+    memcpy(&node->ipv6, addr, sizeof(node->ipv6));
+    if (!ipv6_addr_is_unspecified(&node->ipv6)) {
+        _nodes_idx_add(node);
+    }
+}
+
 _nib_onl_entry_t *_nib_onl_alloc(const ipv6_addr_t *addr, unsigned iface)
 {
     _nib_onl_entry_t *node = NULL;
@@ -94,6 +207,22 @@ _nib_onl_entry_t *_nib_onl_alloc(const ipv6_addr_t *addr, unsigned iface)
     DEBUG("nib: Allocating on-link node entry (addr = %s, iface = %u)\n",
           (addr == NULL) ? "NULL" : ipv6_addr_to_str(addr_str, addr,
                                                      sizeof(addr_str)), iface);
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_NC_HASH)
+    if ((addr != NULL) && ((node = _nodes_idx_get(addr, iface)) != NULL)) {
+        /* like the linear search below, prefer an earlier entry without an
+         * address on the same interface */
+        for (_nib_onl_entry_t *tmp = _nodes; tmp < node; tmp++) {
+            if ((_nib_onl_get_if(tmp) == iface) &&
+                ipv6_addr_is_unspecified(&tmp->ipv6)) {
+                node = tmp;
+                break;
+            }
+        }
+        DEBUG("  %p is an exact match\n", (void *)node);
+        _override_node(addr, iface, node);
+        return node;
+    }
+#endif  /* CONFIG_GNRC_IPV6_NIB_NC_HASH */
     for (unsigned i = 0; i < CONFIG_GNRC_IPV6_NIB_NUMOF; i++) {
         _nib_onl_entry_t *tmp = &_nodes[i];
 
@@ -214,26 +343,49 @@ _nib_onl_entry_t *_nib_onl_iter(const _nib_onl_entry_t *last)
     return NULL;
 }
 
+static inline bool _onl_matches(const _nib_onl_entry_t *node,
+                                const ipv6_addr_t *addr, unsigned iface)
+{
+    return (node->mode != _EMPTY) &&
+           /* either requested or current interface undefined or
+            * interfaces equal */
+           ((_nib_onl_get_if(node) == 0) || (iface == 0) ||
+            (_nib_onl_get_if(node) == iface)) &&
+           ipv6_addr_equal(&node->ipv6, addr);
+}
+
 _nib_onl_entry_t *_nib_onl_get(const ipv6_addr_t *addr, unsigned iface)
 {
+    _nib_onl_entry_t *res = NULL;
+
     assert(addr != NULL);
     DEBUG("nib: Getting on-link node entry (addr = %s, iface = %u)\n",
           ipv6_addr_to_str(addr_str, addr, sizeof(addr_str)), iface);
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_NC_HASH)
+    for (unsigned i = _nodes_idx_home(addr); _nodes_idx[i] != 0;
+         i = _nodes_idx_next(i)) {
+        _nib_onl_entry_t *node = _nodes_idx_entry(i);
+
+        /* index is unordered, but the first match in _nodes has to win */
+        if (_onl_matches(node, addr, iface) && ((res == NULL) || (node < res))) {
+            res = node;
+        }
+    }
+#else   /* CONFIG_GNRC_IPV6_NIB_NC_HASH */
     for (unsigned i = 0; i < CONFIG_GNRC_IPV6_NIB_NUMOF; i++) {
-        _nib_onl_entry_t *node = &_nodes[i];
-
-        if ((node->mode != _EMPTY) &&
-            /* either requested or current interface undefined or
-             * interfaces equal */
-            ((_nib_onl_get_if(node) == 0) || (iface == 0) ||
-             (_nib_onl_get_if(node) == iface)) &&
-            ipv6_addr_equal(&node->ipv6, addr)) {
-            DEBUG("  Found %p\n", (void *)node);
-            return node;
+        if (_onl_matches(&_nodes[i], addr, iface)) {
+            res = &_nodes[i];
+            break;
         }
     }
-    DEBUG("  No suitable entry found\n");
-    return NULL;
+#endif  /* CONFIG_GNRC_IPV6_NIB_NC_HASH */
+    if (res != NULL) {
+        DEBUG("  Found %p\n", (void *)res);
+    }
+    else {
+        DEBUG("  No suitable entry found\n");
+    }
+    return res;
 }
 
 void _nib_nc_set_reachable(_nib_onl_entry_t *node)
@@ -494,7 +646,7 @@ _nib_offl_entry_t *_nib_offl_alloc(const ipv6_addr_t *next_hop, unsigned iface,
             /* exact match (or next hop address was previously unset) */
             DEBUG("  %p is an exact match\n", (void *)tmp);
             if (next_hop != NULL) {
-                memcpy(&tmp_node->ipv6, next_hop, sizeof(tmp_node->ipv6));
+                _set_addr(tmp_node, next_hop);
             }
             tmp->next_hop->mode |= _DST;
             return tmp;
@@ -515,6 +667,7 @@ _nib_offl_entry_t *_nib_offl_alloc(const ipv6_addr_t *next_hop, unsigned iface,
         dst->next_hop->mode |= _DST;
         ipv6_addr_init_prefix(&dst->pfx, pfx, pfx_len);
         dst->pfx_len = pfx_len;
+        _nib_trie_add(dst);
     }
     return dst;
 }
@@ -551,6 +704,7 @@ void _nib_offl_clear(_nib_offl_entry_t *dst)
             dst->next_hop->mode &= ~(_DST);
             _nib_onl_clear(dst->next_hop);
         }
+        _nib_trie_remove(dst);
         memset(dst, 0, sizeof(_nib_offl_entry_t));
     }
 }
@@ -576,11 +730,14 @@ bool _nib_offl_is_entry(const _nib_offl_entry_t *entry)
 
 static _nib_offl_entry_t *_nib_offl_get_match(const ipv6_addr_t *dst)
 {
+    DEBUG("nib: get match for destination %s from NIB\n",
+          ipv6_addr_to_str(addr_str, dst, sizeof(addr_str)));
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_OFFL_TRIE)
+    return _nib_trie_get_match(dst);
+#else   /* CONFIG_GNRC_IPV6_NIB_OFFL_TRIE */
     _nib_offl_entry_t *res = NULL;
     uint8_t best_match = 0;
 
-    DEBUG("nib: get match for destination %s from NIB\n",
-          ipv6_addr_to_str(addr_str, dst, sizeof(addr_str)));
     for (_nib_offl_entry_t *entry = _dsts; _in_dsts(entry); entry++) {
         if (entry->mode != _EMPTY) {
             uint8_t match = ipv6_addr_match_prefix(&entry->pfx, dst);
@@ -601,6 +758,7 @@ static _nib_offl_entry_t *_nib_offl_get_match(const ipv6_addr_t *dst)
         }
     }
     return res;
+#endif  /* CONFIG_GNRC_IPV6_NIB_OFFL_TRIE */
 }
 
 void _nib_ft_get(const _nib_offl_entry_t *dst, gnrc_ipv6_nib_ft_t *fte)
@@ -860,7 +1018,7 @@ static void _override_node(const ipv6_addr_t *addr, unsigned iface,
 {
     _nib_onl_clear(node);
     if (addr != NULL) {
-        memcpy(&node->ipv6, addr, sizeof(node->ipv6));
+        _set_addr(node, addr);
     }
     _nib_onl_set_if(node, iface);
 }
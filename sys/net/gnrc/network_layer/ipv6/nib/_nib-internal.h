@@ -196,7 +196,7 @@ typedef struct {
 /**
  * @brief   Off-link NIB entry
  */
-typedef struct {
+typedef struct _nib_offl_entry {
     _nib_onl_entry_t *next_hop; /**< next hop to destination */
     ipv6_addr_t pfx;            /**< prefix to the destination */
     /**
@@ -218,6 +218,13 @@ typedef struct {
                                      valid (UINT32_MAX means forever) */
     uint32_t pref_until;        /**< timestamp (in ms) until which the prefix
                                      preferred (UINT32_MAX means forever) */
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_OFFL_TRIE) || defined(DOXYGEN)
+    /**
+     * @brief   next off-link entry with the same prefix in the
+     *          longest-prefix-match trie
+     */
+    struct _nib_offl_entry *trie_next;
+#endif
 } _nib_offl_entry_t;
 
 /**
@@ -356,6 +363,19 @@ static inline void _nib_onl_set_if(_nib_onl_entry_t *node, unsigned iface)
  */
 _nib_onl_entry_t *_nib_onl_alloc(const ipv6_addr_t *addr, unsigned iface);
 
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_NC_HASH) || defined(DOXYGEN)
+/**
+ * @brief   Removes an on-link entry from the address hash index
+ *
+ * @see @ref CONFIG_GNRC_IPV6_NIB_NC_HASH
+ *
+ * @param[in] node  An entry. Nothing happens if it is not in the index.
+ */
+void _nib_onl_unindex(const _nib_onl_entry_t *node);
+#else   /* CONFIG_GNRC_IPV6_NIB_NC_HASH */
+#define _nib_onl_unindex(node)  (void)node
+#endif  /* CONFIG_GNRC_IPV6_NIB_NC_HASH */
+
 /**
  * @brief   Clears out a NIB entry (on-link version)
  *
@@ -367,6 +387,7 @@ _nib_onl_entry_t *_nib_onl_alloc(const ipv6_addr_t *addr, unsigned iface);
 static inline bool _nib_onl_clear(_nib_onl_entry_t *node)
 {
     if (node->mode == _EMPTY) {
+        _nib_onl_unindex(node);
         memset(node, 0, sizeof(_nib_onl_entry_t));
         return true;
     }
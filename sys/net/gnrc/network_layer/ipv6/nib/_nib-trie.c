@@ -0,0 +1,246 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ *
+ * Path-compressed binary trie over the prefixes of the off-link entries.
+ * Every node either carries at least one off-link entry with exactly the
+ * node's prefix or it is a branching node with two children, so at most
+ * 2 * CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF - 1 nodes are ever in use.
+ */
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include <kernel_defines.h>
+
+#include "net/gnrc/ipv6/nib/conf.h"
+#include "net/ipv6/addr.h"
+
+#include "_nib-internal.h"
+#include "_nib-trie.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_OFFL_TRIE)
+
+#define _TRIE_NODES_NUMOF   (2 * CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF)
+
+typedef struct _trie_node {
+    struct _trie_node *child[2];    /**< children, indexed by the bit after
+                                     *   _trie_node_t::pfx_len */
+    _nib_offl_entry_t *entries;     /**< off-link entries with this prefix,
+                                     *   ordered by their position in the
+                                     *   off-link entry array */
+    ipv6_addr_t pfx;                /**< prefix, zeroed after
+                                     *   _trie_node_t::pfx_len bits */
+    uint8_t pfx_len;                /**< length of _trie_node_t::pfx in bits */
+} _trie_node_t;
+
+static _trie_node_t _trie_nodes[_TRIE_NODES_NUMOF];
+static _trie_node_t *_free;
+static _trie_node_t *_root;
+
+static inline unsigned _bit(const ipv6_addr_t *addr, uint8_t pos)
+{
+    return (addr->u8[pos >> 3] >> (7 - (pos & 0x7))) & 0x1;
+}
+
+static inline uint8_t _common(const _trie_node_t *node,
+                              const ipv6_addr_t *pfx, uint8_t pfx_len)
+{
+    uint8_t common = ipv6_addr_match_prefix(&node->pfx, pfx);
+
+    common = (common > node->pfx_len) ? node->pfx_len : common;
+    return (common > pfx_len) ? pfx_len : common;
+}
+
+static _trie_node_t *_node_alloc(const ipv6_addr_t *pfx, uint8_t pfx_len)
+{
+    _trie_node_t *node = _free;
+
+    /* pool is sized so it can't run out, see comment on top */
+    assert(node != NULL);
+    _free = node->child[0];
+    memset(node, 0, sizeof(*node));
+    ipv6_addr_init_prefix(&node->pfx, pfx, pfx_len);
+    node->pfx_len = pfx_len;
+    return node;
+}
+
+static void _node_free(_trie_node_t *node)
+{
+    node->child[0] = _free;
+    _free = node;
+}
+
+void _nib_trie_init(void)
+{
+    _root = NULL;
+    _free = NULL;
+    for (unsigned i = 0; i < _TRIE_NODES_NUMOF; i++) {
+        _node_free(&_trie_nodes[i]);
+    }
+}
+
+static void _entries_insert(_trie_node_t *node, _nib_offl_entry_t *entry)
+{
+    _nib_offl_entry_t **ptr = &node->entries;
+
+    while ((*ptr != NULL) && (*ptr < entry)) {
+        ptr = &(*ptr)->trie_next;
+    }
+    entry->trie_next = *ptr;
+    *ptr = entry;
+}
+
+void _nib_trie_add(_nib_offl_entry_t *entry)
+{
+    _trie_node_t **slot = &_root;
+    const ipv6_addr_t *pfx = &entry->pfx;
+    uint8_t pfx_len = entry->pfx_len;
+    uint8_t common = 0;
+
+    assert((entry->next_hop != NULL) && (pfx_len > 0));
+    DEBUG("nib: adding %p to trie\n", (void *)entry);
+    while (*slot != NULL) {
+        _trie_node_t *node = *slot;
+
+        common = _common(node, pfx, pfx_len);
+        if (common < node->pfx_len) {
+            /* prefix diverges from or is shorter than this node */
+            break;
+        }
+        if (node->pfx_len == pfx_len) {
+            _entries_insert(node, entry);
+            return;
+        }
+        slot = &node->child[_bit(pfx, node->pfx_len)];
+    }
+    if (*slot == NULL) {
+        _trie_node_t *leaf = _node_alloc(pfx, pfx_len);
+
+        _entries_insert(leaf, entry);
+        *slot = leaf;
+    }
+    else if (common == pfx_len) {
+        /* new prefix covers the node in slot */
+        _trie_node_t *node = _node_alloc(pfx, pfx_len);
+
+        _entries_insert(node, entry);
+        node->child[_bit(&(*slot)->pfx, pfx_len)] = *slot;
+        *slot = node;
+    }
+    else {
+        /* prefixes diverge after common bits => branch */
+        _trie_node_t *branch = _node_alloc(pfx, common);
+        _trie_node_t *leaf = _node_alloc(pfx, pfx_len);
+
+        _entries_insert(leaf, entry);
+        branch->child[_bit(&(*slot)->pfx, common)] = *slot;
+        branch->child[_bit(pfx, common)] = leaf;
+        *slot = branch;
+    }
+}
+
+/* removes node in slot if it has neither entries nor is needed for
+ * branching, returns true if it was removed */
+static bool _compact(_trie_node_t **slot)
+{
+    _trie_node_t *node = *slot;
+
+    if (node->entries != NULL) {
+        return false;
+    }
+    if ((node->child[0] != NULL) && (node->child[1] != NULL)) {
+        return false;
+    }
+    *slot = (node->child[0] != NULL) ? node->child[0] : node->child[1];
+    _node_free(node);
+    return true;
+}
+
+void _nib_trie_remove(_nib_offl_entry_t *entry)
+{
+    _trie_node_t **parent = NULL;
+    _trie_node_t **slot = &_root;
+
+    DEBUG("nib: removing %p from trie\n", (void *)entry);
+    while (*slot != NULL) {
+        _trie_node_t *node = *slot;
+
+        if (_common(node, &entry->pfx, entry->pfx_len) < node->pfx_len) {
+            break;
+        }
+        if (node->pfx_len == entry->pfx_len) {
+            for (_nib_offl_entry_t **ptr = &node->entries; *ptr != NULL;
+                 ptr = &(*ptr)->trie_next) {
+                if (*ptr == entry) {
+                    *ptr = entry->trie_next;
+                    entry->trie_next = NULL;
+                    break;
+                }
+            }
+            /* parent may become a superfluous branch node when a leaf is
+             * removed */
+            if (_compact(slot) && (parent != NULL)) {
+                _compact(parent);
+            }
+            return;
+        }
+        parent = slot;
+        slot = &node->child[_bit(&entry->pfx, node->pfx_len)];
+    }
+    DEBUG("nib: %p was not in trie\n", (void *)entry);
+}
+
+_nib_offl_entry_t *_nib_trie_get_match(const ipv6_addr_t *dst)
+{
+    _nib_offl_entry_t *res = NULL;
+    uint8_t best_match = 0;
+
+    for (const _trie_node_t *node = _root; node != NULL;) {
+        uint8_t match = ipv6_addr_match_prefix(&node->pfx, dst);
+
+        if (match < node->pfx_len) {
+            break;
+        }
+        for (_nib_offl_entry_t *entry = node->entries; entry != NULL;
+             entry = entry->trie_next) {
+            if (entry->mode == _EMPTY) {
+                continue;
+            }
+            /* entries beyond the first non-empty one are at later positions
+             * in the array, so they can't win a tie */
+            match = ipv6_addr_match_prefix(&entry->pfx, dst);
+            if ((match > best_match) ||
+                ((match == best_match) && (res != NULL) && (entry < res))) {
+                DEBUG("nib: best match %p (%u bits)\n", (void *)entry, match);
+                res = entry;
+                best_match = match;
+            }
+            break;
+        }
+        if (node->pfx_len == IPV6_ADDR_BIT_LEN) {
+            break;
+        }
+        node = node->child[_bit(dst, node->pfx_len)];
+    }
+    return res;
+}
+
+#else   /* CONFIG_GNRC_IPV6_NIB_OFFL_TRIE */
+typedef int dont_be_pedantic;
+#endif  /* CONFIG_GNRC_IPV6_NIB_OFFL_TRIE */
+
+/** @} */
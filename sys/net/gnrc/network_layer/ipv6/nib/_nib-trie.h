@@ -0,0 +1,83 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup net_gnrc_ipv6_nib
+ * @brief
+ * @{
+ *
+ * @file
+ * @brief   Definitions related to the longest-prefix-match trie over the
+ *          off-link entries of the NIB
+ * @see     @ref CONFIG_GNRC_IPV6_NIB_OFFL_TRIE
+ * @internal
+ */
+#ifndef PRIV_NIB_TRIE_H
+#define PRIV_NIB_TRIE_H
+
+#include <kernel_defines.h>
+
+#include "net/gnrc/ipv6/nib/conf.h"
+#include "net/ipv6/addr.h"
+
+#include "_nib-internal.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_OFFL_TRIE) || defined(DOXYGEN)
+/**
+ * @brief   Resets the trie to an empty state
+ */
+void _nib_trie_init(void);
+
+/**
+ * @brief   Adds an off-link entry to the trie
+ *
+ * @pre `(entry != NULL) && (entry->next_hop != NULL)`
+ * @pre @p entry is not already in the trie.
+ *
+ * @param[in] entry An off-link entry with _nib_offl_entry_t::pfx and
+ *                  _nib_offl_entry_t::pfx_len set.
+ */
+void _nib_trie_add(_nib_offl_entry_t *entry);
+
+/**
+ * @brief   Removes an off-link entry from the trie
+ *
+ * @param[in] entry An off-link entry previously added with _nib_trie_add().
+ */
+void _nib_trie_remove(_nib_offl_entry_t *entry);
+
+/**
+ * @brief   Gets the best matching off-link entry for a destination
+ *
+ * Yields the same result as a linear search over all non-empty off-link
+ * entries: the entry with the most bits in common with @p dst that covers
+ * @p dst wins, ties are broken by the position of the entry in the off-link
+ * entry array.
+ *
+ * @param[in] dst   A destination address.
+ *
+ * @return  The best matching off-link entry for @p dst.
+ * @return  NULL, if no off-link entry covers @p dst.
+ */
+_nib_offl_entry_t *_nib_trie_get_match(const ipv6_addr_t *dst);
+#else   /* CONFIG_GNRC_IPV6_NIB_OFFL_TRIE */
+#define _nib_trie_init()            (void)0
+#define _nib_trie_add(entry)        (void)entry
+#define _nib_trie_remove(entry)     (void)entry
+#endif  /* CONFIG_GNRC_IPV6_NIB_OFFL_TRIE */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PRIV_NIB_TRIE_H */
+/** @} */
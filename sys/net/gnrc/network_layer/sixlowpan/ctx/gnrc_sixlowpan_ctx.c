@@ -15,6 +15,7 @@
 #include <stdbool.h>
 #include <inttypes.h>
 
+#include "atomic_utils.h"
 #include "mutex.h"
 #include "net/gnrc/sixlowpan/ctx.h"
 #if IS_USED(MODULE_ZTIMER_MSEC)
@@ -30,6 +31,7 @@
 static gnrc_sixlowpan_ctx_t _ctxs[GNRC_SIXLOWPAN_CTX_SIZE];
 static uint32_t _ctx_inval_times[GNRC_SIXLOWPAN_CTX_SIZE];
 static mutex_t _ctx_mutex = MUTEX_INIT;
+static uint32_t _ctx_gen;
 
 static uint32_t _current_minute(void);
 static void _update_lifetime(uint8_t id);
@@ -106,6 +108,8 @@ gnrc_sixlowpan_ctx_t *gnrc_sixlowpan_ctx_update(uint8_t id, const ipv6_addr_t *p
 
     mutex_lock(&_ctx_mutex);
 
+    gnrc_sixlowpan_ctx_t old = _ctxs[id];
+
     _ctxs[id].ltime = ltime;
 
     if (ltime == 0) {
@@ -125,6 +129,12 @@ gnrc_sixlowpan_ctx_t *gnrc_sixlowpan_ctx_update(uint8_t id, const ipv6_addr_t *p
         ipv6_addr_set_unspecified(&(_ctxs[id].prefix));
         ipv6_addr_init_prefix(&(_ctxs[id].prefix), prefix, _ctxs[id].prefix_len);
     }
+    /* a mere lifetime refresh keeps cached lookup results valid */
+    if ((old.prefix_len != _ctxs[id].prefix_len) ||
+        (old.flags_id != _ctxs[id].flags_id) ||
+        !ipv6_addr_equal(&old.prefix, &_ctxs[id].prefix)) {
+        atomic_fetch_add_u32(&_ctx_gen, 1);
+    }
     DEBUG("6lo ctx: update context (%u, %s/%" PRIu8 "), lifetime: %" PRIu16 " min\n",
           id, ipv6_addr_to_str(ipv6str, &_ctxs[id].prefix, sizeof(ipv6str)),
           _ctxs[id].prefix_len, _ctxs[id].ltime);
@@ -134,6 +144,21 @@ gnrc_sixlowpan_ctx_t *gnrc_sixlowpan_ctx_update(uint8_t id, const ipv6_addr_t *p
     return &(_ctxs[id]);
 }
 
+void gnrc_sixlowpan_ctx_remove(uint8_t id)
+{
+    if (id >= GNRC_SIXLOWPAN_CTX_SIZE) {
+        return;
+    }
+    /* no mutex, so contexts can be removed from a timer callback */
+    _ctxs[id].prefix_len = 0;
+    atomic_fetch_add_u32(&_ctx_gen, 1);
+}
+
+uint32_t gnrc_sixlowpan_ctx_generation(void)
+{
+    return atomic_load_u32(&_ctx_gen);
+}
+
 static uint32_t _current_minute(void)
 {
 #if IS_USED(MODULE_ZTIMER_MSEC)
@@ -170,6 +195,7 @@ static void _update_lifetime(uint8_t id)
 void gnrc_sixlowpan_ctx_reset(void)
 {
     memset(_ctxs, 0, sizeof(_ctxs));
+    atomic_fetch_add_u32(&_ctx_gen, 1);
 }
 #endif
 
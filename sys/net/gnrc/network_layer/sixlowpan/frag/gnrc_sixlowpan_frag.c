@@ -33,6 +33,14 @@
 #define ENABLE_DEBUG 0
 #include "debug.h"
 
+/**
+ * @brief   Train of fragments to be handed to the interface in one message
+ */
+typedef struct {
+    gnrc_pktsnip_t *frags[CONFIG_GNRC_SIXLOWPAN_FRAG_TX_BATCH];
+    unsigned numof;
+} _frag_batch_t;
+
 static inline uint16_t _floor8(uint16_t length)
 {
     return length & 0xfff8U;
@@ -115,6 +123,17 @@ static gnrc_pktsnip_t *_build_frag_pkt(gnrc_pktsnip_t *pkt,
     return gnrc_pkt_prepend(frag, netif);
 }
 
+static void _batch_flush(_frag_batch_t *batch)
+{
+    if (batch->numof == 1) {
+        gnrc_sixlowpan_dispatch_send(batch->frags[0], NULL, 0);
+    }
+    else if (batch->numof > 1) {
+        gnrc_sixlowpan_dispatch_send_batch(batch->frags, batch->numof);
+    }
+    batch->numof = 0;
+}
+
 static uint16_t _copy_pkt_to_frag(uint8_t *data, const gnrc_pktsnip_t *pkt,
                                   uint16_t max_frag_size, uint16_t init_offset)
 {
@@ -133,7 +152,8 @@ static uint16_t _copy_pkt_to_frag(uint8_t *data, const gnrc_pktsnip_t *pkt,
 
 static uint16_t _send_1st_fragment(gnrc_netif_t *iface,
                                    gnrc_sixlowpan_frag_fb_t *fbuf,
-                                   size_t payload_len)
+                                   size_t payload_len,
+                                   _frag_batch_t *batch)
 {
     gnrc_pktsnip_t *frag, *pkt = fbuf->pkt;
     sixlowpan_frag_t *hdr;
@@ -171,14 +191,15 @@ static uint16_t _send_1st_fragment(gnrc_netif_t *iface,
     DEBUG("6lo frag: send first fragment (datagram size: %u, "
           "datagram tag: %" PRIu16 ", fragment size: %" PRIu16 ")\n",
           fbuf->datagram_size, fbuf->tag, local_offset);
-    gnrc_sixlowpan_dispatch_send(frag, NULL, 0);
+    batch->frags[batch->numof++] = frag;
     return local_offset;
 }
 
 static uint16_t _send_nth_fragment(gnrc_netif_t *iface,
                                    gnrc_sixlowpan_frag_fb_t *fbuf,
                                    size_t payload_len,
-                                   gnrc_pktsnip_t **tx_sync)
+                                   gnrc_pktsnip_t **tx_sync,
+                                   _frag_batch_t *batch)
 {
     gnrc_pktsnip_t *frag, *pkt = fbuf->pkt;
     sixlowpan_frag_n_t *hdr;
@@ -237,7 +258,7 @@ static uint16_t _send_nth_fragment(gnrc_netif_t *iface,
           "fragment size: %" PRIu16 ")\n",
           fbuf->datagram_size, fbuf->tag, hdr->offset,
           hdr->offset << 3, local_offset);
-    gnrc_sixlowpan_dispatch_send(frag, NULL, 0);
+    batch->frags[batch->numof++] = frag;
     return local_offset;
 }
 
@@ -247,6 +268,7 @@ void gnrc_sixlowpan_frag_send(gnrc_pktsnip_t *pkt, void *ctx, unsigned page)
     gnrc_sixlowpan_frag_fb_t *fbuf = ctx;
     gnrc_netif_t *iface;
     gnrc_pktsnip_t *tx_sync = NULL;
+    _frag_batch_t batch = { .numof = 0 };
     uint16_t res;
     /* payload_len: actual size of the packet vs
      * datagram_size: size of the uncompressed IPv6 packet */
@@ -271,27 +293,34 @@ void gnrc_sixlowpan_frag_send(gnrc_pktsnip_t *pkt, void *ctx, unsigned page)
         tx_sync = gnrc_tx_sync_split((pkt) ? pkt : fbuf->pkt);
     }
 
-    /* Check whether to send the first or an Nth fragment */
-    if (fbuf->offset == 0) {
-        if ((res = _send_1st_fragment(iface, fbuf, payload_len)) == 0) {
-            /* error sending first fragment */
-            DEBUG("6lo frag: error sending 1st fragment\n");
-            goto error;
+    /* build the next train of fragments */
+    do {
+        /* Check whether to send the first or an Nth fragment */
+        if (fbuf->offset == 0) {
+            if ((res = _send_1st_fragment(iface, fbuf, payload_len,
+                                          &batch)) == 0) {
+                /* error sending first fragment */
+                DEBUG("6lo frag: error sending 1st fragment\n");
+                goto error;
+            }
         }
-    }
-    /* (offset + (datagram_size - payload_len) < datagram_size) simplified */
-    else if (fbuf->offset < payload_len) {
-        if ((res = _send_nth_fragment(iface, fbuf, payload_len, &tx_sync)) == 0) {
-            /* error sending subsequent fragment */
-            DEBUG("6lo frag: error sending subsequent fragment"
-                  "(offset = %u)\n", fbuf->offset);
+        /* (offset + (datagram_size - payload_len) < datagram_size) simplified */
+        else if (fbuf->offset < payload_len) {
+            if ((res = _send_nth_fragment(iface, fbuf, payload_len, &tx_sync,
+                                          &batch)) == 0) {
+                /* error sending subsequent fragment */
+                DEBUG("6lo frag: error sending subsequent fragment"
+                      "(offset = %u)\n", fbuf->offset);
+                goto error;
+            }
+        }
+        else {
             goto error;
         }
-    }
-    else {
-        goto error;
-    }
-    fbuf->offset += res;
+        fbuf->offset += res;
+    } while ((batch.numof < CONFIG_GNRC_SIXLOWPAN_FRAG_TX_BATCH) &&
+             (fbuf->offset < payload_len));
+    _batch_flush(&batch);
     if (!gnrc_sixlowpan_frag_fb_send(fbuf)) {
         DEBUG("6lo frag: message queue full, can't issue next fragment "
               "sending\n");
@@ -305,6 +334,9 @@ void gnrc_sixlowpan_frag_send(gnrc_pktsnip_t *pkt, void *ctx, unsigned page)
     thread_yield();
     return;
 error:
+    /* fragments built so far are sent anyway, as they would have been
+     * without batching */
+    _batch_flush(&batch);
     gnrc_pktbuf_release(fbuf->pkt);
     fbuf->pkt = NULL;
     if (IS_USED(MODULE_GNRC_TX_SYNC) && tx_sync) {
@@ -59,10 +59,32 @@
 #endif  /* IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_MINFWD) */
 #endif
 
+#if !GNRC_SIXLOWPAN_FRAG_RB_BITMAP
 static gnrc_sixlowpan_frag_rb_int_t rbuf_int[RBUF_INT_SIZE];
+#endif  /* !GNRC_SIXLOWPAN_FRAG_RB_BITMAP */
 
 static gnrc_sixlowpan_frag_rb_t rbuf[CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE];
 
+#if CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_BUCKETS > 1
+#define _RBUF_HASH
+
+/* Entries of rbuf chained by the hash of their (src, dst, tag) tuple. All
+ * values are the position in rbuf (or the bucket) + 1, 0 marks the end of a
+ * chain (or an unchained entry). Entries are only moved to another chain when
+ * they are reused, lookups skip the empty entries left in a chain. */
+static uint8_t _rbuf_buckets[CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_BUCKETS];
+static uint8_t _rbuf_next[CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE];
+static uint8_t _rbuf_bucket[CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE];
+static_assert(CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE < UINT8_MAX,
+              "CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE too large for hash index");
+static_assert(CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_BUCKETS < UINT8_MAX,
+              "CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_BUCKETS too large");
+#endif  /* CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_BUCKETS > 1 */
+
+/* earliest time an entry in rbuf may time out, when _rbuf_gc_due is set */
+static uint32_t _rbuf_gc_next;
+static bool _rbuf_gc_due;
+
 static char l2addr_str[3 * IEEE802154_LONG_ADDRESS_LEN];
 
 static xtimer_t _gc_timer;
@@ -74,6 +96,9 @@ static msg_t _gc_timer_msg = { .type = GNRC_SIXLOWPAN_FRAG_RB_GC_MSG };
 /* checks whether start and end overlaps, but not identical to, given interval i */
 static inline bool _rbuf_int_overlap_partially(gnrc_sixlowpan_frag_rb_int_t *i,
                                                uint16_t start, uint16_t end);
+/* checks if a fragment overlaps with or duplicates already received ones */
+static int _check_fragments(gnrc_sixlowpan_frag_rb_base_t *entry,
+                            size_t frag_size, size_t offset);
 /* gets a free entry from interval buffer */
 static gnrc_sixlowpan_frag_rb_int_t *_rbuf_int_get_free(void);
 /* update interval buffer of entry */
@@ -87,6 +112,10 @@ static int _rbuf_get(const void *src, size_t src_len,
 /* gets an entry only by link-layer information and tag */
 static gnrc_sixlowpan_frag_rb_t *_rbuf_get_by_tag(const gnrc_netif_hdr_t *netif_hdr,
                                                   uint16_t tag);
+/* marks that entries may time out from `arrival` on */
+static void _rbuf_gc_schedule(uint32_t arrival);
+/* garbage-collects, if an entry may have timed out */
+static void _rbuf_gc(void);
 /* internal add to repeat add when fragments overlapped */
 static int _rbuf_add(gnrc_netif_hdr_t *netif_hdr, gnrc_pktsnip_t *pkt,
                      size_t offset, unsigned page);
@@ -110,6 +139,145 @@ static int _forward_uncomp(gnrc_pktsnip_t *pkt,
                            unsigned page);
 static int _rbuf_resize_for_reassembly(gnrc_sixlowpan_frag_rb_t *rbuf);
 
+static inline bool _rbuf_matches(const gnrc_sixlowpan_frag_rb_t *e,
+                                 const void *src, size_t src_len,
+                                 const void *dst, size_t dst_len,
+                                 uint16_t tag)
+{
+    return (e->pkt != NULL) && (e->super.tag == tag) &&
+           (e->super.src_len == src_len) &&
+           (e->super.dst_len == dst_len) &&
+           (memcmp(e->super.src, src, src_len) == 0) &&
+           (memcmp(e->super.dst, dst, dst_len) == 0);
+}
+
+#ifdef _RBUF_HASH
+static unsigned _rbuf_hash(const uint8_t *src, size_t src_len,
+                           const uint8_t *dst, size_t dst_len, uint16_t tag)
+{
+    uint32_t hash = tag;
+
+    for (unsigned i = 0; i < src_len; i++) {
+        hash = (hash * 31) + src[i];
+    }
+    for (unsigned i = 0; i < dst_len; i++) {
+        hash = (hash * 31) + dst[i];
+    }
+    hash = ((hash >> 16) ^ hash) * 0x45d9f3bU;
+    hash = (hash >> 16) ^ hash;
+    return hash % CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_BUCKETS;
+}
+
+static void _rbuf_chain(unsigned idx, unsigned bucket)
+{
+    if (_rbuf_bucket[idx] == (bucket + 1)) {
+        return;
+    }
+    if (_rbuf_bucket[idx] != 0) {
+        uint8_t *ptr = &_rbuf_buckets[_rbuf_bucket[idx] - 1];
+
+        while (*ptr != (idx + 1)) {
+            ptr = &_rbuf_next[*ptr - 1];
+        }
+        *ptr = _rbuf_next[idx];
+    }
+    _rbuf_next[idx] = _rbuf_buckets[bucket];
+    _rbuf_buckets[bucket] = idx + 1;
+    _rbuf_bucket[idx] = bucket + 1;
+}
+#endif  /* _RBUF_HASH */
+
+/* gets an entry by its (src, dst, tag) tuple and, unless `any_size` is set,
+ * its datagram size */
+static gnrc_sixlowpan_frag_rb_t *_rbuf_lookup(const void *src, size_t src_len,
+                                              const void *dst, size_t dst_len,
+                                              uint16_t tag, size_t size,
+                                              bool any_size)
+{
+#ifdef _RBUF_HASH
+    unsigned bucket = _rbuf_hash(src, src_len, dst, dst_len, tag);
+
+    for (unsigned i = _rbuf_buckets[bucket]; i > 0; i = _rbuf_next[i - 1]) {
+        gnrc_sixlowpan_frag_rb_t *e = &rbuf[i - 1];
+#else   /* _RBUF_HASH */
+    for (unsigned i = 0; i < CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE; i++) {
+        gnrc_sixlowpan_frag_rb_t *e = &rbuf[i];
+#endif  /* _RBUF_HASH */
+
+        if (_rbuf_matches(e, src, src_len, dst, dst_len, tag) &&
+            (any_size || (e->super.datagram_size == size))) {
+            return e;
+        }
+    }
+    return NULL;
+}
+
+#if GNRC_SIXLOWPAN_FRAG_RB_BITMAP
+static int _rbuf_check_fragments(const gnrc_sixlowpan_frag_rb_t *entry,
+                                 size_t frag_size, size_t offset)
+{
+    const unsigned first = offset / 8U;
+    const unsigned last = (offset + frag_size - 1) / 8U;
+    bool overlaps = false;
+    bool covered = true;
+
+    for (unsigned i = first; i <= last; i++) {
+        if (bf_isset(entry->units, i)) {
+            overlaps = true;
+        }
+        else {
+            covered = false;
+        }
+    }
+    if (!overlaps) {
+        return RBUF_ADD_SUCCESS;
+    }
+    /* a received fragment spans from its start to the next start or the next
+     * missing unit, so an identical fragment starts at `first`, covers all
+     * units up to `last`, and no other fragment starts in between */
+    if (covered && bf_isset(entry->starts, first) &&
+        (((last + 1) >= GNRC_SIXLOWPAN_FRAG_RB_UNITS) ||
+         !bf_isset(entry->units, last + 1) ||
+         bf_isset(entry->starts, last + 1))) {
+        for (unsigned i = first + 1; i <= last; i++) {
+            if (bf_isset(entry->starts, i)) {
+                return RBUF_ADD_REPEAT;
+            }
+        }
+        DEBUG("6lo rbuf: fragment already in reassembly buffer\n");
+        return RBUF_ADD_DUPLICATE;
+    }
+    /* "A fresh reassembly may be commenced with the most recently
+     * received link fragment"
+     * https://tools.ietf.org/html/rfc4944#section-5.3 */
+    return RBUF_ADD_REPEAT;
+}
+
+static bool _rbuf_update_fragments(gnrc_sixlowpan_frag_rb_t *entry,
+                                   size_t offset, size_t frag_size)
+{
+    const unsigned last = (offset + frag_size - 1) / 8U;
+
+    bf_set(entry->starts, offset / 8U);
+    for (unsigned i = offset / 8U; i <= last; i++) {
+        bf_set(entry->units, i);
+    }
+    return true;
+}
+#else   /* GNRC_SIXLOWPAN_FRAG_RB_BITMAP */
+static inline int _rbuf_check_fragments(gnrc_sixlowpan_frag_rb_t *entry,
+                                        size_t frag_size, size_t offset)
+{
+    return _check_fragments(&entry->super, frag_size, offset);
+}
+
+static inline bool _rbuf_update_fragments(gnrc_sixlowpan_frag_rb_t *entry,
+                                          size_t offset, size_t frag_size)
+{
+    return _rbuf_update_ints(&entry->super, offset, frag_size);
+}
+#endif  /* GNRC_SIXLOWPAN_FRAG_RB_BITMAP */
+
 static int _check_fragments(gnrc_sixlowpan_frag_rb_base_t *entry,
                             size_t frag_size, size_t offset)
 {
@@ -186,21 +354,9 @@ static gnrc_sixlowpan_frag_rb_t *_rbuf_get_by_tag(const gnrc_netif_hdr_t *netif_
     assert(netif_hdr != NULL);
     const uint8_t *src = gnrc_netif_hdr_get_src_addr(netif_hdr);
     const uint8_t *dst = gnrc_netif_hdr_get_dst_addr(netif_hdr);
-    const uint8_t src_len = netif_hdr->src_l2addr_len;
-    const uint8_t dst_len = netif_hdr->dst_l2addr_len;
-
-    for (unsigned i = 0; i < CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE; i++) {
-        gnrc_sixlowpan_frag_rb_t *e = &rbuf[i];
 
-        if ((e->pkt != NULL) && (e->super.tag == tag) &&
-            (e->super.src_len == src_len) &&
-            (e->super.dst_len == dst_len) &&
-            (memcmp(e->super.src, src, src_len) == 0) &&
-            (memcmp(e->super.dst, dst, dst_len) == 0)) {
-            return e;
-        }
-    }
-    return NULL;
+    return _rbuf_lookup(src, netif_hdr->src_l2addr_len,
+                        dst, netif_hdr->dst_l2addr_len, tag, 0, true);
 }
 
 #ifndef NDEBUG
@@ -338,7 +494,7 @@ static int _rbuf_add(gnrc_netif_hdr_t *netif_hdr, gnrc_pktsnip_t *pkt,
         return RBUF_ADD_ERROR;
     }
 
-    gnrc_sixlowpan_frag_rb_gc();
+    _rbuf_gc();
     /* only check VRB for subsequent frags, first frags create and not get VRB
      * entries below */
     if (IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_MINFWD) &&
@@ -393,7 +549,7 @@ static int _rbuf_add(gnrc_netif_hdr_t *netif_hdr, gnrc_pktsnip_t *pkt,
         return RBUF_ADD_ERROR;
     }
 
-    switch (_check_fragments(entry.super, frag_size, offset)) {
+    switch (_rbuf_check_fragments(entry.rbuf, frag_size, offset)) {
         case RBUF_ADD_REPEAT:
             DEBUG("6lo rfrag: overlapping intervals, discarding datagram\n");
             gnrc_pktbuf_release(entry.rbuf->pkt);
@@ -406,7 +562,7 @@ static int _rbuf_add(gnrc_netif_hdr_t *netif_hdr, gnrc_pktsnip_t *pkt,
             break;
     }
 
-    if (_rbuf_update_ints(entry.super, offset, frag_size)) {
+    if (_rbuf_update_fragments(entry.rbuf, offset, frag_size)) {
         DEBUG("6lo rbuf: add fragment data\n");
         entry.super->current_size += (uint16_t)frag_size;
         if (offset == 0) {
@@ -514,11 +670,13 @@ static inline bool _rbuf_int_overlap_partially(gnrc_sixlowpan_frag_rb_int_t *i,
 
 static gnrc_sixlowpan_frag_rb_int_t *_rbuf_int_get_free(void)
 {
+#if !GNRC_SIXLOWPAN_FRAG_RB_BITMAP
     for (unsigned int i = 0; i < RBUF_INT_SIZE; i++) {
         if (rbuf_int[i].end == 0) { /* start must be smaller than end anyways*/
             return rbuf_int + i;
         }
     }
+#endif  /* !GNRC_SIXLOWPAN_FRAG_RB_BITMAP */
 
     return NULL;
 }
@@ -526,11 +684,13 @@ static gnrc_sixlowpan_frag_rb_int_t *_rbuf_int_get_free(void)
 #ifdef TEST_SUITES
 bool gnrc_sixlowpan_frag_rb_ints_empty(void)
 {
+#if !GNRC_SIXLOWPAN_FRAG_RB_BITMAP
     for (unsigned int i = 0; i < RBUF_INT_SIZE; i++) {
         if (rbuf_int[i].end > 0) {
             return false;
         }
     }
+#endif  /* !GNRC_SIXLOWPAN_FRAG_RB_BITMAP */
     return true;
 }
 #endif  /* TEST_SUITES */
@@ -577,16 +737,43 @@ static void _gc_pkt(gnrc_sixlowpan_frag_rb_t *rbuf)
     gnrc_pktbuf_release(rbuf->pkt);
 }
 
+static void _rbuf_gc_schedule(uint32_t arrival)
+{
+    uint32_t timeout = arrival + CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_TIMEOUT_US;
+
+    if (!_rbuf_gc_due || ((int32_t)(timeout - _rbuf_gc_next) < 0)) {
+        _rbuf_gc_next = timeout;
+        _rbuf_gc_due = true;
+    }
+}
+
+static void _rbuf_gc(void)
+{
+    /* arrival times only move forward for existing entries, so no entry can
+     * have timed out before _rbuf_gc_next */
+    if (_rbuf_gc_due && ((int32_t)(xtimer_now_usec() - _rbuf_gc_next) > 0)) {
+        gnrc_sixlowpan_frag_rb_gc();
+    }
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_VRB
+    else {
+        gnrc_sixlowpan_frag_vrb_gc();
+    }
+#endif
+}
+
 void gnrc_sixlowpan_frag_rb_gc(void)
 {
     uint32_t now_usec = xtimer_now_usec();
     unsigned int i;
 
+    _rbuf_gc_due = false;
     for (i = 0; i < CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE; i++) {
+        if (gnrc_sixlowpan_frag_rb_entry_empty(&rbuf[i])) {
+            continue;
+        }
         /* since pkt occupies pktbuf, aggressivly collect garbage */
-        if (!gnrc_sixlowpan_frag_rb_entry_empty(&rbuf[i]) &&
-              ((now_usec - rbuf[i].super.arrival) >
-               CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_TIMEOUT_US)) {
+        if ((now_usec - rbuf[i].super.arrival) >
+            CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_TIMEOUT_US) {
             DEBUG("6lo rfrag: entry (%s, ",
                   gnrc_netif_addr_to_str(rbuf[i].super.src,
                                          rbuf[i].super.src_len,
@@ -600,6 +787,9 @@ void gnrc_sixlowpan_frag_rb_gc(void)
             _gc_pkt(&rbuf[i]);
             gnrc_sixlowpan_frag_rb_remove(&(rbuf[i]));
         }
+        else {
+            _rbuf_gc_schedule(rbuf[i].super.arrival);
+        }
     }
 #ifdef MODULE_GNRC_SIXLOWPAN_FRAG_VRB
     gnrc_sixlowpan_frag_vrb_gc();
@@ -620,41 +810,33 @@ static int _rbuf_get(const void *src, size_t src_len,
     gnrc_sixlowpan_frag_rb_t *res = NULL, *oldest = NULL;
     uint32_t now_usec = xtimer_now_usec();
 
-    for (unsigned int i = 0; i < CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE; i++) {
-        /* check first if entry already available */
-        if ((rbuf[i].pkt != NULL) && (rbuf[i].super.tag == tag) &&
-            ((IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_SFR) &&
-              /* not all SFR fragments carry the datagram size, so make 0 a
-               * legal value to not compare datagram size */
-              ((size == 0) || (rbuf[i].super.datagram_size == size))) ||
-             (!IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_SFR) &&
-              (rbuf[i].super.datagram_size == size))) &&
-            (rbuf[i].super.src_len == src_len) &&
-            (rbuf[i].super.dst_len == dst_len) &&
-            (memcmp(rbuf[i].super.src, src, src_len) == 0) &&
-            (memcmp(rbuf[i].super.dst, dst, dst_len) == 0)) {
-            DEBUG("6lo rfrag: entry %p (%s, ", (void *)(&rbuf[i]),
-                  gnrc_netif_addr_to_str(rbuf[i].super.src,
-                                         rbuf[i].super.src_len,
-                                         l2addr_str));
-            DEBUG("%s, %u, %u) found\n",
-                  gnrc_netif_addr_to_str(rbuf[i].super.dst,
-                                         rbuf[i].super.dst_len,
-                                         l2addr_str),
-                  (unsigned)rbuf[i].super.datagram_size, rbuf[i].super.tag);
+    /* check first if entry already available */
+    res = _rbuf_lookup(src, src_len, dst, dst_len, tag, size,
+                       /* not all SFR fragments carry the datagram size, so
+                        * make 0 a legal value to not compare datagram size */
+                       IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_SFR) && (size == 0));
+    if (res != NULL) {
+        DEBUG("6lo rfrag: entry %p (%s, ", (void *)res,
+              gnrc_netif_addr_to_str(res->super.src, res->super.src_len,
+                                     l2addr_str));
+        DEBUG("%s, %u, %u) found\n",
+              gnrc_netif_addr_to_str(res->super.dst, res->super.dst_len,
+                                     l2addr_str),
+              (unsigned)res->super.datagram_size, res->super.tag);
 #if CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_DEL_TIMER > 0
-            if (rbuf[i].super.current_size == 0) {
-                /* ensure that only empty reassembly buffer entries and entries
-                 * scheduled for deletion have `current_size == 0` */
-                DEBUG("6lo rfrag: scheduled for deletion, don't add fragment\n");
-                return -1;
-            }
-#endif
-            rbuf[i].super.arrival = now_usec;
-            _set_rbuf_timeout();
-            return i;
+        if (res->super.current_size == 0) {
+            /* ensure that only empty reassembly buffer entries and entries
+             * scheduled for deletion have `current_size == 0` */
+            DEBUG("6lo rfrag: scheduled for deletion, don't add fragment\n");
+            return -1;
         }
+#endif
+        res->super.arrival = now_usec;
+        _set_rbuf_timeout();
+        return res - &(rbuf[0]);
+    }
 
+    for (unsigned int i = 0; i < CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE; i++) {
         /* if there is a free spot: remember it */
         if ((res == NULL) && gnrc_sixlowpan_frag_rb_entry_empty(&rbuf[i])) {
             res = &(rbuf[i]);
@@ -746,6 +928,14 @@ static int _rbuf_get(const void *src, size_t src_len,
     res->offset_diff = 0U;
     memset(res->received, 0U, sizeof(res->received));
 #endif  /* IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_SFR) */
+#if GNRC_SIXLOWPAN_FRAG_RB_BITMAP
+    memset(res->units, 0U, sizeof(res->units));
+    memset(res->starts, 0U, sizeof(res->starts));
+#endif  /* GNRC_SIXLOWPAN_FRAG_RB_BITMAP */
+#ifdef _RBUF_HASH
+    _rbuf_chain(res - &(rbuf[0]), _rbuf_hash(src, src_len, dst, dst_len, tag));
+#endif  /* _RBUF_HASH */
+    _rbuf_gc_schedule(now_usec);
 
     DEBUG("6lo rfrag: entry %p (%s, ", (void *)res,
           gnrc_netif_addr_to_str(res->super.src, res->super.src_len,
@@ -764,7 +954,9 @@ static int _rbuf_get(const void *src, size_t src_len,
 void gnrc_sixlowpan_frag_rb_reset(void)
 {
     xtimer_remove(&_gc_timer);
+#if !GNRC_SIXLOWPAN_FRAG_RB_BITMAP
     memset(rbuf_int, 0, sizeof(rbuf_int));
+#endif  /* !GNRC_SIXLOWPAN_FRAG_RB_BITMAP */
     for (unsigned int i = 0; i < CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE; i++) {
         if ((rbuf[i].pkt != NULL) &&
             (rbuf[i].pkt->users > 0)) {
@@ -772,6 +964,12 @@ void gnrc_sixlowpan_frag_rb_reset(void)
         }
     }
     memset(rbuf, 0, sizeof(rbuf));
+#ifdef _RBUF_HASH
+    memset(_rbuf_buckets, 0, sizeof(_rbuf_buckets));
+    memset(_rbuf_next, 0, sizeof(_rbuf_next));
+    memset(_rbuf_bucket, 0, sizeof(_rbuf_bucket));
+#endif  /* _RBUF_HASH */
+    _rbuf_gc_due = false;
 }
 
 const gnrc_sixlowpan_frag_rb_t *gnrc_sixlowpan_frag_rb_array(void)
@@ -804,6 +1002,7 @@ static void _tmp_rm(gnrc_sixlowpan_frag_rb_t *rbuf)
         rbuf->super.arrival = xtimer_now_usec() -
                               (CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_TIMEOUT_US -
                                CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_DEL_TIMER);
+        _rbuf_gc_schedule(rbuf->super.arrival);
         /* reset current size to prevent late duplicates to trigger another
          * dispatch */
         rbuf->super.current_size = 0;
@@ -816,12 +1015,18 @@ static void _tmp_rm(gnrc_sixlowpan_frag_rb_t *rbuf)
 static inline unsigned _count_frags(gnrc_sixlowpan_frag_rb_t *rbuf)
 {
     unsigned frags = 0;
+#if GNRC_SIXLOWPAN_FRAG_RB_BITMAP
+    for (unsigned i = 0; i < GNRC_SIXLOWPAN_FRAG_RB_UNITS; i++) {
+        frags += bf_isset(rbuf->starts, i);
+    }
+#else   /* GNRC_SIXLOWPAN_FRAG_RB_BITMAP */
     gnrc_sixlowpan_frag_rb_int_t *frag = rbuf->super.ints;
 
     while (frag) {
         frag = frag->next;
         frags++;
     }
+#endif  /* GNRC_SIXLOWPAN_FRAG_RB_BITMAP */
     return frags;
 }
 #endif
@@ -103,6 +103,22 @@ void gnrc_sixlowpan_dispatch_send(gnrc_pktsnip_t *pkt, void *context,
     }
 }
 
+void gnrc_sixlowpan_dispatch_send_batch(gnrc_pktsnip_t *const *pkts,
+                                        unsigned numof)
+{
+    assert(numof > 0);
+    assert(pkts[0]->type == GNRC_NETTYPE_NETIF);
+    gnrc_netif_hdr_t *hdr = pkts[0]->data;
+    if (gnrc_netif_send_batch(gnrc_netif_get_by_pid(hdr->if_pid),
+                              pkts, numof) < 1) {
+        DEBUG("6lo: unable to send batch of %u packets over interface %u\n",
+              numof, hdr->if_pid);
+        for (unsigned i = 0; i < numof; i++) {
+            gnrc_pktbuf_release(pkts[i]);
+        }
+    }
+}
+
 void gnrc_sixlowpan_multiplex_by_size(gnrc_pktsnip_t *pkt,
                                       size_t orig_datagram_size,
                                       gnrc_netif_t *netif,
@@ -419,6 +435,24 @@ static void *_event_loop(void *args)
                 _send(msg.content.ptr);
                 break;
 
+            case GNRC_NETAPI_MSG_TYPE_RCV_BATCH:
+                DEBUG("6lo: GNRC_NETAPI_MSG_TYPE_RCV_BATCH received\n");
+                for (unsigned i = 0; i < gnrc_netapi_batch_numof(msg.content.ptr);
+                     i++) {
+                    _receive(gnrc_netapi_batch_get(msg.content.ptr, i));
+                }
+                gnrc_pktbuf_release(msg.content.ptr);
+                break;
+
+            case GNRC_NETAPI_MSG_TYPE_SND_BATCH:
+                DEBUG("6lo: GNRC_NETAPI_MSG_TYPE_SND_BATCH received\n");
+                for (unsigned i = 0; i < gnrc_netapi_batch_numof(msg.content.ptr);
+                     i++) {
+                    _send(gnrc_netapi_batch_get(msg.content.ptr, i));
+                }
+                gnrc_pktbuf_release(msg.content.ptr);
+                break;
+
             case GNRC_NETAPI_MSG_TYPE_GET:
             case GNRC_NETAPI_MSG_TYPE_SET:
                 DEBUG("6lo: reply to unsupported get/set\n");
@@ -17,6 +17,7 @@
  */
 
 #include <stdbool.h>
+#include <stddef.h>
 
 #include "byteorder.h"
 #include "net/ipv6/hdr.h"
@@ -154,6 +155,211 @@ static inline bool _context_overlaps_iid(gnrc_sixlowpan_ctx_t *ctx,
              (iid->uint8[(ctx->prefix_len / 8) - 8] & byte_mask[ctx->prefix_len % 8])));
 }
 
+#if CONFIG_GNRC_SIXLOWPAN_IPHC_CACHE_SIZE
+/* dispatch, CID extension, traffic class and flow label, next header, hop
+ * limit and both addresses inline */
+#define IPHC_HDR_MAX_LEN    (SIXLOWPAN_IPHC_HDR_LEN + SIXLOWPAN_IPHC_CID_EXT_LEN + \
+                             4U + 1U + 1U + (2U * sizeof(ipv6_addr_t)))
+
+/* IPv6 header of a flow and its compressed form */
+typedef struct {
+    gnrc_netif_t *iface;        /* NULL if entry is unused */
+    uint32_t ctx_gen;           /* context buffer generation of the entry */
+    ipv6_hdr_t ipv6;            /* payload length is not part of the flow */
+    uint8_t iphc[IPHC_HDR_MAX_LEN];
+    uint8_t iphc_len;
+    /* when sending: address of iface, 0 length if the source address does not
+     * depend on it */
+    uint8_t src_l2addr_len;
+    uint8_t dst_l2addr_len;
+    uint8_t src_l2addr[GNRC_NETIF_L2ADDR_MAXLEN];
+    uint8_t dst_l2addr[GNRC_NETIF_L2ADDR_MAXLEN];
+} _iphc_cache_t;
+
+/* only accessed from the 6LoWPAN thread */
+static _iphc_cache_t _enc_cache[CONFIG_GNRC_SIXLOWPAN_IPHC_CACHE_SIZE];
+static _iphc_cache_t _dec_cache[CONFIG_GNRC_SIXLOWPAN_IPHC_CACHE_SIZE];
+static uint8_t _enc_cache_next;
+static uint8_t _dec_cache_next;
+
+static inline bool _cache_l2addr_equal(const uint8_t *cached,
+                                       uint8_t cached_len,
+                                       const uint8_t *addr, uint8_t addr_len)
+{
+    return (cached_len == addr_len) && (memcmp(cached, addr, addr_len) == 0);
+}
+
+static inline bool _cache_l2addr_set(uint8_t *cached, uint8_t *cached_len,
+                                     const uint8_t *addr, uint8_t addr_len)
+{
+    if (addr_len > GNRC_NETIF_L2ADDR_MAXLEN) {
+        return false;
+    }
+    memcpy(cached, addr, addr_len);
+    *cached_len = addr_len;
+    return true;
+}
+
+static bool _cache_src_l2addr_equal(const _iphc_cache_t *entry,
+                                    gnrc_netif_t *iface)
+{
+    bool res;
+
+    if (entry->src_l2addr_len == 0) {
+        return true;
+    }
+    gnrc_netif_acquire(iface);
+    res = _cache_l2addr_equal(entry->src_l2addr, entry->src_l2addr_len,
+                              iface->l2addr, iface->l2addr_len);
+    gnrc_netif_release(iface);
+    return res;
+}
+
+static bool _cache_ctx_comp(uint8_t id)
+{
+    gnrc_sixlowpan_ctx_t *ctx = gnrc_sixlowpan_ctx_lookup_id(id);
+
+    return (ctx != NULL) && (ctx->flags_id & GNRC_SIXLOWPAN_CTX_FLAGS_COMP);
+}
+
+/* contexts only lose their compression flag when they expire, without a
+ * change of the context buffer generation */
+static bool _cache_ctxs_comp(const uint8_t *iphc_hdr)
+{
+    uint8_t cids = 0;
+
+    if (iphc_hdr[IPHC2_IDX] & SIXLOWPAN_IPHC2_CID_EXT) {
+        cids = iphc_hdr[CID_EXT_IDX];
+    }
+    if ((iphc_hdr[IPHC2_IDX] & SIXLOWPAN_IPHC2_SAC) &&
+        (iphc_hdr[IPHC2_IDX] & SIXLOWPAN_IPHC2_SAM) &&
+        !_cache_ctx_comp(cids >> 4)) {
+        return false;
+    }
+    if ((iphc_hdr[IPHC2_IDX] & SIXLOWPAN_IPHC2_DAC) &&
+        !_cache_ctx_comp(cids & 0x0f)) {
+        return false;
+    }
+    return true;
+}
+
+static inline bool _cache_ipv6_hdr_equal(const ipv6_hdr_t *a,
+                                         const ipv6_hdr_t *b)
+{
+    return (a->v_tc_fl.u32 == b->v_tc_fl.u32) &&
+           (memcmp(&a->nh, &b->nh, sizeof(ipv6_hdr_t) -
+                   offsetof(ipv6_hdr_t, nh)) == 0);
+}
+
+static const _iphc_cache_t *_enc_cache_get(const ipv6_hdr_t *ipv6_hdr,
+                                           const gnrc_netif_hdr_t *netif_hdr,
+                                           gnrc_netif_t *iface,
+                                           uint32_t ctx_gen)
+{
+    for (unsigned i = 0; i < CONFIG_GNRC_SIXLOWPAN_IPHC_CACHE_SIZE; i++) {
+        const _iphc_cache_t *entry = &_enc_cache[i];
+
+        if ((entry->iface == iface) && (entry->ctx_gen == ctx_gen) &&
+            _cache_ipv6_hdr_equal(&entry->ipv6, ipv6_hdr) &&
+            _cache_l2addr_equal(entry->dst_l2addr, entry->dst_l2addr_len,
+                                gnrc_netif_hdr_get_dst_addr(netif_hdr),
+                                netif_hdr->dst_l2addr_len) &&
+            _cache_src_l2addr_equal(entry, iface) &&
+            _cache_ctxs_comp(entry->iphc)) {
+            return entry;
+        }
+    }
+    return NULL;
+}
+
+static void _enc_cache_put(const ipv6_hdr_t *ipv6_hdr,
+                           const gnrc_netif_hdr_t *netif_hdr,
+                           gnrc_netif_t *iface, uint32_t ctx_gen,
+                           const uint8_t *iphc_hdr, size_t iphc_len)
+{
+    _iphc_cache_t *entry = &_enc_cache[_enc_cache_next];
+    bool res = true;
+
+    entry->iface = NULL;
+    if ((iphc_len > sizeof(entry->iphc)) ||
+        !_cache_l2addr_set(entry->dst_l2addr, &entry->dst_l2addr_len,
+                           gnrc_netif_hdr_get_dst_addr(netif_hdr),
+                           netif_hdr->dst_l2addr_len)) {
+        return;
+    }
+    entry->src_l2addr_len = 0;
+    /* source address was compared to the interface identifier of iface */
+    if (iphc_hdr[IPHC2_IDX] & SIXLOWPAN_IPHC2_SAM) {
+        gnrc_netif_acquire(iface);
+        res = (iface->l2addr_len > 0) &&
+              _cache_l2addr_set(entry->src_l2addr, &entry->src_l2addr_len,
+                                iface->l2addr, iface->l2addr_len);
+        gnrc_netif_release(iface);
+    }
+    if (res) {
+        entry->ipv6 = *ipv6_hdr;
+        memcpy(entry->iphc, iphc_hdr, iphc_len);
+        entry->iphc_len = iphc_len;
+        entry->ctx_gen = ctx_gen;
+        entry->iface = iface;
+        _enc_cache_next = (_enc_cache_next + 1) %
+                          CONFIG_GNRC_SIXLOWPAN_IPHC_CACHE_SIZE;
+    }
+}
+
+static const _iphc_cache_t *_dec_cache_get(const uint8_t *iphc_hdr,
+                                           size_t size,
+                                           const gnrc_netif_hdr_t *netif_hdr,
+                                           gnrc_netif_t *iface,
+                                           uint32_t ctx_gen)
+{
+    for (unsigned i = 0; i < CONFIG_GNRC_SIXLOWPAN_IPHC_CACHE_SIZE; i++) {
+        const _iphc_cache_t *entry = &_dec_cache[i];
+
+        /* IPHC headers are self-delimiting, so a matching prefix of the frame
+         * is the same header */
+        if ((entry->iface == iface) && (entry->ctx_gen == ctx_gen) &&
+            (entry->iphc_len <= size) &&
+            (memcmp(entry->iphc, iphc_hdr, entry->iphc_len) == 0) &&
+            _cache_l2addr_equal(entry->src_l2addr, entry->src_l2addr_len,
+                                gnrc_netif_hdr_get_src_addr(netif_hdr),
+                                netif_hdr->src_l2addr_len) &&
+            _cache_l2addr_equal(entry->dst_l2addr, entry->dst_l2addr_len,
+                                gnrc_netif_hdr_get_dst_addr(netif_hdr),
+                                netif_hdr->dst_l2addr_len)) {
+            return entry;
+        }
+    }
+    return NULL;
+}
+
+static void _dec_cache_put(const uint8_t *iphc_hdr, size_t iphc_len,
+                           const gnrc_netif_hdr_t *netif_hdr,
+                           gnrc_netif_t *iface, uint32_t ctx_gen,
+                           const ipv6_hdr_t *ipv6_hdr)
+{
+    _iphc_cache_t *entry = &_dec_cache[_dec_cache_next];
+
+    entry->iface = NULL;
+    if ((iphc_len > sizeof(entry->iphc)) ||
+        !_cache_l2addr_set(entry->src_l2addr, &entry->src_l2addr_len,
+                           gnrc_netif_hdr_get_src_addr(netif_hdr),
+                           netif_hdr->src_l2addr_len) ||
+        !_cache_l2addr_set(entry->dst_l2addr, &entry->dst_l2addr_len,
+                           gnrc_netif_hdr_get_dst_addr(netif_hdr),
+                           netif_hdr->dst_l2addr_len)) {
+        return;
+    }
+    entry->ipv6 = *ipv6_hdr;
+    memcpy(entry->iphc, iphc_hdr, iphc_len);
+    entry->iphc_len = iphc_len;
+    entry->ctx_gen = ctx_gen;
+    entry->iface = iface;
+    _dec_cache_next = (_dec_cache_next + 1) %
+                      CONFIG_GNRC_SIXLOWPAN_IPHC_CACHE_SIZE;
+}
+#endif  /* CONFIG_GNRC_SIXLOWPAN_IPHC_CACHE_SIZE */
+
 static gnrc_pktsnip_t *_iphc_encode(gnrc_pktsnip_t *pkt,
                                     const gnrc_netif_hdr_t *netif_hdr,
                                     gnrc_netif_t *netif);
@@ -165,13 +371,26 @@ static int _forward_frag(gnrc_pktsnip_t *pkt, gnrc_pktsnip_t *frag_hdr,
                          gnrc_sixlowpan_frag_vrb_t *vrbe, unsigned page);
 #endif  /* MODULE_GNRC_SIXLOWPAN_FRAG_VRB */
 
-static size_t _iphc_ipv6_decode(const uint8_t *iphc_hdr,
+static size_t _iphc_ipv6_decode(const uint8_t *iphc_hdr, size_t size,
                                 const gnrc_netif_hdr_t *netif_hdr,
                                 gnrc_netif_t *iface, ipv6_hdr_t *ipv6_hdr)
 {
     gnrc_sixlowpan_ctx_t *ctx = NULL;
     size_t payload_offset = SIXLOWPAN_IPHC_HDR_LEN;
 
+#if CONFIG_GNRC_SIXLOWPAN_IPHC_CACHE_SIZE
+    uint32_t ctx_gen = gnrc_sixlowpan_ctx_generation();
+    const _iphc_cache_t *entry = _dec_cache_get(iphc_hdr, size, netif_hdr,
+                                                iface, ctx_gen);
+
+    if (entry != NULL) {
+        *ipv6_hdr = entry->ipv6;
+        return entry->iphc_len;
+    }
+#else   /* CONFIG_GNRC_SIXLOWPAN_IPHC_CACHE_SIZE */
+    (void)size;
+#endif  /* CONFIG_GNRC_SIXLOWPAN_IPHC_CACHE_SIZE */
+
     if (iphc_hdr[IPHC2_IDX] & SIXLOWPAN_IPHC2_CID_EXT) {
         payload_offset++;
     }
@@ -448,6 +667,12 @@ static size_t _iphc_ipv6_decode(const uint8_t *iphc_hdr,
             DEBUG("6lo iphc: unspecified or reserved M, DAC, DAM combination\n");
             break;
     }
+#if CONFIG_GNRC_SIXLOWPAN_IPHC_CACHE_SIZE
+    if (payload_offset <= size) {
+        _dec_cache_put(iphc_hdr, payload_offset, netif_hdr, iface, ctx_gen,
+                       ipv6_hdr);
+    }
+#endif  /* CONFIG_GNRC_SIXLOWPAN_IPHC_CACHE_SIZE */
     return payload_offset;
 }
 
@@ -565,7 +790,9 @@ static size_t _iphc_nhc_ipv6_decode(gnrc_pktsnip_t *sixlo, size_t offset,
                 }
             }
             ipv6_hdr = (ipv6_hdr_t *)(((uint8_t *)ipv6->data) + *uncomp_hdr_len);
-            tmp = _iphc_ipv6_decode(&payload[offset], netif->data,
+            tmp = _iphc_ipv6_decode(&payload[offset],
+                                    (offset < sixlo->size) ? sixlo->size - offset : 0,
+                                    netif->data,
                                     gnrc_netif_hdr_get_netif(netif->data),
                                     ipv6_hdr);
             if (tmp == 0) {
@@ -773,8 +1000,8 @@ void gnrc_sixlowpan_iphc_recv(gnrc_pktsnip_t *sixlo, void *rbuf_ptr,
     netif = gnrc_pktsnip_search_type(sixlo, GNRC_NETTYPE_NETIF);
     assert(netif != NULL);
     iface = gnrc_netif_hdr_get_netif(netif->data);
-    payload_offset = _iphc_ipv6_decode(iphc_hdr, netif->data, iface,
-                                       ipv6->data);
+    payload_offset = _iphc_ipv6_decode(iphc_hdr, sixlo->size, netif->data,
+                                       iface, ipv6->data);
     if ((payload_offset == 0) || (payload_offset > sixlo->size)) {
         /* unable to parse IPHC header or malicious packet */
         DEBUG("6lo iphc: malformed IPHC header\n");
@@ -1091,6 +1318,17 @@ static size_t _iphc_ipv6_encode(gnrc_pktsnip_t *pkt,
     }
     ipv6_hdr = pkt->next->data;
 
+#if CONFIG_GNRC_SIXLOWPAN_IPHC_CACHE_SIZE
+    uint32_t ctx_gen = gnrc_sixlowpan_ctx_generation();
+    const _iphc_cache_t *entry = _enc_cache_get(ipv6_hdr, netif_hdr, iface,
+                                                ctx_gen);
+
+    if (entry != NULL) {
+        memcpy(iphc_hdr, entry->iphc, entry->iphc_len);
+        return entry->iphc_len;
+    }
+#endif  /* CONFIG_GNRC_SIXLOWPAN_IPHC_CACHE_SIZE */
+
     /* set initial dispatch value*/
     iphc_hdr[IPHC1_IDX] = SIXLOWPAN_IPHC1_DISP;
     iphc_hdr[IPHC2_IDX] = 0;
@@ -1369,6 +1607,9 @@ static size_t _iphc_ipv6_encode(gnrc_pktsnip_t *pkt,
         inline_pos += 16;
     }
 
+#if CONFIG_GNRC_SIXLOWPAN_IPHC_CACHE_SIZE
+    _enc_cache_put(ipv6_hdr, netif_hdr, iface, ctx_gen, iphc_hdr, inline_pos);
+#endif  /* CONFIG_GNRC_SIXLOWPAN_IPHC_CACHE_SIZE */
     return inline_pos;
 }
 
@@ -168,6 +168,13 @@ gnrc_pktsnip_t *gnrc_pktbuf_mark(gnrc_pktsnip_t *pkt, size_t size, gnrc_nettype_
     return new;
 }
 
+size_t gnrc_pktbuf_mark_pad(size_t hdr_len)
+{
+    (void)hdr_len;
+    /* marking only part of a snip always copies, see gnrc_pktbuf_mark() */
+    return 0;
+}
+
 static int _realloc_data(gnrc_pktsnip_t *pkt, size_t size)
 {
     assert(pkt != NULL);
@@ -0,0 +1,556 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup net_gnrc_pktbuf
+ * @{
+ *
+ * @file
+ *
+ * Packet buffer made up of pools of fixed-size blocks (size classes). Each
+ * class keeps its free blocks in a singly linked list, so allocating and
+ * releasing a block takes constant time. gnrc_pktbuf_mark() splits the data
+ * of a snip without copying: every block counts the snips that point into
+ * it and is only returned to its pool when the last of them is released.
+ */
+
+#include <assert.h>
+#include <errno.h>
+#include <inttypes.h>
+#include <stdalign.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/types.h>
+
+#include "architecture.h"
+#include "kernel_defines.h"
+#include "mutex.h"
+#include "net/gnrc/pktbuf.h"
+#include "net/gnrc/nettype.h"
+#include "net/gnrc/pkt.h"
+
+#include "pktbuf_internal.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+#define _SLAB_ALIGN         (sizeof(uint64_t))
+#define _ALIGN(size)        (((size) + _SLAB_ALIGN - 1) & ~(_SLAB_ALIGN - 1))
+
+/* block sizes of the classes, ascending */
+#define _SNIP_SIZE          _ALIGN(sizeof(gnrc_pktsnip_t))
+#define _HDR_SIZE           _ALIGN(CONFIG_GNRC_PKTBUF_SLAB_HDR_SIZE)
+#define _SMALL_SIZE         _ALIGN(CONFIG_GNRC_PKTBUF_SLAB_SMALL_SIZE)
+#define _MTU_SIZE           _ALIGN(CONFIG_GNRC_PKTBUF_SLAB_MTU_SIZE)
+
+/* offsets of the classes in _slab_buf */
+#define _SNIP_OFFSET        (0U)
+#define _HDR_OFFSET         (_SNIP_OFFSET + \
+                             (_SNIP_SIZE * CONFIG_GNRC_PKTBUF_SLAB_SNIP_NUMOF))
+#define _SMALL_OFFSET       (_HDR_OFFSET + \
+                             (_HDR_SIZE * CONFIG_GNRC_PKTBUF_SLAB_HDR_NUMOF))
+#define _MTU_OFFSET         (_SMALL_OFFSET + \
+                             (_SMALL_SIZE * CONFIG_GNRC_PKTBUF_SLAB_SMALL_NUMOF))
+#define _SLAB_BUF_SIZE      (_MTU_OFFSET + \
+                             (_MTU_SIZE * CONFIG_GNRC_PKTBUF_SLAB_MTU_NUMOF))
+
+#define _BLOCKS_NUMOF       (CONFIG_GNRC_PKTBUF_SLAB_SNIP_NUMOF + \
+                             CONFIG_GNRC_PKTBUF_SLAB_HDR_NUMOF + \
+                             CONFIG_GNRC_PKTBUF_SLAB_SMALL_NUMOF + \
+                             CONFIG_GNRC_PKTBUF_SLAB_MTU_NUMOF)
+
+static_assert(_SNIP_SIZE <= _HDR_SIZE,
+              "CONFIG_GNRC_PKTBUF_SLAB_HDR_SIZE must fit a gnrc_pktsnip_t");
+static_assert((_HDR_SIZE < _SMALL_SIZE) && (_SMALL_SIZE < _MTU_SIZE),
+              "gnrc_pktbuf_slab block sizes must be ascending");
+
+enum {
+    _CLASS_SNIP = 0,
+    _CLASS_HDR,
+    _CLASS_SMALL,
+    _CLASS_MTU,
+    _CLASS_NUMOF,
+};
+
+typedef struct _free_block {
+    struct _free_block *next;
+} _free_block_t;
+
+typedef struct {
+    uint32_t offset;        /**< offset of the first block in _slab_buf */
+    uint16_t size;          /**< size of a block */
+    uint16_t numof;         /**< number of blocks */
+    uint16_t first;         /**< index of the first block in _refs */
+} _class_t;
+
+static const _class_t _classes[_CLASS_NUMOF] = {
+    { _SNIP_OFFSET, _SNIP_SIZE, CONFIG_GNRC_PKTBUF_SLAB_SNIP_NUMOF, 0 },
+    { _HDR_OFFSET, _HDR_SIZE, CONFIG_GNRC_PKTBUF_SLAB_HDR_NUMOF,
+      CONFIG_GNRC_PKTBUF_SLAB_SNIP_NUMOF },
+    { _SMALL_OFFSET, _SMALL_SIZE, CONFIG_GNRC_PKTBUF_SLAB_SMALL_NUMOF,
+      CONFIG_GNRC_PKTBUF_SLAB_SNIP_NUMOF + CONFIG_GNRC_PKTBUF_SLAB_HDR_NUMOF },
+    { _MTU_OFFSET, _MTU_SIZE, CONFIG_GNRC_PKTBUF_SLAB_MTU_NUMOF,
+      CONFIG_GNRC_PKTBUF_SLAB_SNIP_NUMOF + CONFIG_GNRC_PKTBUF_SLAB_HDR_NUMOF +
+      CONFIG_GNRC_PKTBUF_SLAB_SMALL_NUMOF },
+};
+
+static alignas(_SLAB_ALIGN) uint8_t _slab_buf[_SLAB_BUF_SIZE];
+static _free_block_t *_free[_CLASS_NUMOF];
+/* number of snips pointing into a block, 0 if the block is free */
+static uint8_t _refs[_BLOCKS_NUMOF];
+
+#ifdef DEVELHELP
+typedef struct {
+    uint16_t used;          /**< blocks currently in use */
+    uint16_t max_used;      /**< maximum number of blocks in use */
+    uint16_t spills;        /**< allocations served by a larger class */
+    uint16_t fails;         /**< allocations that failed */
+} _class_stats_t;
+
+static _class_stats_t _stats[_CLASS_NUMOF];
+/* bytes requested by the snips, i.e. without the unused rest of the blocks */
+static size_t _requested;
+static size_t _max_requested;
+#endif
+
+/* internal gnrc_pktbuf functions */
+static gnrc_pktsnip_t *_create_snip(gnrc_pktsnip_t *next, const void *data, size_t size,
+                                    gnrc_nettype_t type);
+
+static inline void _set_pktsnip(gnrc_pktsnip_t *pkt, gnrc_pktsnip_t *next,
+                                void *data, size_t size, gnrc_nettype_t type)
+{
+    pkt->next = next;
+    pkt->data = data;
+    pkt->size = size;
+    pkt->type = type;
+    pkt->users = 1;
+#ifdef MODULE_GNRC_NETERR
+    pkt->err_sub = KERNEL_PID_UNDEF;
+#endif
+}
+
+static inline void _requested_add(size_t size)
+{
+#ifdef DEVELHELP
+    _requested += size;
+    if (_requested > _max_requested) {
+        _max_requested = _requested;
+    }
+#else
+    (void)size;
+#endif
+}
+
+static inline void _requested_sub(size_t size)
+{
+#ifdef DEVELHELP
+    _requested -= size;
+#else
+    (void)size;
+#endif
+}
+
+static unsigned _class_of(const void *ptr)
+{
+    uint32_t offset = (uintptr_t)ptr - (uintptr_t)_slab_buf;
+    unsigned class = _CLASS_NUMOF - 1;
+
+    while (offset < _classes[class].offset) {
+        class--;
+    }
+    return class;
+}
+
+/* index in _refs of the block ptr points into */
+static unsigned _block_of(unsigned class, const void *ptr)
+{
+    uint32_t offset = (uintptr_t)ptr - (uintptr_t)_slab_buf;
+
+    return _classes[class].first +
+           ((offset - _classes[class].offset) / _classes[class].size);
+}
+
+static uint8_t *_block_start(unsigned class, unsigned block)
+{
+    return &_slab_buf[_classes[class].offset +
+                      ((block - _classes[class].first) * _classes[class].size)];
+}
+
+static void *_block_alloc(unsigned class)
+{
+    _free_block_t *block = _free[class];
+
+    if (block == NULL) {
+        return NULL;
+    }
+    _free[class] = block->next;
+    _refs[_block_of(class, block)] = 1;
+#ifdef DEVELHELP
+    if (++_stats[class].used > _stats[class].max_used) {
+        _stats[class].max_used = _stats[class].used;
+    }
+#endif
+    return block;
+}
+
+static void _block_free(unsigned class, unsigned block)
+{
+    _free_block_t *ptr = (_free_block_t *)(uintptr_t)_block_start(class, block);
+
+    _refs[block] = 0;
+    ptr->next = _free[class];
+    _free[class] = ptr;
+#ifdef DEVELHELP
+    _stats[class].used--;
+#endif
+}
+
+static gnrc_pktsnip_t *_snip_alloc(void)
+{
+    gnrc_pktsnip_t *pkt = _block_alloc(_CLASS_SNIP);
+
+#ifdef DEVELHELP
+    if (pkt == NULL) {
+        _stats[_CLASS_SNIP].fails++;
+    }
+#endif
+    return pkt;
+}
+
+/* snip descriptors have a class of their own, so data is only allocated
+ * from the other classes; if the best fitting class is exhausted the next
+ * larger one is used */
+static void *_data_alloc(size_t size)
+{
+    unsigned class = _CLASS_HDR;
+
+    assert(size > 0);
+    while ((class < _CLASS_NUMOF) && (size > _classes[class].size)) {
+        class++;
+    }
+    if (class == _CLASS_NUMOF) {
+        DEBUG("pktbuf: size (%" PRIuSIZE ") exceeds largest block (%u)\n",
+              size, (unsigned)_MTU_SIZE);
+        return NULL;
+    }
+    for (unsigned i = class; i < _CLASS_NUMOF; i++) {
+        void *data = _block_alloc(i);
+
+        if (data != NULL) {
+#ifdef DEVELHELP
+            if (i != class) {
+                _stats[class].spills++;
+            }
+#endif
+            _requested_add(size);
+            return data;
+        }
+    }
+#ifdef DEVELHELP
+    _stats[class].fails++;
+#endif
+    DEBUG("pktbuf: no block left for %" PRIuSIZE " bytes\n", size);
+    return NULL;
+}
+
+/* checks if the data of pkt can grow to size bytes without moving it */
+static bool _fits_in_place(const gnrc_pktsnip_t *pkt, size_t size)
+{
+    unsigned class, block;
+
+    if (pkt->data == NULL) {
+        return false;
+    }
+    class = _class_of(pkt->data);
+    block = _block_of(class, pkt->data);
+    /* no other snip may point into the block */
+    return (_refs[block] == 1) &&
+           ((((uint8_t *)pkt->data) + size) <=
+            (_block_start(class, block) + _classes[class].size));
+}
+
+void gnrc_pktbuf_init(void)
+{
+    mutex_lock(&gnrc_pktbuf_mutex);
+    memset(_refs, 0, sizeof(_refs));
+    for (unsigned class = 0; class < _CLASS_NUMOF; class++) {
+        unsigned first = _classes[class].first;
+
+        _free[class] = NULL;
+        /* link back to front, so blocks are handed out in address order */
+        for (unsigned i = _classes[class].numof; i > 0; i--) {
+            _block_free(class, first + i - 1);
+        }
+    }
+#ifdef DEVELHELP
+    memset(_stats, 0, sizeof(_stats));
+    _requested = 0;
+    _max_requested = 0;
+#endif
+    mutex_unlock(&gnrc_pktbuf_mutex);
+}
+
+gnrc_pktsnip_t *gnrc_pktbuf_add(gnrc_pktsnip_t *next, const void *data, size_t size,
+                                gnrc_nettype_t type)
+{
+    gnrc_pktsnip_t *pkt;
+
+    if (size > _MTU_SIZE) {
+        DEBUG("pktbuf: size (%" PRIuSIZE ") > CONFIG_GNRC_PKTBUF_SLAB_MTU_SIZE (%u)\n",
+              size, (unsigned)_MTU_SIZE);
+        return NULL;
+    }
+    mutex_lock(&gnrc_pktbuf_mutex);
+    pkt = _create_snip(next, data, size, type);
+    mutex_unlock(&gnrc_pktbuf_mutex);
+    return pkt;
+}
+
+gnrc_pktsnip_t *gnrc_pktbuf_mark(gnrc_pktsnip_t *pkt, size_t size, gnrc_nettype_t type)
+{
+    gnrc_pktsnip_t *marked_snip;
+    void *marked_data;
+
+    mutex_lock(&gnrc_pktbuf_mutex);
+    if ((size == 0) || (pkt == NULL) || (size > pkt->size) || (pkt->data == NULL)) {
+        DEBUG("pktbuf: size == 0 (was %" PRIuSIZE ") or pkt == NULL (was %p) or "
+              "size > pkt->size (was %" PRIuSIZE ") or pkt->data == NULL (was %p)\n",
+              size, (void *)pkt, (pkt ? pkt->size : 0),
+              (pkt ? pkt->data : NULL));
+        mutex_unlock(&gnrc_pktbuf_mutex);
+        return NULL;
+    }
+    marked_snip = _snip_alloc();
+    if (marked_snip == NULL) {
+        DEBUG("pktbuf: could not allocate marked snip.\n");
+        mutex_unlock(&gnrc_pktbuf_mutex);
+        return NULL;
+    }
+    marked_data = pkt->data;
+    if (pkt->size != size) {
+        /* both snips now point into the same block */
+        unsigned block = _block_of(_class_of(pkt->data), pkt->data);
+
+        if (_refs[block] == UINT8_MAX) {
+            DEBUG("pktbuf: block %u split too often.\n", block);
+            gnrc_pktbuf_free_internal(marked_snip, sizeof(gnrc_pktsnip_t));
+            mutex_unlock(&gnrc_pktbuf_mutex);
+            return NULL;
+        }
+        _refs[block]++;
+        pkt->data = ((uint8_t *)pkt->data) + size;
+    }
+    else {
+        pkt->data = NULL;
+    }
+    pkt->size -= size;
+    _set_pktsnip(marked_snip, pkt->next, marked_data, size, type);
+    pkt->next = marked_snip;
+    mutex_unlock(&gnrc_pktbuf_mutex);
+    return marked_snip;
+}
+
+size_t gnrc_pktbuf_mark_pad(size_t hdr_len)
+{
+    (void)hdr_len;
+    /* marking never moves data */
+    return 0;
+}
+
+int gnrc_pktbuf_realloc_data(gnrc_pktsnip_t *pkt, size_t size)
+{
+    mutex_lock(&gnrc_pktbuf_mutex);
+    assert(pkt != NULL);
+    assert(((pkt->size == 0) && (pkt->data == NULL)) ||
+           ((pkt->size > 0) && (pkt->data != NULL) && gnrc_pktbuf_contains(pkt->data)));
+    if (size == pkt->size) {
+        /* nothing to do */
+        mutex_unlock(&gnrc_pktbuf_mutex);
+        return 0;
+    }
+    if (size == 0) {
+        gnrc_pktbuf_free_internal(pkt->data, pkt->size);
+        pkt->data = NULL;
+    }
+    else if (size < pkt->size) {
+        /* the rest of the block stays with the snip */
+        _requested_sub(pkt->size - size);
+    }
+    else if (_fits_in_place(pkt, size)) {
+        _requested_add(size - pkt->size);
+    }
+    else {
+        void *new_data = _data_alloc(size);
+
+        if (new_data == NULL) {
+            DEBUG("pktbuf: error allocating new data section\n");
+            mutex_unlock(&gnrc_pktbuf_mutex);
+            return ENOMEM;
+        }
+        if (pkt->data != NULL) {
+            memcpy(new_data, pkt->data, pkt->size);
+        }
+        gnrc_pktbuf_free_internal(pkt->data, pkt->size);
+        pkt->data = new_data;
+    }
+    pkt->size = size;
+    mutex_unlock(&gnrc_pktbuf_mutex);
+    return 0;
+}
+
+void gnrc_pktbuf_hold(gnrc_pktsnip_t *pkt, unsigned int num)
+{
+    mutex_lock(&gnrc_pktbuf_mutex);
+    while (pkt) {
+        pkt->users += num;
+        pkt = pkt->next;
+    }
+    mutex_unlock(&gnrc_pktbuf_mutex);
+}
+
+gnrc_pktsnip_t *gnrc_pktbuf_start_write(gnrc_pktsnip_t *pkt)
+{
+    mutex_lock(&gnrc_pktbuf_mutex);
+    if (pkt == NULL) {
+        mutex_unlock(&gnrc_pktbuf_mutex);
+        return NULL;
+    }
+    if (pkt->users > 1) {
+        gnrc_pktsnip_t *new;
+        new = _create_snip(pkt->next, pkt->data, pkt->size, pkt->type);
+        if (new != NULL) {
+            pkt->users--;
+        }
+        mutex_unlock(&gnrc_pktbuf_mutex);
+        return new;
+    }
+    mutex_unlock(&gnrc_pktbuf_mutex);
+    return pkt;
+}
+
+#ifdef DEVELHELP
+void gnrc_pktbuf_stats(void)
+{
+    static const char *names[_CLASS_NUMOF] = { "snip", "hdr", "small", "mtu" };
+    size_t reserved = 0;
+
+    printf("packet buffer: %u bytes in %u blocks\n",
+           (unsigned)sizeof(_slab_buf), (unsigned)_BLOCKS_NUMOF);
+    puts("  class  size  used/total  max used  spills  fails");
+    for (unsigned class = 0; class < _CLASS_NUMOF; class++) {
+        printf("  %-5s  %4u  %4u/%-5u  %8u  %6u  %5u\n", names[class],
+               _classes[class].size, _stats[class].used, _classes[class].numof,
+               _stats[class].max_used, _stats[class].spills,
+               _stats[class].fails);
+        if (class != _CLASS_SNIP) {
+            reserved += _stats[class].used * _classes[class].size;
+        }
+    }
+    /* blocks are never shared between packets, so the unused rest of the
+     * data blocks is the only fragmentation there is */
+    printf("  data: %" PRIuSIZE " of %" PRIuSIZE " reserved bytes requested "
+           "(max. %" PRIuSIZE ")\n", _requested, reserved, _max_requested);
+}
+#endif
+
+#ifdef TEST_SUITES
+bool gnrc_pktbuf_is_empty(void)
+{
+    for (unsigned i = 0; i < _BLOCKS_NUMOF; i++) {
+        if (_refs[i] != 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool gnrc_pktbuf_is_sane(void)
+{
+    for (unsigned class = 0; class < _CLASS_NUMOF; class++) {
+        unsigned free = 0;
+
+        /* every block in the free list is a block of its class not in use */
+        for (_free_block_t *ptr = _free[class]; ptr != NULL; ptr = ptr->next) {
+            uint32_t offset = (uintptr_t)ptr - (uintptr_t)_slab_buf;
+
+            if (!gnrc_pktbuf_contains(ptr) || (_class_of(ptr) != class) ||
+                (((offset - _classes[class].offset) % _classes[class].size) != 0) ||
+                (_refs[_block_of(class, ptr)] != 0) ||
+                (++free > _classes[class].numof)) {
+                return false;
+            }
+        }
+        /* ... and every block not in use is in the free list */
+        for (unsigned i = 0; i < _classes[class].numof; i++) {
+            if (_refs[_classes[class].first + i] == 0) {
+                free--;
+            }
+        }
+        if (free != 0) {
+            return false;
+        }
+    }
+    return true;
+}
+#endif
+
+static gnrc_pktsnip_t *_create_snip(gnrc_pktsnip_t *next, const void *data, size_t size,
+                                    gnrc_nettype_t type)
+{
+    gnrc_pktsnip_t *pkt = _snip_alloc();
+    void *_data = NULL;
+
+    if (pkt == NULL) {
+        DEBUG("pktbuf: error allocating new packet snip\n");
+        return NULL;
+    }
+    if (size > 0) {
+        _data = _data_alloc(size);
+        if (_data == NULL) {
+            DEBUG("pktbuf: error allocating data for new packet snip\n");
+            gnrc_pktbuf_free_internal(pkt, sizeof(gnrc_pktsnip_t));
+            return NULL;
+        }
+        if (data != NULL) {
+            memcpy(_data, data, size);
+        }
+    }
+    _set_pktsnip(pkt, next, _data, size, type);
+    return pkt;
+}
+
+void gnrc_pktbuf_free_internal(void *data, size_t size)
+{
+    unsigned class, block;
+
+    if (!gnrc_pktbuf_contains(data)) {
+        return;
+    }
+    class = _class_of(data);
+    block = _block_of(class, data);
+    assert(_refs[block] > 0);
+    if (class != _CLASS_SNIP) {
+        _requested_sub(size);
+    }
+    if (--_refs[block] == 0) {
+        _block_free(class, block);
+    }
+}
+
+bool gnrc_pktbuf_contains(void *ptr)
+{
+    const uintptr_t start = (uintptr_t)_slab_buf;
+    const uintptr_t end = start + sizeof(_slab_buf);
+    uintptr_t pos = (uintptr_t)ptr;
+    return ((pos >= start) && (pos < end));
+}
+
+/** @} */
@@ -166,6 +166,11 @@ gnrc_pktsnip_t *gnrc_pktbuf_mark(gnrc_pktsnip_t *pkt, size_t size, gnrc_nettype_
     return marked_snip;
 }
 
+size_t gnrc_pktbuf_mark_pad(size_t hdr_len)
+{
+    return _align(hdr_len) - hdr_len;
+}
+
 int gnrc_pktbuf_realloc_data(gnrc_pktsnip_t *pkt, size_t size)
 {
     size_t aligned_size = _align(size);
@@ -270,6 +275,17 @@ static inline void _print_unused(_unused_t *ptr)
 
 void gnrc_pktbuf_stats(void)
 {
+    size_t unused = 0, largest = 0;
+    unsigned holes = 0;
+
+    for (_unused_t *ptr = _first_unused; ptr != NULL; ptr = ptr->next) {
+        unused += ptr->size;
+        largest = (ptr->size > largest) ? ptr->size : largest;
+        holes++;
+    }
+    printf("packet buffer: %" PRIuSIZE " of %u bytes unused in %u holes "
+           "(largest: %" PRIuSIZE ")\n", unused, CONFIG_GNRC_PKTBUF_SIZE, holes,
+           largest);
 #ifdef MODULE_OD
     _unused_t *ptr = _first_unused;
     uint8_t *chunk = &_static_buf[0];
@@ -63,6 +63,20 @@ extern "C" {
 #define CONFIG_GNRC_SOCK_UDP_CHECK_REMOTE_ADDR (1)
 #endif
 
+/**
+ * @brief   Track dynamic UDP ports in use in a bitmap
+ *
+ * With `gnrc_sock_check_reuse`, a random dynamic port is checked against all
+ * UDP socks before it is used. With this option the ports in use are kept in
+ * a bitmap instead, so allocating a port no longer depends on the number of
+ * socks. If the random port is in use, the next free port is taken (RFC 6056,
+ * section 3.3.1). The bitmap costs @ref GNRC_SOCK_DYN_PORTRANGE_NUM / 8 bytes
+ * of RAM.
+ */
+#ifndef CONFIG_GNRC_SOCK_UDP_PORT_BITMAP
+#define CONFIG_GNRC_SOCK_UDP_PORT_BITMAP 0
+#endif
+
 /**
  * @brief   Structure to retrieve auxiliary data from @ref gnrc_sock_recv
  *
@@ -35,8 +35,78 @@
 
 #ifdef MODULE_GNRC_SOCK_CHECK_REUSE
 static sock_udp_t *_udp_socks = NULL;
-#endif
 
+/**
+ * @brief   Checks if a sock occupies its port for all addresses
+ */
+static bool _any_addr(const sock_udp_t *sock)
+{
+    const uint8_t *const p = (uint8_t *)&sock->local.addr;
+
+    for (unsigned i = 0; i < sizeof(sock->local.addr); i++) {
+        if (p[i] != 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+#if IS_ACTIVE(CONFIG_GNRC_SOCK_UDP_PORT_BITMAP)
+#include "bitfield.h"
+
+#define _PORT_BITMAP
+/* dynamic ports in use by socks bound to any address */
+static BITFIELD(_dyn_ports, GNRC_SOCK_DYN_PORTRANGE_NUM);
+
+static bool _is_dyn_port(uint16_t port)
+{
+    static_assert(GNRC_SOCK_DYN_PORTRANGE_MAX == UINT16_MAX,
+                  "dynamic port range must end with the highest port");
+    return port >= GNRC_SOCK_DYN_PORTRANGE_MIN;
+}
+
+/**
+ * @brief   Returns the offset of a free dynamic port, searching from the
+ *          bitmap byte holding @p idx on and wrapping around, or -1 if all
+ *          dynamic ports are used
+ */
+static int _next_free_dyn_port(unsigned idx)
+{
+    unsigned start = idx & ~7U;
+    int res = bf_find_first_unset(&_dyn_ports[start / 8],
+                                  GNRC_SOCK_DYN_PORTRANGE_NUM - start);
+
+    if (res >= 0) {
+        return start + res;
+    }
+    return bf_find_first_unset(_dyn_ports, start);
+}
+
+static void _dyn_port_add(const sock_udp_t *sock)
+{
+    if (_is_dyn_port(sock->local.port) && _any_addr(sock)) {
+        bf_set(_dyn_ports, sock->local.port - GNRC_SOCK_DYN_PORTRANGE_MIN);
+    }
+}
+
+static void _dyn_port_remove(const sock_udp_t *sock)
+{
+    if (!_is_dyn_port(sock->local.port) || !_any_addr(sock)) {
+        return;
+    }
+    /* the port may be shared with SOCK_FLAGS_REUSE_EP */
+    for (sock_udp_t *ptr = _udp_socks; ptr != NULL;
+         ptr = (sock_udp_t *)ptr->reg.next) {
+        if ((ptr->local.port == sock->local.port) && _any_addr(ptr)) {
+            return;
+        }
+    }
+    bf_unset(_dyn_ports, sock->local.port - GNRC_SOCK_DYN_PORTRANGE_MIN);
+}
+#endif /* CONFIG_GNRC_SOCK_UDP_PORT_BITMAP */
+#endif /* MODULE_GNRC_SOCK_CHECK_REUSE */
+
+#ifndef _PORT_BITMAP
 /**
  * @brief   Checks if a given UDP port is already used by another sock
  */
@@ -45,14 +115,7 @@ static bool _dyn_port_used(uint16_t port)
 #ifdef MODULE_GNRC_SOCK_CHECK_REUSE
     for (sock_udp_t *ptr = _udp_socks; ptr != NULL;
          ptr = (sock_udp_t *)ptr->reg.next) {
-        bool spec_addr = false;
-        for (unsigned i = 0; i < sizeof(ptr->local.addr); i++) {
-            const uint8_t *const p = (uint8_t *)&ptr->local.addr;
-            if (p[i] != 0) {
-                spec_addr = true;
-            }
-        }
-        if (spec_addr) {
+        if (!_any_addr(ptr)) {
             continue;
         }
         if (ptr->local.port == port) {
@@ -60,20 +123,38 @@ static bool _dyn_port_used(uint16_t port)
             return true;
         }
     }
+    return false;
 #else
     (void) port;
-#endif /* MODULE_GNRC_SOCK_CHECK_REUSE */
     return false;
+#endif
 }
+#endif /* !_PORT_BITMAP */
 
 /**
  * @brief   returns a UDP port, and checks for reuse if required
  *
  * implements "Another Simple Port Randomization Algorithm" as specified in
  * RFC 6056, see https://tools.ietf.org/html/rfc6056#section-3.3.2
+ *
+ * With @ref CONFIG_GNRC_SOCK_UDP_PORT_BITMAP, a used random port is replaced
+ * by the next free one instead ("Simple Port Randomization Algorithm", see
+ * https://tools.ietf.org/html/rfc6056#section-3.3.1).
  */
 static uint16_t _get_dyn_port(sock_udp_t *sock)
 {
+#ifdef _PORT_BITMAP
+    int idx = random_uint32() % GNRC_SOCK_DYN_PORTRANGE_NUM;
+
+    if (!(sock && (sock->flags & SOCK_FLAGS_REUSE_EP)) &&
+        bf_isset(_dyn_ports, idx)) {
+        idx = _next_free_dyn_port(idx);
+        if (idx < 0) {
+            return GNRC_SOCK_DYN_PORTRANGE_ERR;
+        }
+    }
+    return GNRC_SOCK_DYN_PORTRANGE_MIN + idx;
+#else
     unsigned count = GNRC_SOCK_DYN_PORTRANGE_NUM;
     do {
         uint16_t port = GNRC_SOCK_DYN_PORTRANGE_MIN +
@@ -84,6 +165,7 @@ static uint16_t _get_dyn_port(sock_udp_t *sock)
         --count;
     } while (count > 0);
     return GNRC_SOCK_DYN_PORTRANGE_ERR;
+#endif
 }
 
 int sock_udp_create(sock_udp_t *sock, const sock_udp_ep_t *local,
@@ -105,6 +187,8 @@ int sock_udp_create(sock_udp_t *sock, const sock_udp_ep_t *local,
             return -EAFNOSUPPORT;
         }
         if (port == 0U) {
+            /* _get_dyn_port() checks the flags for SOCK_FLAGS_REUSE_EP */
+            sock->flags = flags;
             port = _get_dyn_port(sock);
             if (port == GNRC_SOCK_DYN_PORTRANGE_ERR) {
                 return -EADDRINUSE;
@@ -125,6 +209,9 @@ int sock_udp_create(sock_udp_t *sock, const sock_udp_ep_t *local,
 #endif
         memcpy(&sock->local, local, sizeof(sock_udp_ep_t));
         sock->local.port = port;
+#ifdef _PORT_BITMAP
+        _dyn_port_add(sock);
+#endif
     }
     memset(&sock->remote, 0, sizeof(sock_udp_ep_t));
     if (remote != NULL) {
@@ -159,7 +246,11 @@ void sock_udp_close(sock_udp_t *sock)
     if (_udp_socks != NULL) {
         gnrc_sock_reg_t *head = (gnrc_sock_reg_t *)_udp_socks;
         LL_DELETE(head, (gnrc_sock_reg_t *)sock);
+        _udp_socks = (sock_udp_t *)head;
     }
+#ifdef _PORT_BITMAP
+    _dyn_port_remove(sock);
+#endif
 #endif
 }
 
@@ -413,6 +504,9 @@ ssize_t sock_udp_sendv_aux(sock_udp_t *sock,
             /* prepend to current socks */
             sock->reg.next = (gnrc_sock_reg_t *)_udp_socks;
             _udp_socks = sock;
+#ifdef _PORT_BITMAP
+            _dyn_port_add(sock);
+#endif
 #endif /* MODULE_GNRC_SOCK_CHECK_REUSE */
         }
     }
@@ -49,6 +49,10 @@
  */
 static evtimer_t _tcp_mbox_timer;
 
+#if IS_USED(MODULE_NETSTATS_TCP)
+netstats_tcp_t gnrc_tcp_netstats;
+#endif
+
 static void _sched_mbox(evtimer_mbox_event_t *event, uint32_t offset,
                         uint16_t type, mbox_t *mbox)
 {
@@ -706,7 +710,7 @@ ssize_t gnrc_tcp_send(gnrc_tcp_tcb_t *tcb, const void *data, const size_t len,
     }
 
     /* Loop until something was sent and acked */
-    while (ret == 0 || tcb->pkt_retransmit != NULL) {
+    while (ret == 0 || tcb->pkt_retransmit_numof > 0) {
         state = _gnrc_tcp_fsm_get_state(tcb);
 
         /* Check if the connections state is closed. If so, a reset was received */
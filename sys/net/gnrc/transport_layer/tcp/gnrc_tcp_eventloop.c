@@ -323,6 +323,13 @@ static void *_eventloop(__attribute__((unused)) void *arg)
                               FSM_EVENT_TIMEOUT_RETRANSMIT, NULL, NULL, 0);
                 break;
 
+            /* Delayed acknowledgment timer expired: Call FSM with delayed ack event */
+            case MSG_TYPE_DELAYED_ACK:
+                TCP_DEBUG_INFO("Received MSG_TYPE_DELAYED_ACK.");
+                _gnrc_tcp_fsm((gnrc_tcp_tcb_t *)msg.content.ptr,
+                              FSM_EVENT_TIMEOUT_DELAYED_ACK, NULL, NULL, 0);
+                break;
+
             /* Timewait timer expired: Call FSM with timewait event */
             case MSG_TYPE_TIMEWAIT:
                 TCP_DEBUG_INFO("Received MSG_TYPE_TIMEWAIT.");
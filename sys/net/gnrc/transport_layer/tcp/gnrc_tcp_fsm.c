@@ -43,6 +43,19 @@
  */
 #define TCB_EQUAL(a, b)      ((a) != (b))
 
+/**
+ * @brief Number of duplicate acknowledgments triggering a fast retransmit.
+ *
+ * @note With N segments in flight, the peer sends at most N - 1 duplicate
+ *       acknowledgments. The threshold is lowered for small send queues,
+ *       so that fast retransmit still works (see RFC 5827).
+ */
+#if CONFIG_GNRC_TCP_DUP_ACK_THRESHOLD < CONFIG_GNRC_TCP_SND_QUEUE_SIZE
+#define DUP_ACK_THRESHOLD    (CONFIG_GNRC_TCP_DUP_ACK_THRESHOLD)
+#else
+#define DUP_ACK_THRESHOLD    (CONFIG_GNRC_TCP_SND_QUEUE_SIZE - 1)
+#endif
+
 /**
  * @brief Checks if a given port number is currently used by a TCB as local_port.
  *
@@ -92,15 +105,96 @@ static uint16_t _get_random_local_port(void)
 static int _clear_retransmit(gnrc_tcp_tcb_t *tcb)
 {
     TCP_DEBUG_ENTER;
-    if (tcb->pkt_retransmit != NULL) {
+    if (tcb->pkt_retransmit_numof > 0) {
         _gnrc_tcp_eventloop_unsched(&tcb->event_retransmit);
-        gnrc_pktbuf_release(tcb->pkt_retransmit);
-        tcb->pkt_retransmit = NULL;
+        for (uint8_t i = 0; i < tcb->pkt_retransmit_numof; i++) {
+            gnrc_pktbuf_release(tcb->pkt_retransmit[i]);
+        }
+        tcb->pkt_retransmit_numof = 0;
     }
+    tcb->pkt_sacked = 0;
+    tcb->retries = 0;
+    tcb->dup_acks = 0;
+    tcb->status &= ~(STATUS_RTT_PENDING | STATUS_RECOVERY);
     TCP_DEBUG_LEAVE;
     return 0;
 }
 
+/**
+ * @brief Calculates the maximum payload size of segments sent to the peer.
+ *
+ * @param[in] tcb   TCB holding the connection information.
+ *
+ * @return   Maximum payload size in bytes.
+ */
+static uint32_t _get_snd_mss(const gnrc_tcp_tcb_t *tcb)
+{
+    return (tcb->mss < CONFIG_GNRC_TCP_MSS) ? tcb->mss : CONFIG_GNRC_TCP_MSS;
+}
+
+/**
+ * @brief Initializes the congestion window after connection setup.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ */
+static void _init_cwnd(gnrc_tcp_tcb_t *tcb)
+{
+    uint32_t mss = _get_snd_mss(tcb);
+
+    /* Initial window is min(4 * MSS, max(2 * MSS, 4380)) (see RFC 3390) */
+    tcb->snd_cwnd = (2 * mss > 4380) ? 2 * mss : 4380;
+    if (tcb->snd_cwnd > 4 * mss) {
+        tcb->snd_cwnd = 4 * mss;
+    }
+    tcb->snd_ssthresh = UINT32_MAX;
+}
+
+/**
+ * @brief Opens the congestion window after new data was acknowledged.
+ *
+ * @param[in,out] tcb     TCB holding the connection information.
+ * @param[in]     acked   Number of newly acknowledged bytes.
+ */
+static void _open_cwnd(gnrc_tcp_tcb_t *tcb, uint32_t acked)
+{
+    uint32_t mss = _get_snd_mss(tcb);
+
+    /* Slow start: Increase by up to one MSS per acknowledgment (see RFC 5681) */
+    if (tcb->snd_cwnd < tcb->snd_ssthresh) {
+        tcb->snd_cwnd += (acked < mss) ? acked : mss;
+    }
+    /* Congestion avoidance: Increase by about one MSS per round trip */
+    else if (tcb->snd_cwnd > 0) {
+        tcb->snd_cwnd += (mss * mss > tcb->snd_cwnd) ? (mss * mss) / tcb->snd_cwnd : 1;
+    }
+
+    /* The peer can't announce a larger window */
+    if (tcb->snd_cwnd > UINT16_MAX) {
+        tcb->snd_cwnd = UINT16_MAX;
+    }
+}
+
+/**
+ * @brief Shrinks the congestion window after a segment was lost.
+ *
+ * @param[in,out] tcb       TCB holding the connection information.
+ * @param[in]     timeout   Flag marking that the loss was detected by the
+ *                          retransmission timer instead of duplicate
+ *                          acknowledgments.
+ */
+static void _shrink_cwnd(gnrc_tcp_tcb_t *tcb, bool timeout)
+{
+    uint32_t mss = _get_snd_mss(tcb);
+    uint32_t flight = tcb->snd_nxt - tcb->snd_una;
+
+    tcb->snd_ssthresh = (flight / 2 > 2 * mss) ? flight / 2 : 2 * mss;
+    tcb->snd_cwnd = (timeout) ? mss : tcb->snd_ssthresh;
+
+    /* Segments sent so far are retransmitted on partial acknowledgments (see RFC 6582) */
+    tcb->snd_recover = tcb->snd_nxt;
+    tcb->status |= STATUS_RECOVERY;
+}
+
 /**
  * @brief Restarts timewait timer.
  *
@@ -151,6 +245,11 @@ static int _transition_to(gnrc_tcp_tcb_t *tcb, _gnrc_tcp_fsm_state_t state)
             /* Clear retransmit queue */
             _clear_retransmit(tcb);
 
+            /* Drop data received out of order and pending acknowledgements */
+            _gnrc_tcp_rcvbuf_ooo_clear(tcb);
+            _gnrc_tcp_eventloop_unsched(&tcb->event_ack);
+            tcb->ack_pending = 0;
+
             /* Close connection if not listenng */
             if (!(tcb->status & STATUS_LISTENING))
             {
@@ -281,6 +380,7 @@ static int _fsm_call_open(gnrc_tcp_tcb_t *tcb)
     }
     else {
         /* Active Open, set TCB values, send SYN, T: CLOSED -> SYN_SENT */
+        tcb->status &= ~(STATUS_SACK_PERMITTED);
         tcb->iss = random_uint32();
         tcb->snd_nxt = tcb->iss;
         tcb->snd_una = tcb->iss;
@@ -317,27 +417,39 @@ static int _fsm_call_open(gnrc_tcp_tcb_t *tcb)
 static int _fsm_call_send(gnrc_tcp_tcb_t *tcb, void *buf, size_t len)
 {
     TCP_DEBUG_ENTER;
-    size_t payload = (tcb->snd_una + tcb->snd_wnd) - tcb->snd_nxt;
+    size_t sent = 0;
+    uint32_t mss = _get_snd_mss(tcb);
+    uint32_t wnd = (tcb->snd_wnd < tcb->snd_cwnd) ? tcb->snd_wnd : tcb->snd_cwnd;
+
+    /* Send segments as long as the window is open and the retransmit queue has room */
+    while (sent < len && tcb->pkt_retransmit_numof < CONFIG_GNRC_TCP_SND_QUEUE_SIZE) {
+        uint32_t in_flight = tcb->snd_nxt - tcb->snd_una;
+        if (in_flight >= wnd) {
+            break;
+        }
 
-    /* Check if window is open and all packets were transmitted */
-    if (payload > 0 && tcb->snd_wnd > 0 && tcb->pkt_retransmit == NULL) {
         /* Calculate segment size */
-        payload = (payload < CONFIG_GNRC_TCP_MSS) ? payload : CONFIG_GNRC_TCP_MSS;
-        payload = (payload < tcb->mss) ? payload : tcb->mss;
-        payload = (payload < len) ? payload : len;
+        size_t payload = wnd - in_flight;
+        payload = (payload < mss) ? payload : mss;
+        payload = (payload < len - sent) ? payload : len - sent;
+
+        /* Avoid sending small segments while waiting for acknowledgments (see RFC 1122) */
+        if (payload == 0 || (in_flight > 0 && payload < mss && payload < len - sent)) {
+            break;
+        }
 
-        /* Calculate payload size for this segment */
         gnrc_pktsnip_t *out_pkt = NULL;
         uint16_t seq_con = 0;
-        _gnrc_tcp_pkt_build(tcb, &out_pkt, &seq_con, MSK_ACK | MSK_PSH,
-                            tcb->snd_nxt, tcb->rcv_nxt, buf, payload);
+        if (_gnrc_tcp_pkt_build(tcb, &out_pkt, &seq_con, MSK_ACK | MSK_PSH, tcb->snd_nxt,
+                                tcb->rcv_nxt, (uint8_t *)buf + sent, payload) < 0) {
+            break;
+        }
         _gnrc_tcp_pkt_setup_retransmit(tcb, out_pkt, false);
         _gnrc_tcp_pkt_send(tcb, out_pkt, seq_con, false);
-        TCP_DEBUG_LEAVE;
-        return payload;
+        sent += payload;
     }
     TCP_DEBUG_LEAVE;
-    return 0;
+    return sent;
 }
 
 /**
@@ -468,6 +580,11 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
     snp = gnrc_pktsnip_search_type(in_pkt, GNRC_NETTYPE_TCP);
     tcp_hdr_t *tcp_hdr = (tcp_hdr_t *) snp->data;
 
+    /* Forget options negotiated with previous peers */
+    if (tcb->state == FSM_STATE_LISTEN) {
+        tcb->status &= ~(STATUS_SACK_PERMITTED);
+    }
+
     /* Parse packet options, return if they are malformed */
     if (_gnrc_tcp_option_parse(tcb, tcp_hdr) < 0) {
         TCP_DEBUG_ERROR("Failed to parse TCP header options.");
@@ -646,6 +763,7 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
             tcb->snd_wnd = seg_wnd;
             tcb->snd_wl1 = seg_seq;
             tcb->snd_wl2 = seg_ack;
+            _init_cwnd(tcb);
         }
         TCP_DEBUG_LEAVE;
         return 0;
@@ -698,6 +816,7 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
                     tcb->snd_wnd = seg_wnd;
                     tcb->snd_wl1 = seg_seq;
                     tcb->snd_wl2 = seg_ack;
+                    _init_cwnd(tcb);
                     _transition_to(tcb, FSM_STATE_ESTABLISHED);
                 }
                 else {
@@ -712,8 +831,21 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
                 tcb->state == FSM_STATE_CLOSING || tcb->state == FSM_STATE_LAST_ACK) {
                 /* Acknowledge previously sent data */
                 if (LSS_32_BIT(tcb->snd_una, seg_ack) && LEQ_32_BIT(seg_ack, tcb->snd_nxt)) {
+                    _open_cwnd(tcb, seg_ack - tcb->snd_una);
                     tcb->snd_una = seg_ack;
+                    tcb->dup_acks = 0;
                     _gnrc_tcp_pkt_acknowledge(tcb, seg_ack);
+
+                    /* Partial acknowledgment during loss recovery: Retransmit next hole */
+                    if ((tcb->status & STATUS_RECOVERY) && LSS_32_BIT(seg_ack, tcb->snd_recover)) {
+                        _gnrc_tcp_pkt_fast_retransmit(tcb);
+                    }
+                    else {
+                        tcb->status &= ~(STATUS_RECOVERY);
+                    }
+
+                    /* Signal user after the retransmit queue shrunk */
+                    tcb->status |= STATUS_NOTIFY_USER;
                 }
                 /* ACK received for something not yet sent: Reply with pure ACK */
                 else if (LSS_32_BIT(tcb->snd_nxt, seg_ack)) {
@@ -723,6 +855,14 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
                     TCP_DEBUG_LEAVE;
                     return 0;
                 }
+                /* Duplicate ACK: Retransmit lost segments early (see RFC 5681) */
+                else if (seg_ack == tcb->snd_una && pay_len == 0 && seg_wnd == tcb->snd_wnd &&
+                         !(ctl & (MSK_SYN | MSK_FIN)) && tcb->pkt_retransmit_numof > 0) {
+                    if ((DUP_ACK_THRESHOLD > 0) && (++tcb->dup_acks == DUP_ACK_THRESHOLD)) {
+                        _shrink_cwnd(tcb, false);
+                        _gnrc_tcp_pkt_fast_retransmit(tcb);
+                    }
+                }
                 /* Update receive window */
                 if (LEQ_32_BIT(tcb->snd_una, seg_ack) && LEQ_32_BIT(seg_ack, tcb->snd_nxt)) {
                     if (LSS_32_BIT(tcb->snd_wl1, seg_seq) || (tcb->snd_wl1 == seg_seq &&
@@ -738,25 +878,25 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
                 /* Additional processing */
                 /* Check additionally if previously sent FIN was acknowledged */
                 if (tcb->state == FSM_STATE_FIN_WAIT_1) {
-                    if (tcb->pkt_retransmit == NULL) {
+                    if (tcb->pkt_retransmit_numof == 0) {
                         _transition_to(tcb, FSM_STATE_FIN_WAIT_2);
                     }
                 }
                 /* If retransmission queue is empty, acknowledge close operation */
                 if (tcb->state == FSM_STATE_FIN_WAIT_2) {
-                    if (tcb->pkt_retransmit == NULL) {
+                    if (tcb->pkt_retransmit_numof == 0) {
                         /* Optional: Unblock user close operation */
                     }
                 }
                 /* If our FIN has been acknowledged: Transition to TIME_WAIT */
                 if (tcb->state == FSM_STATE_CLOSING) {
-                    if (tcb->pkt_retransmit == NULL) {
+                    if (tcb->pkt_retransmit_numof == 0) {
                         _transition_to(tcb, FSM_STATE_TIME_WAIT);
                     }
                 }
                 /* If our FIN was acknowledged and status is LAST_ACK: close connection */
                 if (tcb->state == FSM_STATE_LAST_ACK) {
-                    if (tcb->pkt_retransmit == NULL) {
+                    if (tcb->pkt_retransmit_numof == 0) {
                         _transition_to(tcb, FSM_STATE_CLOSED);
                         TCP_DEBUG_LEAVE;
                         return 0;
@@ -772,27 +912,49 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
             /* Check if state is valid for payload receiving */
             if (tcb->state == FSM_STATE_ESTABLISHED || tcb->state == FSM_STATE_FIN_WAIT_1 ||
                 tcb->state == FSM_STATE_FIN_WAIT_2) {
+                /* Acknowledge every second segment and everything unusual at once */
+                bool ack_now = tcb->ack_pending || CONFIG_GNRC_TCP_DELAYED_ACK_MS == 0;
+
                 /* Search for begin of payload */
                 snp = gnrc_pktsnip_search_type(in_pkt, GNRC_NETTYPE_UNDEF);
 
-                /* Accept only data that is expected, to be received */
+                /* Accept data that is expected, to be received */
                 if (tcb->rcv_nxt == seg_seq) {
                     /* Copy contents into receive buffer */
                     while (snp && snp->type == GNRC_NETTYPE_UNDEF) {
                         tcb->rcv_nxt += ringbuffer_add(&(tcb->rcv_buf), snp->data, snp->size);
                         snp = snp->next;
                     }
+                    /* Append data that was received out of order, if a gap was filled */
+                    if (tcb->pkt_ooo_numof > 0) {
+                        _gnrc_tcp_rcvbuf_ooo_merge(tcb);
+                        ack_now = true;
+                    }
                     /* Shrink receive window */
                     tcb->rcv_wnd = ringbuffer_get_free(&(tcb->rcv_buf));
                     /* Notify owner because new data is available */
                     tcb->status |= STATUS_NOTIFY_USER;
                 }
+                /* Keep data behind a gap, a duplicate ACK reports the gap to the peer */
+                else {
+                    if (!(ctl & MSK_FIN)) {
+                        _gnrc_tcp_rcvbuf_ooo_add(tcb, in_pkt);
+                    }
+                    ack_now = true;
+                }
                 /* Send ACK, if FIN processing sends ACK already */
                 /* NOTE: this is the place to add payload piggybagging in the future */
                 if (!(ctl & MSK_FIN)) {
-                    _gnrc_tcp_pkt_build(tcb, &out_pkt, &seq_con, MSK_ACK,
-                                        tcb->snd_nxt, tcb->rcv_nxt, NULL, 0);
-                    _gnrc_tcp_pkt_send(tcb, out_pkt, seq_con, false);
+                    if (ack_now) {
+                        _gnrc_tcp_pkt_build(tcb, &out_pkt, &seq_con, MSK_ACK,
+                                            tcb->snd_nxt, tcb->rcv_nxt, NULL, 0);
+                        _gnrc_tcp_pkt_send(tcb, out_pkt, seq_con, false);
+                    }
+                    else {
+                        tcb->ack_pending = 1;
+                        _gnrc_tcp_eventloop_sched(&tcb->event_ack, CONFIG_GNRC_TCP_DELAYED_ACK_MS,
+                                                  MSG_TYPE_DELAYED_ACK, tcb);
+                    }
                 }
             }
         }
@@ -803,6 +965,14 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
                 TCP_DEBUG_LEAVE;
                 return 0;
             }
+            /* Preceding data is missing: Ignore FIN, acknowledge data received so far */
+            if (LSS_32_BIT(tcb->rcv_nxt, seg_seq + pay_len)) {
+                _gnrc_tcp_pkt_build(tcb, &out_pkt, &seq_con, MSK_ACK, tcb->snd_nxt,
+                                    tcb->rcv_nxt, NULL, 0);
+                _gnrc_tcp_pkt_send(tcb, out_pkt, seq_con, false);
+                TCP_DEBUG_LEAVE;
+                return 0;
+            }
             /* Advance rcv_nxt over FIN bit */
             tcb->rcv_nxt = seg_seq + seg_len;
             _gnrc_tcp_pkt_build(tcb, &out_pkt, &seq_con, MSK_ACK, tcb->snd_nxt,
@@ -813,7 +983,7 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
                 _transition_to(tcb, FSM_STATE_CLOSE_WAIT);
             }
             else if (tcb->state == FSM_STATE_FIN_WAIT_1) {
-                if (tcb->pkt_retransmit == NULL) {
+                if (tcb->pkt_retransmit_numof == 0) {
                     _transition_to(tcb, FSM_STATE_TIME_WAIT);
                 }
                 else {
@@ -857,9 +1027,18 @@ static int _fsm_timeout_timewait(gnrc_tcp_tcb_t *tcb)
 static int _fsm_timeout_retransmit(gnrc_tcp_tcb_t *tcb)
 {
     TCP_DEBUG_ENTER;
-    if (tcb->pkt_retransmit != NULL) {
-        _gnrc_tcp_pkt_setup_retransmit(tcb, tcb->pkt_retransmit, true);
-        _gnrc_tcp_pkt_send(tcb, tcb->pkt_retransmit, 0, true);
+    if (tcb->pkt_retransmit_numof > 0) {
+        /* Shrink congestion window on the first timeout, forget SACK information */
+        if (tcb->retries == 0) {
+            _shrink_cwnd(tcb, true);
+        }
+        tcb->pkt_sacked = 0;
+        tcb->dup_acks = 0;
+
+        /* Retransmit oldest packet */
+        TCP_NETSTATS_INC(tx_retransmit_count);
+        _gnrc_tcp_pkt_setup_retransmit(tcb, tcb->pkt_retransmit[0], true);
+        _gnrc_tcp_pkt_send(tcb, tcb->pkt_retransmit[0], 0, true);
     }
     else {
         TCP_DEBUG_INFO("Retransmission queue is empty.");
@@ -868,6 +1047,29 @@ static int _fsm_timeout_retransmit(gnrc_tcp_tcb_t *tcb)
     return 0;
 }
 
+/**
+ * @brief FSM handling function for delayed acknowledgements.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ *
+ * @returns   Zero on success.
+ */
+static int _fsm_timeout_delayed_ack(gnrc_tcp_tcb_t *tcb)
+{
+    TCP_DEBUG_ENTER;
+    gnrc_pktsnip_t *out_pkt = NULL;
+    uint16_t seq_con = 0;
+
+    /* Timer may fire after the ACK was sent with another segment */
+    if (tcb->ack_pending) {
+        _gnrc_tcp_pkt_build(tcb, &out_pkt, &seq_con, MSK_ACK, tcb->snd_nxt, tcb->rcv_nxt,
+                            NULL, 0);
+        _gnrc_tcp_pkt_send(tcb, out_pkt, seq_con, false);
+    }
+    TCP_DEBUG_LEAVE;
+    return 0;
+}
+
 /**
  * @brief FSM handling function for connection timeout handling.
  *
@@ -967,6 +1169,9 @@ static int _fsm_unprotected(gnrc_tcp_tcb_t *tcb, _gnrc_tcp_fsm_event_t event,
         case FSM_EVENT_TIMEOUT_CONNECTION :
             ret = _fsm_timeout_connection(tcb);
             break;
+        case FSM_EVENT_TIMEOUT_DELAYED_ACK :
+            ret = _fsm_timeout_delayed_ack(tcb);
+            break;
         case FSM_EVENT_SEND_PROBE :
             ret = _fsm_send_probe(tcb);
             break;
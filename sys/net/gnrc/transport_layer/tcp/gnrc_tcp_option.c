@@ -18,6 +18,7 @@
  */
 #include "include/gnrc_tcp_common.h"
 #include "include/gnrc_tcp_option.h"
+#include "include/gnrc_tcp_pkt.h"
 
 #define ENABLE_DEBUG 0
 #include "debug.h"
@@ -64,6 +65,39 @@ int _gnrc_tcp_option_parse(gnrc_tcp_tcb_t *tcb, tcp_hdr_t *hdr)
                 tcb->mss = (option->value[0] << 8) | option->value[1];
                 break;
 
+            case TCP_OPTION_KIND_SACK_PERMITTED:
+                if (opt_left < TCP_OPTION_LENGTH_MIN || option->length > opt_left ||
+                    option->length != TCP_OPTION_LENGTH_SACK_PERMITTED) {
+                    TCP_DEBUG_ERROR("Invalid SACK-permitted option length.");
+                    TCP_DEBUG_LEAVE;
+                    return -1;
+                }
+                TCP_DEBUG_INFO("SACK-permitted option found.");
+                if (IS_ACTIVE(CONFIG_GNRC_TCP_SACK_EN) &&
+                    (byteorder_ntohs(hdr->off_ctl) & MSK_SYN)) {
+                    tcb->status |= STATUS_SACK_PERMITTED;
+                }
+                break;
+
+            case TCP_OPTION_KIND_SACK:
+                if (opt_left < TCP_OPTION_LENGTH_MIN || option->length > opt_left ||
+                    option->length < TCP_OPTION_LENGTH_MIN + TCP_OPTION_LENGTH_SACK_BLOCK ||
+                    (option->length - TCP_OPTION_LENGTH_MIN) % TCP_OPTION_LENGTH_SACK_BLOCK) {
+                    TCP_DEBUG_ERROR("Invalid SACK option length.");
+                    TCP_DEBUG_LEAVE;
+                    return -1;
+                }
+                TCP_DEBUG_INFO("SACK option found.");
+                if (tcb->status & STATUS_SACK_PERMITTED) {
+                    for (uint8_t *block = option->value;
+                         block < opt_ptr + option->length;
+                         block += TCP_OPTION_LENGTH_SACK_BLOCK) {
+                        _gnrc_tcp_pkt_sack(tcb, byteorder_bebuftohl(block),
+                                           byteorder_bebuftohl(block + 4));
+                    }
+                }
+                break;
+
             default:
                 if (opt_left >= TCP_OPTION_LENGTH_MIN) {
                     TCP_DEBUG_INFO("Valid, unsupported option found.");
@@ -28,6 +28,7 @@
 #include "include/gnrc_tcp_eventloop.h"
 #include "include/gnrc_tcp_option.h"
 #include "include/gnrc_tcp_pkt.h"
+#include "include/gnrc_tcp_rcvbuf.h"
 
 #ifdef MODULE_GNRC_IPV6
 #include "net/gnrc/ipv6.h"
@@ -36,6 +37,11 @@
 #define ENABLE_DEBUG 0
 #include "debug.h"
 
+/**
+ * @brief Maximum number of blocks in a SACK option, limited by the option space.
+ */
+#define SACK_BLOCKS_MAX (4U)
+
 /**
  * @brief Calculates the maximum of two unsigned numbers.
  *
@@ -155,6 +161,9 @@ int _gnrc_tcp_pkt_build(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t **out_pkt,
     gnrc_pktsnip_t *tcp_snp = NULL;
     tcp_hdr_t tcp_hdr;
     uint8_t offset = TCP_HDR_OFFSET_MIN;
+    bool sack_permitted = false;
+    uint32_t sack_edges[2 * SACK_BLOCKS_MAX];
+    unsigned sack_blocks = 0;
 
     /* Add payload, if supplied */
     if (payload != NULL && payload_len > 0) {
@@ -180,6 +189,19 @@ int _gnrc_tcp_pkt_build(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t **out_pkt,
     /* Add MSS option if SYN is sent */
     if (ctl & MSK_SYN) {
         offset += 1;
+
+        /* Offer SACK, reply to an offer of the peer only if it was made */
+        if (IS_ACTIVE(CONFIG_GNRC_TCP_SACK_EN) &&
+            (!(ctl & MSK_ACK) || (tcb->status & STATUS_SACK_PERMITTED))) {
+            sack_permitted = true;
+            offset += 1;
+        }
+    }
+    /* Report data received out of order on pure ACKs, if the peer accepts SACK */
+    else if ((ctl & MSK_ACK) && payload_len == 0 && (tcb->status & STATUS_SACK_PERMITTED) &&
+             tcb->pkt_ooo_numof > 0) {
+        sack_blocks = _gnrc_tcp_rcvbuf_ooo_sack(tcb, sack_edges, SACK_BLOCKS_MAX);
+        offset += 1 + 2 * sack_blocks;
     }
     /* Set offset and control bit accordingly */
     tcp_hdr.off_ctl = byteorder_htons(
@@ -217,6 +239,28 @@ int _gnrc_tcp_pkt_build(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t **out_pkt,
                     _gnrc_tcp_option_build_mss(CONFIG_GNRC_TCP_MSS));
 
                 memcpy(opt_ptr, &mss_option, sizeof(mss_option));
+                opt_ptr += sizeof(mss_option);
+            }
+            /* Add SACK-permitted option if SACK is offered */
+            if (sack_permitted) {
+                network_uint32_t sack_option = byteorder_htonl(
+                    _gnrc_tcp_option_build_sack_permitted());
+
+                memcpy(opt_ptr, &sack_option, sizeof(sack_option));
+            }
+            /* Add SACK option if data was received out of order */
+            if (sack_blocks > 0) {
+                network_uint32_t sack_option = byteorder_htonl(
+                    _gnrc_tcp_option_build_sack(sack_blocks));
+
+                memcpy(opt_ptr, &sack_option, sizeof(sack_option));
+                opt_ptr += sizeof(sack_option);
+                for (unsigned i = 0; i < 2 * sack_blocks; i++) {
+                    network_uint32_t edge = byteorder_htonl(sack_edges[i]);
+
+                    memcpy(opt_ptr, &edge, sizeof(edge));
+                    opt_ptr += sizeof(edge);
+                }
             }
             /* Increase opt_ptr and decrease opt_left, if other options are added */
             /* NOTE: Add additional options here */
@@ -287,12 +331,26 @@ int _gnrc_tcp_pkt_send(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *out_pkt,
 
     /* If this is no retransmission, advance sequence number and measure time */
     if (!retransmit) {
-        tcb->retries = 0;
+        /* Every segment carries an ACK, a delayed ACK is obsolete now */
+        if (tcb->ack_pending) {
+            tcb->ack_pending = 0;
+            _gnrc_tcp_eventloop_unsched(&tcb->event_ack);
+            TCP_NETSTATS_INC(tx_ack_coalesced);
+        }
+        if (seq_con == 0) {
+            TCP_NETSTATS_INC(tx_ack_count);
+        }
+        /* Only one segment at a time is used for rtt estimation */
+        if (seq_con > 0 && !(tcb->status & STATUS_RTT_PENDING)) {
+            tcb->status |= STATUS_RTT_PENDING;
+            tcb->rtt_seq = tcb->snd_nxt + seq_con;
+            tcb->rtt_start = evtimer_now_msec();
+        }
         tcb->snd_nxt += seq_con;
-        tcb->rtt_start = evtimer_now_msec();
     }
     else {
-        tcb->retries += 1;
+        /* Karns algorithm: retransmitted segments are not used for rtt estimation */
+        tcb->status &= ~(STATUS_RTT_PENDING);
     }
 
     /* Pass packet down the network stack */
@@ -363,6 +421,15 @@ uint32_t _gnrc_tcp_pkt_get_seg_len(gnrc_pktsnip_t *pkt)
     return seq;
 }
 
+uint32_t _gnrc_tcp_pkt_get_seq_num(gnrc_pktsnip_t *pkt)
+{
+    TCP_DEBUG_ENTER;
+    gnrc_pktsnip_t *snp = gnrc_pktsnip_search_type(pkt, GNRC_NETTYPE_TCP);
+    assert(snp != NULL);
+    TCP_DEBUG_LEAVE;
+    return byteorder_ntohl(((tcp_hdr_t *) snp->data)->seq_num);
+}
+
 uint32_t _gnrc_tcp_pkt_get_pay_len(gnrc_pktsnip_t *pkt)
 {
     TCP_DEBUG_ENTER;
@@ -376,6 +443,46 @@ uint32_t _gnrc_tcp_pkt_get_pay_len(gnrc_pktsnip_t *pkt)
     return seg_len;
 }
 
+/**
+ * @brief Updates the retransmission timeout.
+ *
+ * @param[in,out] tcb       TCB holding the connection information.
+ * @param[in]     backoff   Flag to double the timeout after a retransmission.
+ */
+static void _update_rto(gnrc_tcp_tcb_t *tcb, const bool backoff)
+{
+    if (!backoff) {
+        /* If there is no rtt estimation yet: rto is 1 sec (Lower Bound) */
+        if (tcb->srtt == RTO_UNINITIALIZED || tcb->rtt_var == RTO_UNINITIALIZED) {
+            tcb->rto = CONFIG_GNRC_TCP_RTO_LOWER_BOUND_MS;
+        }
+        else {
+            tcb->rto = tcb->srtt + _max(CONFIG_GNRC_TCP_RTO_GRANULARITY_MS,
+                                        CONFIG_GNRC_TCP_RTO_K * tcb->rtt_var);
+        }
+    }
+    else {
+        /* If this is a retransmission: Double the rto (Timer Backoff) */
+        tcb->rto *= 2;
+
+        /* If the transmission has been tried five times, we assume srtt and rtt_var are bogus */
+        /* New measurements must be taken the next time something is sent. */
+        if (tcb->retries >= 5) {
+            tcb->srtt = RTO_UNINITIALIZED;
+            tcb->rtt_var = RTO_UNINITIALIZED;
+        }
+        tcb->retries += 1;
+    }
+
+    /* Perform boundary checks on current RTO before usage */
+    if (tcb->rto < (int32_t) CONFIG_GNRC_TCP_RTO_LOWER_BOUND_MS) {
+        tcb->rto = CONFIG_GNRC_TCP_RTO_LOWER_BOUND_MS;
+    }
+    else if (tcb->rto > (int32_t) CONFIG_GNRC_TCP_RTO_UPPER_BOUND_MS) {
+        tcb->rto = CONFIG_GNRC_TCP_RTO_UPPER_BOUND_MS;
+    }
+}
+
 int _gnrc_tcp_pkt_setup_retransmit(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt,
                                    const bool retransmit)
 {
@@ -391,13 +498,6 @@ int _gnrc_tcp_pkt_setup_retransmit(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt,
         return -EINVAL;
     }
 
-    /* Check if retransmit queue is full and pkt is not already in retransmit queue */
-    if (tcb->pkt_retransmit != NULL && tcb->pkt_retransmit != pkt) {
-        TCP_DEBUG_ERROR("-ENOMEM: Retransmit queue is full.");
-        TCP_DEBUG_LEAVE;
-        return -ENOMEM;
-    }
-
     /* Extract control bits and segment length */
     snp = gnrc_pktsnip_search_type(pkt, GNRC_NETTYPE_TCP);
     if (snp == NULL) {
@@ -415,41 +515,28 @@ int _gnrc_tcp_pkt_setup_retransmit(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt,
         return 0;
     }
 
-    /* Assign pkt and increase users: every send attempt consumes a user */
-    tcb->pkt_retransmit = pkt;
-    gnrc_pktbuf_hold(pkt, 1);
-
-    /* RTO adjustment */
+    /* New packets are appended to the retransmit queue, if it is not full */
     if (!retransmit) {
-        /* If this is the first transmission: rto is 1 sec (Lower Bound) */
-        if (tcb->srtt == RTO_UNINITIALIZED || tcb->rtt_var == RTO_UNINITIALIZED) {
-            tcb->rto = CONFIG_GNRC_TCP_RTO_LOWER_BOUND_MS;
-        }
-        else {
-            tcb->rto = tcb->srtt + _max(CONFIG_GNRC_TCP_RTO_GRANULARITY_MS,
-                                        CONFIG_GNRC_TCP_RTO_K * tcb->rtt_var);
+        if (tcb->pkt_retransmit_numof >= CONFIG_GNRC_TCP_SND_QUEUE_SIZE) {
+            TCP_DEBUG_ERROR("-ENOMEM: Retransmit queue is full.");
+            TCP_DEBUG_LEAVE;
+            return -ENOMEM;
         }
+        tcb->pkt_retransmit[tcb->pkt_retransmit_numof++] = pkt;
     }
-    else {
-        /* If this is a retransmission: Double the rto (Timer Backoff) */
-        tcb->rto *= 2;
 
-        /* If the transmission has been tried five times, we assume srtt and rtt_var are bogus */
-        /* New measurements must be taken the next time something is sent. */
-        if (tcb->retries >= 5) {
-            tcb->srtt = RTO_UNINITIALIZED;
-            tcb->rtt_var = RTO_UNINITIALIZED;
-        }
-    }
+    /* Increase users: every send attempt consumes a user */
+    gnrc_pktbuf_hold(pkt, 1);
 
-    /* Perform boundary checks on current RTO before usage */
-    if (tcb->rto < (int32_t) CONFIG_GNRC_TCP_RTO_LOWER_BOUND_MS) {
-        tcb->rto = CONFIG_GNRC_TCP_RTO_LOWER_BOUND_MS;
-    }
-    else if (tcb->rto > (int32_t) CONFIG_GNRC_TCP_RTO_UPPER_BOUND_MS) {
-        tcb->rto = CONFIG_GNRC_TCP_RTO_UPPER_BOUND_MS;
+    /* The retransmission timer of the oldest packet in the queue is already running */
+    if (!retransmit && tcb->pkt_retransmit_numof > 1) {
+        TCP_DEBUG_LEAVE;
+        return 0;
     }
 
+    /* RTO adjustment */
+    _update_rto(tcb, retransmit);
+
     /* Setup retransmission timer, msg to TCP thread with ptr to TCB */
     _gnrc_tcp_eventloop_sched(&tcb->event_retransmit, tcb->rto,
                               MSG_TYPE_RETRANSMISSION, tcb);
@@ -460,41 +547,47 @@ int _gnrc_tcp_pkt_setup_retransmit(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt,
 int _gnrc_tcp_pkt_acknowledge(gnrc_tcp_tcb_t *tcb, const uint32_t ack)
 {
     TCP_DEBUG_ENTER;
-    uint32_t seg = 0;
-    gnrc_pktsnip_t *snp = NULL;
-    tcp_hdr_t *hdr;
+    uint8_t acked = 0;
 
     /* Retransmission queue is empty. Nothing to ACK there */
-    if (tcb->pkt_retransmit == NULL) {
+    if (tcb->pkt_retransmit_numof == 0) {
         TCP_DEBUG_ERROR("-ENODATA: No packet to acknowledge.");
         TCP_DEBUG_LEAVE;
         return -ENODATA;
     }
 
-    snp = gnrc_pktsnip_search_type(tcb->pkt_retransmit, GNRC_NETTYPE_TCP);
-    if (snp == NULL) {
-        TCP_DEBUG_ERROR("-EINVAL: snp == NULL.");
-        TCP_DEBUG_LEAVE;
-        return -EINVAL;
-    }
+    /* Release all packets from pktbuf that are acknowledged completely */
+    while (acked < tcb->pkt_retransmit_numof) {
+        gnrc_pktsnip_t *pkt = tcb->pkt_retransmit[acked];
+        uint32_t seg = _gnrc_tcp_pkt_get_seq_num(pkt) + _gnrc_tcp_pkt_get_seg_len(pkt) - 1;
 
-    hdr = (tcp_hdr_t *) snp->data;
+        if (!LSS_32_BIT(seg, ack)) {
+            break;
+        }
+        gnrc_pktbuf_release(pkt);
+        acked++;
+    }
 
-    /* There must be a packet, waiting to be acknowledged. */
-    seg = byteorder_ntohl(hdr->seq_num) + _gnrc_tcp_pkt_get_seg_len(
-        tcb->pkt_retransmit) - 1;
+    if (acked == 0) {
+        TCP_DEBUG_LEAVE;
+        return 0;
+    }
 
-        /* If segment can be acknowledged -> stop timer, release packet from pktbuf and update rto. */
-    if (LSS_32_BIT(seg, ack)) {
-        _gnrc_tcp_eventloop_unsched(&tcb->event_retransmit);
-        gnrc_pktbuf_release(tcb->pkt_retransmit);
-        tcb->pkt_retransmit = NULL;
+    /* Remove acknowledged packets from the retransmit queue */
+    tcb->pkt_retransmit_numof -= acked;
+    memmove(tcb->pkt_retransmit, &tcb->pkt_retransmit[acked],
+            tcb->pkt_retransmit_numof * sizeof(tcb->pkt_retransmit[0]));
+    tcb->pkt_sacked >>= acked;
+    tcb->retries = 0;
 
-        /* Measure round trip time */
+    /* Measure round trip time, if the timed segment was acknowledged */
+    if ((tcb->status & STATUS_RTT_PENDING) && LEQ_32_BIT(tcb->rtt_seq, ack)) {
         int32_t rtt = evtimer_now_msec() - tcb->rtt_start;
 
-        /* Use time only if there was no timer overflow and no retransmission (Karns Algorithm) */
-        if (tcb->retries == 0 && rtt > 0) {
+        tcb->status &= ~(STATUS_RTT_PENDING);
+
+        /* Use time only if there was no timer overflow */
+        if (rtt > 0) {
             /* If this is the first sample taken */
             if (tcb->srtt == RTO_UNINITIALIZED && tcb->rtt_var == RTO_UNINITIALIZED) {
                 tcb->srtt = rtt;
@@ -509,10 +602,55 @@ int _gnrc_tcp_pkt_acknowledge(gnrc_tcp_tcb_t *tcb, const uint32_t ack)
             }
         }
     }
+
+    /* Restart retransmission timer for the oldest packet not acknowledged yet */
+    _gnrc_tcp_eventloop_unsched(&tcb->event_retransmit);
+    if (tcb->pkt_retransmit_numof > 0) {
+        _update_rto(tcb, false);
+        _gnrc_tcp_eventloop_sched(&tcb->event_retransmit, tcb->rto,
+                                  MSG_TYPE_RETRANSMISSION, tcb);
+    }
     TCP_DEBUG_LEAVE;
     return 0;
 }
 
+void _gnrc_tcp_pkt_sack(gnrc_tcp_tcb_t *tcb, const uint32_t left, const uint32_t right)
+{
+    TCP_DEBUG_ENTER;
+    for (uint8_t i = 0; i < tcb->pkt_retransmit_numof; i++) {
+        gnrc_pktsnip_t *pkt = tcb->pkt_retransmit[i];
+        uint32_t seq = _gnrc_tcp_pkt_get_seq_num(pkt);
+
+        if (LEQ_32_BIT(left, seq) &&
+            LEQ_32_BIT(seq + _gnrc_tcp_pkt_get_seg_len(pkt), right)) {
+            tcb->pkt_sacked |= (1UL << i);
+        }
+    }
+    TCP_DEBUG_LEAVE;
+}
+
+unsigned _gnrc_tcp_pkt_fast_retransmit(gnrc_tcp_tcb_t *tcb)
+{
+    TCP_DEBUG_ENTER;
+    unsigned numof = 0;
+
+    /* Retransmit the oldest packet and all packets missing before the most
+     * recent packet the peer reported with SACK */
+    for (uint8_t i = 0; i < tcb->pkt_retransmit_numof; i++) {
+        if ((tcb->pkt_sacked >> i) == 0 && i > 0) {
+            break;
+        }
+        if (!(tcb->pkt_sacked & (1UL << i))) {
+            TCP_NETSTATS_INC(tx_fast_retransmit_count);
+            gnrc_pktbuf_hold(tcb->pkt_retransmit[i], 1);
+            _gnrc_tcp_pkt_send(tcb, tcb->pkt_retransmit[i], 0, true);
+            numof++;
+        }
+    }
+    TCP_DEBUG_LEAVE;
+    return numof;
+}
+
 uint16_t _gnrc_tcp_pkt_calc_csum(const gnrc_pktsnip_t *hdr,
                                  const gnrc_pktsnip_t *pseudo_hdr,
                                  const gnrc_pktsnip_t *payload)
@@ -17,9 +17,13 @@
  */
 #include <errno.h>
 #include <mutex.h>
+#include <stdbool.h>
 #include <stdint.h>
+#include <string.h>
+#include "net/gnrc/pktbuf.h"
 #include "net/gnrc/tcp/config.h"
 #include "include/gnrc_tcp_common.h"
+#include "include/gnrc_tcp_pkt.h"
 #include "include/gnrc_tcp_rcvbuf.h"
 
 #define ENABLE_DEBUG 0
@@ -124,3 +128,164 @@ void _gnrc_tcp_rcvbuf_release_buffer(gnrc_tcp_tcb_t *tcb)
     }
     TCP_DEBUG_LEAVE;
 }
+
+int _gnrc_tcp_rcvbuf_ooo_add(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt)
+{
+    TCP_DEBUG_ENTER;
+    uint32_t seq = _gnrc_tcp_pkt_get_seq_num(pkt);
+    uint32_t len = _gnrc_tcp_pkt_get_pay_len(pkt);
+    uint8_t pos = tcb->pkt_ooo_numof;
+
+    /* Keep only segments behind a gap that fit into the receive window */
+    if (len == 0 || LEQ_32_BIT(seq, tcb->rcv_nxt) ||
+        LSS_32_BIT(tcb->rcv_nxt + tcb->rcv_wnd, seq + len)) {
+        TCP_DEBUG_ERROR("-EINVAL: Segment is not behind a gap in the receive window.");
+        TCP_DEBUG_LEAVE;
+        return -EINVAL;
+    }
+
+    /* Search position of the segment, the queue is ordered by sequence number */
+    while (pos > 0 && LSS_32_BIT(seq, _gnrc_tcp_pkt_get_seq_num(tcb->pkt_ooo[pos - 1]))) {
+        pos--;
+    }
+    /* The SACK option reports the block holding this segment first */
+    tcb->pkt_ooo_last = seq;
+    if (pos > 0 && seq == _gnrc_tcp_pkt_get_seq_num(tcb->pkt_ooo[pos - 1])) {
+        TCP_DEBUG_INFO("Segment is queued already.");
+        TCP_DEBUG_LEAVE;
+        return -EALREADY;
+    }
+    if (tcb->pkt_ooo_numof >= CONFIG_GNRC_TCP_RCV_OOO_SIZE) {
+        TCP_NETSTATS_INC(rx_ooo_dropped);
+        TCP_DEBUG_ERROR("-ENOMEM: Out of order queue is full.");
+        TCP_DEBUG_LEAVE;
+        return -ENOMEM;
+    }
+
+    /* Keep segment in the packet buffer until the gap is filled */
+    memmove(&tcb->pkt_ooo[pos + 1], &tcb->pkt_ooo[pos],
+            (tcb->pkt_ooo_numof - pos) * sizeof(tcb->pkt_ooo[0]));
+    gnrc_pktbuf_hold(pkt, 1);
+    tcb->pkt_ooo[pos] = pkt;
+    tcb->pkt_ooo_numof++;
+    TCP_NETSTATS_INC(rx_ooo_count);
+    TCP_DEBUG_LEAVE;
+    return 0;
+}
+
+void _gnrc_tcp_rcvbuf_ooo_merge(gnrc_tcp_tcb_t *tcb)
+{
+    TCP_DEBUG_ENTER;
+    while (tcb->pkt_ooo_numof > 0) {
+        gnrc_pktsnip_t *pkt = tcb->pkt_ooo[0];
+        uint32_t seq = _gnrc_tcp_pkt_get_seq_num(pkt);
+
+        /* Stop at the next gap */
+        if (LSS_32_BIT(tcb->rcv_nxt, seq)) {
+            break;
+        }
+
+        /* Copy data not received yet, segments may overlap */
+        if (LSS_32_BIT(tcb->rcv_nxt, seq + _gnrc_tcp_pkt_get_pay_len(pkt))) {
+            uint32_t skip = tcb->rcv_nxt - seq;
+            gnrc_pktsnip_t *snp = gnrc_pktsnip_search_type(pkt, GNRC_NETTYPE_UNDEF);
+
+            while (snp && snp->type == GNRC_NETTYPE_UNDEF) {
+                if (skip < snp->size) {
+                    tcb->rcv_nxt += ringbuffer_add(&(tcb->rcv_buf), (char *) snp->data + skip,
+                                                   snp->size - skip);
+                    skip = 0;
+                }
+                else {
+                    skip -= snp->size;
+                }
+                snp = snp->next;
+            }
+            TCP_NETSTATS_INC(rx_ooo_merged);
+        }
+
+        /* Remove segment from queue */
+        gnrc_pktbuf_release(pkt);
+        tcb->pkt_ooo_numof--;
+        memmove(&tcb->pkt_ooo[0], &tcb->pkt_ooo[1],
+                tcb->pkt_ooo_numof * sizeof(tcb->pkt_ooo[0]));
+    }
+    TCP_DEBUG_LEAVE;
+}
+
+/**
+ * @brief Gets the next contiguous block of queued segments.
+ *
+ * @param[in]     tcb     TCB holding the out of order queue.
+ * @param[in,out] pos     Index of the first segment of the block, advanced to
+ *                        the first segment of the following block.
+ * @param[out]    left    Left edge of the block.
+ * @param[out]    right   Right edge of the block.
+ *
+ * @returns   false if there is no further block.
+ */
+static bool _ooo_next_block(const gnrc_tcp_tcb_t *tcb, uint8_t *pos,
+                            uint32_t *left, uint32_t *right)
+{
+    if (*pos >= tcb->pkt_ooo_numof) {
+        return false;
+    }
+    *left = _gnrc_tcp_pkt_get_seq_num(tcb->pkt_ooo[*pos]);
+    *right = *left + _gnrc_tcp_pkt_get_pay_len(tcb->pkt_ooo[*pos]);
+
+    /* Extend the block by adjacent or overlapping segments */
+    for ((*pos)++; *pos < tcb->pkt_ooo_numof; (*pos)++) {
+        uint32_t seq = _gnrc_tcp_pkt_get_seq_num(tcb->pkt_ooo[*pos]);
+        uint32_t end = seq + _gnrc_tcp_pkt_get_pay_len(tcb->pkt_ooo[*pos]);
+
+        if (LSS_32_BIT(*right, seq)) {
+            break;
+        }
+        if (LSS_32_BIT(*right, end)) {
+            *right = end;
+        }
+    }
+    return true;
+}
+
+unsigned _gnrc_tcp_rcvbuf_ooo_sack(const gnrc_tcp_tcb_t *tcb, uint32_t *edges,
+                                   const unsigned numof)
+{
+    TCP_DEBUG_ENTER;
+    unsigned blocks = 0;
+    uint32_t left;
+    uint32_t right;
+    uint8_t pos = 0;
+
+    /* RFC 2018, section 4: The first block holds the most recently received
+     * segment, the others follow in sequence order */
+    while (numof > 0 && _ooo_next_block(tcb, &pos, &left, &right)) {
+        if (LEQ_32_BIT(left, tcb->pkt_ooo_last) && LSS_32_BIT(tcb->pkt_ooo_last, right)) {
+            edges[0] = left;
+            edges[1] = right;
+            blocks++;
+            break;
+        }
+    }
+    pos = 0;
+    while (blocks < numof && _ooo_next_block(tcb, &pos, &left, &right)) {
+        if (blocks > 0 && left == edges[0]) {
+            continue;
+        }
+        edges[2 * blocks] = left;
+        edges[2 * blocks + 1] = right;
+        blocks++;
+    }
+    TCP_DEBUG_LEAVE;
+    return blocks;
+}
+
+void _gnrc_tcp_rcvbuf_ooo_clear(gnrc_tcp_tcb_t *tcb)
+{
+    TCP_DEBUG_ENTER;
+    for (uint8_t i = 0; i < tcb->pkt_ooo_numof; i++) {
+        gnrc_pktbuf_release(tcb->pkt_ooo[i]);
+    }
+    tcb->pkt_ooo_numof = 0;
+    TCP_DEBUG_LEAVE;
+}
@@ -24,7 +24,9 @@
 #include "thread.h"
 #include "mutex.h"
 #include "evtimer.h"
+#include "irq.h"
 #include "net/gnrc/netapi.h"
+#include "net/gnrc/tcp.h"
 #include "net/gnrc/tcp/tcb.h"
 
 #ifdef __cplusplus
@@ -47,6 +49,9 @@ extern "C" {
 #define STATUS_NOTIFY_USER    (1 << 2) /**< Internal: Status bitmask NOTIFY_USER */
 #define STATUS_ACCEPTED       (1 << 3) /**< Internal: Status bitmask ACCEPTED */
 #define STATUS_LOCKED         (1 << 4) /**< Internal: Status bitmask LOCKED */
+#define STATUS_RTT_PENDING    (1 << 5) /**< Internal: Status bitmask RTT_PENDING */
+#define STATUS_SACK_PERMITTED (1 << 6) /**< Internal: Status bitmask SACK_PERMITTED */
+#define STATUS_RECOVERY       (1 << 7) /**< Internal: Status bitmask RECOVERY */
 /** @} */
 
 /**
@@ -86,6 +91,7 @@ extern "C" {
 #define MSG_TYPE_RETRANSMISSION     (GNRC_NETAPI_MSG_TYPE_ACK + 104) /**< Internal: message id */
 #define MSG_TYPE_TIMEWAIT           (GNRC_NETAPI_MSG_TYPE_ACK + 105) /**< Internal: message id */
 #define MSG_TYPE_NOTIFY_USER        (GNRC_NETAPI_MSG_TYPE_ACK + 106) /**< Internal: message id */
+#define MSG_TYPE_DELAYED_ACK        (GNRC_NETAPI_MSG_TYPE_ACK + 107) /**< Internal: message id */
 /** @} */
 
 /**
@@ -146,6 +152,21 @@ extern "C" {
 #define TCP_DEBUG_INFO(msg) DEBUG("GNRC_TCP: Info: \"%s\", Func: %s, File: %s(%d)\n", \
                                   msg, DEBUG_FUNC, __FILE__, __LINE__)
 
+/**
+ * @brief Helper macro used to increment a TCP statistics counter.
+ *
+ * @note Expands to nothing if module netstats_tcp is not used.
+ */
+#if IS_USED(MODULE_NETSTATS_TCP)
+#define TCP_NETSTATS_INC(counter) do { \
+        unsigned irq_state = irq_disable(); \
+        gnrc_tcp_netstats.counter++; \
+        irq_restore(irq_state); \
+    } while (0)
+#else
+#define TCP_NETSTATS_INC(counter) do { } while (0)
+#endif
+
 /**
  * @brief TCB list type.
  */
@@ -42,6 +42,36 @@ static inline uint32_t _gnrc_tcp_option_build_mss(uint16_t mss)
             ((uint32_t) TCP_OPTION_LENGTH_MSS << 16) | mss);
 }
 
+/**
+ * @brief Helper function to build the SACK-permitted option, padded with
+ *        two NOP options.
+ *
+ * @returns   SACK-permitted option value.
+ */
+static inline uint32_t _gnrc_tcp_option_build_sack_permitted(void)
+{
+    return (((uint32_t) TCP_OPTION_KIND_NOP << 24) |
+            ((uint32_t) TCP_OPTION_KIND_NOP << 16) |
+            ((uint32_t) TCP_OPTION_KIND_SACK_PERMITTED << 8) |
+            TCP_OPTION_LENGTH_SACK_PERMITTED);
+}
+
+/**
+ * @brief Helper function to build the head of the SACK option, padded with
+ *        two NOP options. The block edges follow the returned value.
+ *
+ * @param[in] numof   Number of SACK blocks.
+ *
+ * @returns   SACK option head value.
+ */
+static inline uint32_t _gnrc_tcp_option_build_sack(uint8_t numof)
+{
+    return (((uint32_t) TCP_OPTION_KIND_NOP << 24) |
+            ((uint32_t) TCP_OPTION_KIND_NOP << 16) |
+            ((uint32_t) TCP_OPTION_KIND_SACK << 8) |
+            (2 + numof * TCP_OPTION_LENGTH_SACK_BLOCK));
+}
+
 /**
  * @brief Helper function to build the combined option and control flag field.
  *
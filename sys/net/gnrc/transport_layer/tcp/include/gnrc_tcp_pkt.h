@@ -99,6 +99,15 @@ int _gnrc_tcp_pkt_chk_seq_num(const gnrc_tcp_tcb_t *tcb, const uint32_t seq_num,
  */
 uint32_t _gnrc_tcp_pkt_get_seg_len(gnrc_pktsnip_t *pkt);
 
+/**
+ * @brief Extracts the sequence number of a segment.
+ *
+ * @param[in] pkt   Packet to extract the sequence number from.
+ *
+ * @returns   Sequence number of @p pkt.
+ */
+uint32_t _gnrc_tcp_pkt_get_seq_num(gnrc_pktsnip_t *pkt);
+
 /**
  * @brief Calculates a packets payload length.
  *
@@ -111,9 +120,13 @@ uint32_t _gnrc_tcp_pkt_get_pay_len(gnrc_pktsnip_t *pkt);
 /**
  * @brief Adds a packet to the retransmission mechanism.
  *
+ * @note The retransmission timer is started if @p pkt is the only packet in
+ *       the retransmission queue, otherwise it already runs for the oldest one.
+ *
  * @param[in,out] tcb          TCB holding the connection information.
  * @param[in]     pkt          Packet to add to the retransmission mechanism.
- * @param[in]     retransmit   Flag used to indicate that @p pkt is a retransmit.
+ * @param[in]     retransmit   Flag used to indicate that @p pkt is a retransmit
+ *                             of the oldest packet in the retransmission queue.
  *
  * @returns   Zero on success.
  *            -ENOMEM if the retransmission queue is full.
@@ -123,7 +136,7 @@ int _gnrc_tcp_pkt_setup_retransmit(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt,
                                    const bool retransmit);
 
 /**
- * @brief Acknowledges and removes packet from the retransmission mechanism.
+ * @brief Acknowledges and removes packets from the retransmission mechanism.
  *
  * @param[in,out] tcb   TCB holding the connection information.
  * @param[in]     ack   Acknowldegment number used to acknowledge packets.
@@ -133,6 +146,29 @@ int _gnrc_tcp_pkt_setup_retransmit(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt,
  */
 int _gnrc_tcp_pkt_acknowledge(gnrc_tcp_tcb_t *tcb, const uint32_t ack);
 
+/**
+ * @brief Marks packets in the retransmission queue covered by a SACK block.
+ *
+ * @param[in,out] tcb     TCB holding the connection information.
+ * @param[in]     left    Left edge of the SACK block.
+ * @param[in]     right   Right edge of the SACK block.
+ */
+void _gnrc_tcp_pkt_sack(gnrc_tcp_tcb_t *tcb, const uint32_t left, const uint32_t right);
+
+/**
+ * @brief Retransmits packets considered lost after duplicate or partial
+ *        acknowledgments.
+ *
+ * @note Without SACK information, only the oldest packet in the retransmission
+ *       queue is retransmitted. Otherwise all packets the peer is missing in
+ *       front of the last packet covered by a SACK block are retransmitted.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ *
+ * @returns   Number of retransmitted packets.
+ */
+unsigned _gnrc_tcp_pkt_fast_retransmit(gnrc_tcp_tcb_t *tcb);
+
 /**
  * @brief Calculates checksum over payload, TCP header and network layer header.
  *
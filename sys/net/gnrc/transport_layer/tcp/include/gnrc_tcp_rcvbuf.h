@@ -12,7 +12,8 @@
  * @{
  *
  * @file
- * @brief       Functions for allocating and freeing the receive buffer.
+ * @brief       Functions for allocating and freeing the receive buffer and
+ *              for handling segments received out of order.
  *
  * @author      Simon Brummer <simon.brummer@posteo.de>
  */
@@ -48,6 +49,51 @@ int _gnrc_tcp_rcvbuf_get_buffer(gnrc_tcp_tcb_t *tcb);
  */
 void _gnrc_tcp_rcvbuf_release_buffer(gnrc_tcp_tcb_t *tcb);
 
+/**
+ * @brief Keeps a segment received out of order until the missing data arrived.
+ *
+ * @note Only segments that fit completely into the receive window are kept.
+ *
+ * @param[in,out] tcb   TCB holding the out of order queue.
+ * @param[in]     pkt   Received segment.
+ *
+ * @returns   Zero on success.
+ *            -EINVAL if @p pkt is not behind a gap in the receive window.
+ *            -EALREADY if @p pkt was queued already.
+ *            -ENOMEM if the out of order queue is full.
+ */
+int _gnrc_tcp_rcvbuf_ooo_add(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt);
+
+/**
+ * @brief Moves queued segments that are in order now into the receive buffer.
+ *
+ * @param[in,out] tcb   TCB holding the out of order queue and the receive buffer.
+ */
+void _gnrc_tcp_rcvbuf_ooo_merge(gnrc_tcp_tcb_t *tcb);
+
+/**
+ * @brief Calculates SACK blocks covering the queued segments (see RFC 2018).
+ *
+ * The first block holds the segment queued last, the remaining blocks follow
+ * in sequence order.
+ *
+ * @param[in]  tcb     TCB holding the out of order queue.
+ * @param[out] edges   Left and right edges of the SACK blocks.
+ *                     Must hold 2 * @p numof entries.
+ * @param[in]  numof   Maximum number of SACK blocks.
+ *
+ * @returns   Number of SACK blocks written to @p edges.
+ */
+unsigned _gnrc_tcp_rcvbuf_ooo_sack(const gnrc_tcp_tcb_t *tcb, uint32_t *edges,
+                                   const unsigned numof);
+
+/**
+ * @brief Releases all segments in the out of order queue.
+ *
+ * @param[in,out] tcb   TCB holding the out of order queue.
+ */
+void _gnrc_tcp_rcvbuf_ooo_clear(gnrc_tcp_tcb_t *tcb);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,219 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_schedprofile
+ * @{
+ *
+ * @file
+ * @brief       Scheduler profiler implementation
+ *
+ * @}
+ */
+
+#include <string.h>
+
+#include "bitarithm.h"
+#include "irq.h"
+#include "sched.h"
+#include "schedprofile.h"
+#include "thread.h"
+#include "ztimer.h"
+
+#if IS_USED(MODULE_SCHEDSTATISTICS)
+#include "schedstatistics.h"
+#endif
+
+schedprofile_t schedprofile_pidlist[KERNEL_PID_LAST + 1];
+
+/* the wakeup callback is called for the first threads before ztimer is
+ * initialized */
+static bool _enabled;
+
+static unsigned _bucket(uint32_t latency)
+{
+    unsigned bucket = (latency == 0) ? 0 : bitarithm_msb(latency) + 1;
+
+    return (bucket < CONFIG_SCHEDPROFILE_HIST_SIZE)
+           ? bucket : CONFIG_SCHEDPROFILE_HIST_SIZE - 1;
+}
+
+void sched_wakeup_callback(thread_t *thread)
+{
+    /* a thread woken up before it got unscheduled keeps running */
+    if (!_enabled || (thread == thread_get_active())) {
+        return;
+    }
+
+    schedprofile_t *prof = &schedprofile_pidlist[thread->pid];
+
+    prof->wakeup = ztimer_now(ZTIMER_USEC);
+    prof->pending = (irq_is_in() ? SCHEDPROFILE_WAKEUP_IRQ
+                                 : SCHEDPROFILE_WAKEUP_THREAD) + 1;
+}
+
+static void _unschedule(schedprofile_t *prof, kernel_pid_t pid, uint32_t now)
+{
+    uint32_t slice = now - prof->laststart;
+
+    prof->runtime_us += slice;
+    if (slice > prof->max_slice_us) {
+        prof->max_slice_us = slice;
+    }
+    if (pid != KERNEL_PID_UNDEF) {
+        thread_t *thread = thread_get(pid);
+
+        /* the scheduler already marked a running thread as pending */
+        if ((thread != NULL) && (thread->status >= STATUS_ON_RUNQUEUE)) {
+            prof->preemptions++;
+        }
+    }
+}
+
+static void _schedule(schedprofile_t *prof, uint32_t now)
+{
+    prof->laststart = now;
+    prof->schedules++;
+    if (prof->pending) {
+        unsigned src = prof->pending - 1;
+        uint32_t latency = now - prof->wakeup;
+        uint16_t *count = &prof->latency[src][_bucket(latency)];
+
+        if (*count < UINT16_MAX) {
+            (*count)++;
+        }
+        if (latency > prof->max_latency_us[src]) {
+            prof->max_latency_us[src] = latency;
+        }
+        prof->pending = 0;
+    }
+}
+
+static void _sched_cb(kernel_pid_t active_thread, kernel_pid_t next_thread)
+{
+    uint32_t now = ztimer_now(ZTIMER_USEC);
+
+    if (!IS_USED(MODULE_CORE_IDLE_THREAD) || active_thread != KERNEL_PID_UNDEF) {
+        _unschedule(&schedprofile_pidlist[active_thread], active_thread, now);
+    }
+    if (!IS_USED(MODULE_CORE_IDLE_THREAD) || next_thread != KERNEL_PID_UNDEF) {
+        _schedule(&schedprofile_pidlist[next_thread], now);
+    }
+#if IS_USED(MODULE_SCHEDSTATISTICS)
+    /* there is only one scheduler callback, keep schedstatistics working */
+    sched_statistics_cb(active_thread, next_thread);
+#endif
+}
+
+void init_schedprofile(void)
+{
+    /* Init laststart for the thread starting the profiler since the callback
+       wasn't registered when it was first scheduled */
+    schedprofile_t *prof = &schedprofile_pidlist[thread_getpid()];
+
+    prof->laststart = ztimer_now(ZTIMER_USEC);
+    prof->schedules = 1;
+    _enabled = true;
+    sched_register_cb(_sched_cb);
+}
+
+void schedprofile_reset(void)
+{
+    for (unsigned i = 0; i <= KERNEL_PID_LAST; i++) {
+        schedprofile_t *prof = &schedprofile_pidlist[i];
+        unsigned state = irq_disable();
+        uint32_t laststart = prof->laststart;
+        uint32_t wakeup = prof->wakeup;
+        uint8_t pending = prof->pending;
+
+        memset(prof, 0, sizeof(*prof));
+        /* keep what is needed to account the ongoing run slice or wakeup */
+        prof->laststart = laststart;
+        prof->wakeup = wakeup;
+        prof->pending = pending;
+        irq_restore(state);
+    }
+}
+
+static uint8_t *_put_u16(uint8_t *pos, uint16_t val)
+{
+    pos[0] = val;
+    pos[1] = val >> 8;
+    return pos + sizeof(val);
+}
+
+static uint8_t *_put_u32(uint8_t *pos, uint32_t val)
+{
+    pos = _put_u16(pos, val);
+    return _put_u16(pos, val >> 16);
+}
+
+static uint8_t *_put_u64(uint8_t *pos, uint64_t val)
+{
+    pos = _put_u32(pos, val);
+    return _put_u32(pos, val >> 32);
+}
+
+void schedprofile_export_hdr(void *buf)
+{
+    uint8_t *pos = buf;
+
+    pos[0] = 'S';
+    pos[1] = 'P';
+    pos[2] = SCHEDPROFILE_EXPORT_VERSION;
+    pos[3] = CONFIG_SCHEDPROFILE_HIST_SIZE;
+}
+
+bool schedprofile_export_rec(kernel_pid_t pid, void *buf)
+{
+    schedprofile_t prof;
+    uint8_t *pos = buf;
+    unsigned state = irq_disable();
+
+    prof = schedprofile_pidlist[pid];
+    irq_restore(state);
+    if (prof.schedules == 0) {
+        return false;
+    }
+    *pos++ = pid;
+    pos = _put_u32(pos, prof.schedules);
+    pos = _put_u64(pos, prof.runtime_us);
+    pos = _put_u32(pos, prof.max_slice_us);
+    pos = _put_u32(pos, prof.preemptions);
+    for (unsigned src = 0; src < SCHEDPROFILE_WAKEUP_NUMOF; src++) {
+        pos = _put_u32(pos, prof.max_latency_us[src]);
+    }
+    for (unsigned src = 0; src < SCHEDPROFILE_WAKEUP_NUMOF; src++) {
+        for (unsigned i = 0; i < CONFIG_SCHEDPROFILE_HIST_SIZE; i++) {
+            pos = _put_u16(pos, prof.latency[src][i]);
+        }
+    }
+    return true;
+}
+
+size_t schedprofile_export(void *buf, size_t len)
+{
+    uint8_t *pos = buf;
+
+    if (len < SCHEDPROFILE_EXPORT_HDR_SIZE) {
+        return 0;
+    }
+    schedprofile_export_hdr(pos);
+    pos += SCHEDPROFILE_EXPORT_HDR_SIZE;
+    len -= SCHEDPROFILE_EXPORT_HDR_SIZE;
+    for (kernel_pid_t pid = 0; pid <= KERNEL_PID_LAST; pid++) {
+        if (len < SCHEDPROFILE_EXPORT_REC_SIZE) {
+            break;
+        }
+        if (schedprofile_export_rec(pid, pos)) {
+            pos += SCHEDPROFILE_EXPORT_REC_SIZE;
+            len -= SCHEDPROFILE_EXPORT_REC_SIZE;
+        }
+    }
+    return pos - (uint8_t *)buf;
+}
@@ -0,0 +1,57 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_shell_commands
+ * @{
+ *
+ * @file
+ * @brief       Shell command for displaying GNRC TCP statistics
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "irq.h"
+#include "net/gnrc/tcp.h"
+#include "shell.h"
+
+static int _netstats_tcp(int argc, char **argv)
+{
+    netstats_tcp_t stats;
+
+    if ((argc > 1) && (strcmp(argv[1], "reset") == 0)) {
+        unsigned state = irq_disable();
+        memset(&gnrc_tcp_netstats, 0, sizeof(gnrc_tcp_netstats));
+        irq_restore(state);
+        return 0;
+    }
+    if (argc > 1) {
+        printf("usage: %s [reset]\n", argv[0]);
+        return 1;
+    }
+
+    unsigned state = irq_disable();
+    stats = gnrc_tcp_netstats;
+    irq_restore(state);
+
+    printf("out of order: %" PRIu32 " queued, %" PRIu32 " merged, %" PRIu32 " dropped\n",
+           stats.rx_ooo_count, stats.rx_ooo_merged, stats.rx_ooo_dropped);
+    printf("ACKs: %" PRIu32 " sent, %" PRIu32 " coalesced\n",
+           stats.tx_ack_count, stats.tx_ack_coalesced);
+    printf("retransmissions: %" PRIu32 " on timeout, %" PRIu32 " fast\n",
+           stats.tx_retransmit_count, stats.tx_fast_retransmit_count);
+    return 0;
+}
+
+SHELL_COMMAND(tcp_stats, "TCP statistics", _netstats_tcp);
+
+/** @} */
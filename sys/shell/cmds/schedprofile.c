@@ -0,0 +1,119 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_shell_commands
+ * @{
+ *
+ * @file
+ * @brief       Shell commands for the scheduler profiler
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "irq.h"
+#include "schedprofile.h"
+#include "shell.h"
+#include "thread.h"
+
+static const char *_name(kernel_pid_t pid)
+{
+    const char *name = NULL;
+
+    if (pid != KERNEL_PID_UNDEF) {
+        name = thread_getname(pid);
+    }
+    if (name == NULL) {
+        name = (pid == KERNEL_PID_UNDEF) ? "(idle)" : "-";
+    }
+    return name;
+}
+
+static void _print_hist(const char *title, const uint16_t *hist, uint32_t max)
+{
+    printf("\t%s, max %" PRIu32 " us:", title, max);
+    for (unsigned i = 0; i < CONFIG_SCHEDPROFILE_HIST_SIZE; i++) {
+        if (hist[i]) {
+            printf(" >=%" PRIu32 ":%u", schedprofile_bucket_min(i), hist[i]);
+        }
+    }
+    puts("");
+}
+
+static void _print(void)
+{
+    printf("%5s | %-16s | %10s | %12s | %10s | %10s\n", "pid", "name",
+           "schedules", "runtime us", "slice us", "preempted");
+    for (kernel_pid_t pid = 0; pid <= KERNEL_PID_LAST; pid++) {
+        schedprofile_t prof;
+        unsigned state = irq_disable();
+
+        prof = schedprofile_pidlist[pid];
+        irq_restore(state);
+        if (prof.schedules == 0) {
+            continue;
+        }
+        printf("%5" PRIkernel_pid " | %-16s | %10" PRIu32 " | %12" PRIu64
+               " | %10" PRIu32 " | %10" PRIu32 "\n", pid, _name(pid),
+               prof.schedules, prof.runtime_us, prof.max_slice_us,
+               prof.preemptions);
+        _print_hist("wakeup latency (thread)",
+                    prof.latency[SCHEDPROFILE_WAKEUP_THREAD],
+                    prof.max_latency_us[SCHEDPROFILE_WAKEUP_THREAD]);
+        _print_hist("wakeup latency (IRQ)",
+                    prof.latency[SCHEDPROFILE_WAKEUP_IRQ],
+                    prof.max_latency_us[SCHEDPROFILE_WAKEUP_IRQ]);
+    }
+}
+
+static void _print_hex(const uint8_t *buf, size_t len)
+{
+    for (size_t i = 0; i < len; i++) {
+        printf("%02x", buf[i]);
+    }
+}
+
+/* the dump is printed as a single hex line, record by record */
+static void _dump(void)
+{
+    uint8_t buf[SCHEDPROFILE_EXPORT_REC_SIZE];
+
+    schedprofile_export_hdr(buf);
+    _print_hex(buf, SCHEDPROFILE_EXPORT_HDR_SIZE);
+    for (kernel_pid_t pid = 0; pid <= KERNEL_PID_LAST; pid++) {
+        if (schedprofile_export_rec(pid, buf)) {
+            _print_hex(buf, sizeof(buf));
+        }
+    }
+    puts("");
+}
+
+static int _schedprofile_handler(int argc, char **argv)
+{
+    if (argc < 2) {
+        _print();
+    }
+    else if (strcmp(argv[1], "dump") == 0) {
+        _dump();
+    }
+    else if (strcmp(argv[1], "reset") == 0) {
+        schedprofile_reset();
+    }
+    else {
+        printf("usage: %s [dump|reset]\n", argv[0]);
+        return 1;
+    }
+    return 0;
+}
+
+SHELL_COMMAND(schedprofile, "Prints scheduler profile of threads.",
+              _schedprofile_handler);
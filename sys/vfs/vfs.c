@@ -24,6 +24,7 @@
 #include <unistd.h> /* for STDIN_FILENO, STDOUT_FILENO, STDERR_FILENO */
 
 #include "atomic_utils.h"
+#include "bitarithm.h"
 #include "clist.h"
 #include "compiler_hints.h"
 #include "container.h"
@@ -66,6 +67,24 @@ XFA_INIT(vfs_mount_t, vfs_mountpoints_xfa);
  */
 static vfs_file_t _vfs_open_files[VFS_MAX_OPEN_FILES];
 
+/**
+ * @internal
+ * @brief Number of file descriptors per word of _vfs_busy_fds
+ */
+#define FDS_PER_WORD (32U)
+
+/**
+ * @internal
+ * @brief Bitmap of the file descriptors that are not available for automatic
+ *        allocation
+ *
+ * The stdio file descriptor numbers are always marked as busy. Bits are set
+ * with _open_mutex held and cleared atomically without it.
+ */
+static uint32_t _vfs_busy_fds[(VFS_MAX_OPEN_FILES + FDS_PER_WORD - 1) / FDS_PER_WORD] = {
+    (1UL << STDIN_FILENO) | (1UL << STDOUT_FILENO) | (1UL << STDERR_FILENO),
+};
+
 /**
  * @internal
  * @brief List handle for list of all currently mounted file systems
@@ -75,6 +94,54 @@ static vfs_file_t _vfs_open_files[VFS_MAX_OPEN_FILES];
  */
 static clist_node_t _vfs_mounts_list;
 
+/**
+ * @internal
+ * @brief Index of all currently mounted file systems for path lookups
+ *
+ * Contains the same mount points as _vfs_mounts_list, sorted by descending
+ * length of the mount point. The first matching entry is the longest prefix
+ * of a path.
+ */
+static list_node_t _vfs_mounts_index;
+
+/**
+ * @internal
+ * @brief Buffer of a file opened with vfs_buffered
+ *
+ * Holds either a read-ahead, of which the first @c idx bytes were consumed
+ * already, or @c len bytes of data not yet passed to the driver.
+ */
+typedef struct {
+    size_t len;                             /**< Number of bytes in data */
+    size_t idx;                             /**< Read position within data */
+    bool dirty;                             /**< data is pending to be written */
+    uint8_t used;                           /**< Buffer is assigned to a file */
+    uint8_t data[CONFIG_VFS_BUFFERED_SIZE]; /**< Buffered data */
+} _vfs_buf_t;
+
+#if IS_USED(MODULE_VFS_BUFFERED)
+/**
+ * @internal
+ * @brief Pool of file buffers
+ *
+ * Buffers are assigned with _open_mutex held and returned to the pool
+ * atomically without it.
+ */
+static _vfs_buf_t _vfs_bufs[CONFIG_VFS_BUFFERED_NUMOF];
+
+/**
+ * @internal
+ * @brief Buffer of each open file, NULL for unbuffered files
+ */
+static _vfs_buf_t *_vfs_file_bufs[VFS_MAX_OPEN_FILES];
+
+/**
+ * @internal
+ * @brief Statistics of the file buffers
+ */
+static vfs_buffered_stats_t _vfs_buf_stats;
+#endif
+
 /**
  * @internal
  * @brief Find an unused entry in the _vfs_open_files array and mark it as used
@@ -134,6 +201,56 @@ static inline int _init_fd(int fd, const vfs_file_ops_t *f_op, vfs_mount_t *moun
  */
 static inline int _find_mount(vfs_mount_t **mountpp, const char *name, const char **rel_path);
 
+/**
+ * @internal
+ * @brief Get the buffer of an open file
+ *
+ * @param[in]  fd     fd of the file
+ *
+ * @return the buffer, NULL if the file is unbuffered
+ */
+static inline _vfs_buf_t *_buf_get(int fd);
+
+/**
+ * @internal
+ * @brief Assign a buffer from the pool to a file if one is available
+ *
+ * @param[in]  fd     fd of the file, _open_mutex must be held
+ */
+static void _buf_attach(int fd);
+
+/**
+ * @internal
+ * @brief Write out pending data of a buffer
+ *
+ * @param[in]  filp   file the buffer belongs to
+ * @param[in]  buf    buffer of @p filp
+ *
+ * @return 0 on success, pending data is discarded on error
+ * @return <0 on error
+ */
+static int _buf_flush(vfs_file_t *filp, _vfs_buf_t *buf);
+
+/**
+ * @internal
+ * @brief Read from a file through its buffer
+ */
+static ssize_t _buf_read(vfs_file_t *filp, _vfs_buf_t *buf, void *dest, size_t count);
+
+/**
+ * @internal
+ * @brief Write to a file through its buffer
+ */
+static ssize_t _buf_write(vfs_file_t *filp, _vfs_buf_t *buf, const void *src, size_t count);
+
+/**
+ * @internal
+ * @brief Insert a mount point into _vfs_mounts_index
+ *
+ * @param[in]  mountp       mount point to insert, _mount_mutex must be held
+ */
+static void _index_add(vfs_mount_t *mountp);
+
 /**
  * @internal
  * @brief Check that a given fd number is valid
@@ -145,6 +262,12 @@ static inline int _find_mount(vfs_mount_t **mountpp, const char *name, const cha
  */
 static inline int _fd_is_valid(int fd);
 
+/**
+ * @internal
+ * @brief Seek within a file, bypassing its buffer
+ */
+static off_t _lseek(vfs_file_t *filp, off_t off, int whence);
+
 static mutex_t _mount_mutex = MUTEX_INIT;
 static mutex_t _open_mutex = MUTEX_INIT;
 
@@ -156,10 +279,15 @@ int vfs_close(int fd)
         return res;
     }
     vfs_file_t *filp = &_vfs_open_files[fd];
+    _vfs_buf_t *buf = _buf_get(fd);
+    if (buf != NULL) {
+        res = _buf_flush(filp, buf);
+    }
     if (filp->f_op->close != NULL) {
         /* We will invalidate the fd regardless of the outcome of the file
          * system driver close() call below */
-        res = filp->f_op->close(filp);
+        int close_res = filp->f_op->close(filp);
+        res = (res < 0) ? res : close_res;
     }
     _free_fd(fd);
     return res;
@@ -205,6 +333,14 @@ int vfs_fstat(int fd, struct stat *buf)
         /* driver does not implement fstat() */
         return -EINVAL;
     }
+    _vfs_buf_t *file_buf = _buf_get(fd);
+    if (file_buf != NULL) {
+        /* the size includes pending writes */
+        res = _buf_flush(filp, file_buf);
+        if (res < 0) {
+            return res;
+        }
+    }
     memset(buf, 0, sizeof(*buf));
     return filp->f_op->fstat(filp, buf);
 }
@@ -250,6 +386,26 @@ off_t vfs_lseek(int fd, off_t off, int whence)
         return res;
     }
     vfs_file_t *filp = &_vfs_open_files[fd];
+    _vfs_buf_t *buf = _buf_get(fd);
+    if (buf != NULL) {
+        if (buf->dirty) {
+            res = _buf_flush(filp, buf);
+            if (res < 0) {
+                return res;
+            }
+        }
+        else if (whence == SEEK_CUR) {
+            /* the driver is ahead by the unread part of the read-ahead */
+            off -= buf->len - buf->idx;
+        }
+        buf->len = 0;
+        buf->idx = 0;
+    }
+    return _lseek(filp, off, whence);
+}
+
+static off_t _lseek(vfs_file_t *filp, off_t off, int whence)
+{
     if (filp->f_op->lseek == NULL) {
         /* driver does not implement lseek() */
         /* default seek functionality is naive */
@@ -313,6 +469,11 @@ int vfs_open(const char *name, int flags, mode_t mode)
             return res;
         }
     }
+    if (IS_USED(MODULE_VFS_BUFFERED)) {
+        mutex_lock(&_open_mutex);
+        _buf_attach(fd);
+        mutex_unlock(&_open_mutex);
+    }
     DEBUG("vfs_open: opened %d\n", fd);
     return fd;
 }
@@ -353,6 +514,10 @@ ssize_t vfs_read(int fd, void *dest, size_t count)
         return res;
     }
 
+    _vfs_buf_t *buf = _buf_get(fd);
+    if (buf != NULL) {
+        return _buf_read(filp, buf, dest, count);
+    }
     return filp->f_op->read(filp, dest, count);
 }
 
@@ -367,9 +532,11 @@ ssize_t vfs_readline(int fd, char *dst, size_t len_max)
         return res;
     }
 
+    _vfs_buf_t *buf = _buf_get(fd);
     const char *start = dst;
     while (len_max) {
-        int res = filp->f_op->read(filp, dst, 1);
+        int res = (buf != NULL) ? _buf_read(filp, buf, dst, 1)
+                                : filp->f_op->read(filp, dst, 1);
         if (res < 0) {
             break;
         }
@@ -410,6 +577,10 @@ ssize_t vfs_write(int fd, const void *src, size_t count)
         /* driver does not implement write() */
         return -EINVAL;
     }
+    _vfs_buf_t *buf = _buf_get(fd);
+    if (buf != NULL) {
+        return _buf_write(filp, buf, src, count);
+    }
     return filp->f_op->write(filp, src, count);
 }
 
@@ -441,6 +612,13 @@ int vfs_fsync(int fd)
         /* File not open for writing */
         return -EBADF;
     }
+    _vfs_buf_t *buf = _buf_get(fd);
+    if (buf != NULL) {
+        res = _buf_flush(filp, buf);
+        if (res < 0) {
+            return res;
+        }
+    }
     if (filp->f_op->fsync == NULL) {
         /* driver does not implement fsync() */
         return -EINVAL;
@@ -600,6 +778,7 @@ int vfs_mount(vfs_mount_t *mountp)
     }
     /* Insert last in list. This property is relied on by vfs_iterate_mount_dirs. */
     clist_rpush(&_vfs_mounts_list, &mountp->list_entry);
+    _index_add(mountp);
     mutex_unlock(&_mount_mutex);
     DEBUG("vfs_mount: mount done\n");
     return 0;
@@ -646,6 +825,7 @@ int vfs_umount(vfs_mount_t *mountp, bool force)
         mutex_unlock(&_mount_mutex);
         return -EINVAL;
     }
+    list_remove(&_vfs_mounts_index, &mountp->index_entry);
     mutex_unlock(&_mount_mutex);
     return 0;
 }
@@ -1064,15 +1244,15 @@ const vfs_file_t *vfs_file_get(int fd)
 static inline int _allocate_fd(int fd)
 {
     if (fd < 0) {
-        for (fd = 0; fd < VFS_MAX_OPEN_FILES; ++fd) {
-            if ((fd == STDIN_FILENO) || (fd == STDOUT_FILENO) || (fd == STDERR_FILENO)) {
-                /* Do not auto-allocate the stdio file descriptor numbers to
-                 * avoid conflicts between normal file system users and stdio
-                 * drivers such as stdio_uart, stdio_rtt which need to be able
-                 * to bind to these specific file descriptor numbers. */
-                continue;
-            }
-            if (_vfs_open_files[fd].pid == KERNEL_PID_UNDEF) {
+        /* The stdio file descriptor numbers are marked busy to avoid conflicts
+         * between normal file system users and stdio drivers such as
+         * stdio_uart, stdio_rtt which need to be able to bind to these
+         * specific file descriptor numbers. */
+        fd = VFS_MAX_OPEN_FILES;
+        for (unsigned i = 0; i < ARRAY_SIZE(_vfs_busy_fds); i++) {
+            uint32_t free = ~atomic_load_u32(&_vfs_busy_fds[i]);
+            if (free) {
+                fd = i * FDS_PER_WORD + bitarithm_lsb(free);
                 break;
             }
         }
@@ -1092,6 +1272,8 @@ static inline int _allocate_fd(int fd)
         pid = -1;
     }
     _vfs_open_files[fd].pid = pid;
+    atomic_set_bit_u32(atomic_bit_u32(&_vfs_busy_fds[fd / FDS_PER_WORD],
+                                      fd % FDS_PER_WORD));
     return fd;
 }
 
@@ -1102,7 +1284,18 @@ static inline void _free_fd(int fd)
         uint16_t before = atomic_fetch_sub_u16(&_vfs_open_files[fd].mp->open_files, 1);
         assume(before > 0);
     }
+#if IS_USED(MODULE_VFS_BUFFERED)
+    _vfs_buf_t *buf = _vfs_file_bufs[fd];
+    if (buf != NULL) {
+        _vfs_file_bufs[fd] = NULL;
+        atomic_store_u8(&buf->used, 0);
+    }
+#endif
     _vfs_open_files[fd].pid = KERNEL_PID_UNDEF;
+    if ((fd != STDIN_FILENO) && (fd != STDOUT_FILENO) && (fd != STDERR_FILENO)) {
+        atomic_clear_bit_u32(atomic_bit_u32(&_vfs_busy_fds[fd / FDS_PER_WORD],
+                                            fd % FDS_PER_WORD));
+    }
 }
 
 static inline int _init_fd(int fd, const vfs_file_ops_t *f_op, vfs_mount_t *mountp, int flags, void *private_data)
@@ -1120,27 +1313,201 @@ static inline int _init_fd(int fd, const vfs_file_ops_t *f_op, vfs_mount_t *moun
     return fd;
 }
 
+static inline _vfs_buf_t *_buf_get(int fd)
+{
+#if IS_USED(MODULE_VFS_BUFFERED)
+    return _vfs_file_bufs[fd];
+#else
+    (void)fd;
+    return NULL;
+#endif
+}
+
+static void _buf_attach(int fd)
+{
+#if IS_USED(MODULE_VFS_BUFFERED)
+    vfs_file_t *filp = &_vfs_open_files[fd];
+    struct stat st = { 0 };
+    /* only regular files are buffered, devices have to see every access */
+    if ((filp->f_op->fstat == NULL) || (filp->f_op->fstat(filp, &st) < 0) ||
+        !S_ISREG(st.st_mode)) {
+        DEBUG("_buf_attach: %d is no regular file\n", fd);
+        return;
+    }
+    for (unsigned i = 0; i < ARRAY_SIZE(_vfs_bufs); i++) {
+        _vfs_buf_t *buf = &_vfs_bufs[i];
+        if (!atomic_load_u8(&buf->used)) {
+            buf->used = 1;
+            buf->len = 0;
+            buf->idx = 0;
+            buf->dirty = false;
+            _vfs_file_bufs[fd] = buf;
+            DEBUG("_buf_attach: %d uses buffer %u\n", fd, i);
+            return;
+        }
+    }
+#else
+    (void)fd;
+#endif
+}
+
+static int _buf_flush(vfs_file_t *filp, _vfs_buf_t *buf)
+{
+#if IS_USED(MODULE_VFS_BUFFERED)
+    size_t done = 0;
+    int res = 0;
+
+    if (!buf->dirty) {
+        return 0;
+    }
+    while (done < buf->len) {
+        ssize_t written = filp->f_op->write(filp, &buf->data[done],
+                                            buf->len - done);
+        _vfs_buf_stats.driver_writes++;
+        if (written <= 0) {
+            res = (written < 0) ? written : -EIO;
+            break;
+        }
+        done += written;
+    }
+    buf->len = 0;
+    buf->dirty = false;
+    return res;
+#else
+    (void)filp;
+    (void)buf;
+    return 0;
+#endif
+}
+
+static ssize_t _buf_read(vfs_file_t *filp, _vfs_buf_t *buf, void *dest, size_t count)
+{
+#if IS_USED(MODULE_VFS_BUFFERED)
+    uint8_t *dst = dest;
+    size_t done = 0;
+
+    if (buf->dirty) {
+        int res = _buf_flush(filp, buf);
+        if (res < 0) {
+            return res;
+        }
+    }
+    _vfs_buf_stats.reads++;
+    while (done < count) {
+        size_t avail = buf->len - buf->idx;
+        if (avail) {
+            size_t n = MIN(avail, count - done);
+            memcpy(&dst[done], &buf->data[buf->idx], n);
+            buf->idx += n;
+            done += n;
+            continue;
+        }
+        /* large reads go straight to the destination */
+        size_t want = count - done;
+        bool direct = want >= sizeof(buf->data);
+        ssize_t res = filp->f_op->read(filp, direct ? &dst[done] : buf->data,
+                                       direct ? want : sizeof(buf->data));
+        _vfs_buf_stats.driver_reads++;
+        if (res <= 0) {
+            return done ? (ssize_t)done : res;
+        }
+        if (direct) {
+            done += res;
+            if ((size_t)res < want) {
+                break;
+            }
+        }
+        else {
+            buf->len = res;
+            buf->idx = 0;
+        }
+    }
+    return done;
+#else
+    (void)buf;
+    return filp->f_op->read(filp, dest, count);
+#endif
+}
+
+static ssize_t _buf_write(vfs_file_t *filp, _vfs_buf_t *buf, const void *src, size_t count)
+{
+#if IS_USED(MODULE_VFS_BUFFERED)
+    int res;
+
+    if (!buf->dirty && (buf->len > buf->idx)) {
+        /* move the driver back from the end of the read-ahead */
+        off_t pos = _lseek(filp, -(off_t)(buf->len - buf->idx), SEEK_CUR);
+        if (pos < 0) {
+            return pos;
+        }
+    }
+    if (!buf->dirty) {
+        buf->len = 0;
+        buf->idx = 0;
+    }
+    _vfs_buf_stats.writes++;
+    if (buf->len + count > sizeof(buf->data)) {
+        res = _buf_flush(filp, buf);
+        if (res < 0) {
+            return res;
+        }
+    }
+    if (count >= sizeof(buf->data)) {
+        _vfs_buf_stats.driver_writes++;
+        return filp->f_op->write(filp, src, count);
+    }
+    memcpy(&buf->data[buf->len], src, count);
+    buf->len += count;
+    buf->dirty = true;
+    return count;
+#else
+    (void)buf;
+    return filp->f_op->write(filp, src, count);
+#endif
+}
+
+void vfs_buffered_stats(vfs_buffered_stats_t *stats)
+{
+#if IS_USED(MODULE_VFS_BUFFERED)
+    *stats = _vfs_buf_stats;
+#else
+    memset(stats, 0, sizeof(*stats));
+#endif
+}
+
+void vfs_buffered_stats_reset(void)
+{
+#if IS_USED(MODULE_VFS_BUFFERED)
+    memset(&_vfs_buf_stats, 0, sizeof(_vfs_buf_stats));
+#endif
+}
+
+static void _index_add(vfs_mount_t *mountp)
+{
+    list_node_t *prev = &_vfs_mounts_index;
+
+    /* Insert in front of mount points of the same length, a later mount of the
+     * same path shadows the earlier one */
+    while (prev->next) {
+        vfs_mount_t *it = container_of(prev->next, vfs_mount_t, index_entry);
+        if (it->mount_point_len <= mountp->mount_point_len) {
+            break;
+        }
+        prev = prev->next;
+    }
+    list_add(prev, &mountp->index_entry);
+}
+
 static inline int _find_mount(vfs_mount_t **mountpp, const char *name, const char **rel_path)
 {
     size_t longest_match = 0;
     size_t name_len = strlen(name);
     mutex_lock(&_mount_mutex);
 
-    clist_node_t *node = _vfs_mounts_list.next;
-    if (node == NULL) {
-        /* list empty */
-        mutex_unlock(&_mount_mutex);
-        return -ENOENT;
-    }
     vfs_mount_t *mountp = NULL;
-    do {
-        node = node->next;
-        vfs_mount_t *it = container_of(node, vfs_mount_t, list_entry);
+    for (list_node_t *node = _vfs_mounts_index.next; node; node = node->next) {
+        vfs_mount_t *it = container_of(node, vfs_mount_t, index_entry);
         size_t len = it->mount_point_len;
-        if (len < longest_match) {
-            /* Already found a longer prefix */
-            continue;
-        }
         if (len > name_len) {
             /* path name is shorter than the mount point name */
             continue;
@@ -1150,14 +1517,15 @@ static inline int _find_mount(vfs_mount_t **mountpp, const char *name, const cha
             continue;
         }
         if (strncmp(name, it->mount_point, len) == 0) {
-            /* mount_point is a prefix of name */
+            /* mount_point is the longest prefix of name */
             /* special check for mount_point == "/" */
             if (len > 1) {
                 longest_match = len;
             }
             mountp = it;
+            break;
         }
-    } while (node != _vfs_mounts_list.next);
+    }
     if (mountp == NULL) {
         /* not found */
         mutex_unlock(&_mount_mutex);
@@ -25,7 +25,9 @@
 #include <assert.h>
 #include <stdint.h>
 #include <inttypes.h>
+#include <string.h>
 
+#include "bitarithm.h"
 #include "kernel_defines.h"
 #include "irq.h"
 #if MODULE_PM_LAYERED && !MODULE_ZTIMER_ONDEMAND
@@ -37,6 +39,8 @@
 #define ENABLE_DEBUG 0
 #include "debug.h"
 
+static void _add_entry(ztimer_clock_t *clock, ztimer_base_t *entry);
+static bool _del_entry(ztimer_clock_t *clock, ztimer_base_t *entry);
 static void _add_entry_to_list(ztimer_clock_t *clock, ztimer_base_t *entry);
 static bool _del_entry_from_list(ztimer_clock_t *clock, ztimer_base_t *entry);
 static void _ztimer_update(ztimer_clock_t *clock);
@@ -139,7 +143,7 @@ bool ztimer_remove(ztimer_clock_t *clock, ztimer_t *timer)
 
     if (_is_set(clock, timer)) {
         _ztimer_update_head_offset(clock);
-        was_removed = _del_entry_from_list(clock, &timer->base);
+        was_removed = _del_entry(clock, &timer->base);
 
 #if MODULE_ZTIMER_ONDEMAND
         if (was_removed) {
@@ -177,10 +181,12 @@ uint32_t ztimer_set(ztimer_clock_t *clock, ztimer_t *timer, uint32_t val)
           (void *)clock, (void *)timer, clock->ops->now(clock), val);
 
     uint32_t now = _ztimer_update_head_offset(clock);
+    ztimer_base_t *head = clock->list.next;
+    uint32_t head_offset = head ? head->offset : 0;
 
     bool was_set = false;
     if (_is_set(clock, timer)) {
-        was_set = _del_entry_from_list(clock, &timer->base);
+        was_set = _del_entry(clock, &timer->base);
     }
 
     /* optionally subtract a configurable adjustment value */
@@ -192,8 +198,12 @@ uint32_t ztimer_set(ztimer_clock_t *clock, ztimer_t *timer, uint32_t val)
     }
 
     timer->base.offset = val;
-    _add_entry_to_list(clock, &timer->base);
-    if (clock->list.next == &timer->base) {
+    _add_entry(clock, &timer->base);
+    /* the head changes if the timer was the head before or if it got added
+     * in front, the timer wheel may also move its own timer in front */
+    if ((clock->list.next != head) || (clock->list.next == &timer->base) ||
+        (head->offset != head_offset)) {
+        val = clock->list.next->offset;
 #ifdef MODULE_ZTIMER_EXTEND
         if (clock->max_value < UINT32_MAX) {
             val = _min_u32(val, clock->max_value >> 1);
@@ -221,6 +231,267 @@ uint32_t ztimer_set(ztimer_clock_t *clock, ztimer_t *timer, uint32_t val)
     return now;
 }
 
+#if MODULE_ZTIMER_WHEEL
+#define _WHEEL_SHIFT(level) (ZTIMER_WHEEL_NEAR_BITS + \
+                             (level) * ZTIMER_WHEEL_SLOT_BITS)
+#define _WHEEL_SLOT_MASK    (ZTIMER_WHEEL_SLOTS - 1)
+/* timers this far in the future might be due in the current top level slot
+ * (after the wheel's time wrapped around), those are kept in the list */
+#define _WHEEL_FAR          ((uint32_t)0 - \
+                             ((uint32_t)1 << _WHEEL_SHIFT(ZTIMER_WHEEL_LEVELS - 1)))
+
+static void _wheel_callback(void *arg);
+
+void ztimer_wheel_init(ztimer_clock_t *clock, ztimer_wheel_t *wheel)
+{
+    unsigned state = irq_disable();
+
+    assert(clock->list.next == NULL);
+    memset(wheel, 0, sizeof(*wheel));
+    wheel->timer.callback = _wheel_callback;
+    wheel->timer.arg = clock;
+    wheel->now = clock->list.offset;
+    clock->wheel = wheel;
+
+    irq_restore(state);
+}
+
+static inline unsigned _wheel_slot(uint32_t target, unsigned level)
+{
+    return (target >> _WHEEL_SHIFT(level)) & _WHEEL_SLOT_MASK;
+}
+
+/* returns the level of the slot @p target belongs to, or -1 if the timer has
+ * to be kept in the list */
+static int _wheel_level(const ztimer_wheel_t *wheel, uint32_t target)
+{
+    uint32_t diff = target ^ wheel->now;
+    unsigned level = 0;
+
+    if ((diff < ((uint32_t)1 << ZTIMER_WHEEL_NEAR_BITS)) ||
+        ((target - wheel->now) >= _WHEEL_FAR)) {
+        return -1;
+    }
+    while ((level < (ZTIMER_WHEEL_LEVELS - 1)) &&
+           (diff >> _WHEEL_SHIFT(level + 1))) {
+        level++;
+    }
+    return level;
+}
+
+/* returns the ticks from the wheel's time until a slot starts */
+static uint32_t _wheel_slot_start(const ztimer_wheel_t *wheel, unsigned level,
+                                  unsigned slot)
+{
+    unsigned shift = _WHEEL_SHIFT(level);
+    uint32_t start = (uint32_t)slot << shift;
+
+    if ((shift + ZTIMER_WHEEL_SLOT_BITS) < 32) {
+        start |= wheel->now &
+                 ~(((uint32_t)1 << (shift + ZTIMER_WHEEL_SLOT_BITS)) - 1);
+    }
+    /* for the top level, this wraps around for slots before the current */
+    return start - wheel->now;
+}
+
+/* the next slot to start is always on the lowest non-empty level */
+static bool _wheel_next(const ztimer_wheel_t *wheel, uint32_t *delta)
+{
+    for (unsigned level = 0; level < ZTIMER_WHEEL_LEVELS; level++) {
+        unsigned pending = wheel->pending[level];
+
+        if (pending) {
+            unsigned current = _wheel_slot(wheel->now, level);
+            unsigned ahead = pending & ~((2U << current) - 1);
+
+            *delta = _wheel_slot_start(wheel, level,
+                                       bitarithm_lsb(ahead ? ahead : pending));
+            return true;
+        }
+    }
+    return false;
+}
+
+/* puts @p entry with its absolute target in ztimer_base_t::offset either into
+ * a slot or into the list, requires the wheel's time to equal the list's */
+static void _wheel_place(ztimer_clock_t *clock, ztimer_base_t *entry)
+{
+    ztimer_wheel_t *wheel = clock->wheel;
+    int level = _wheel_level(wheel, entry->offset);
+
+    if (level < 0) {
+        entry->offset -= clock->list.offset;
+        entry->prev = NULL;
+        _add_entry_to_list(clock, entry);
+        return;
+    }
+
+    unsigned slot = _wheel_slot(entry->offset, level);
+    ztimer_base_t *first = wheel->slots[level][slot];
+
+    /* append to circular slot list, so entry->next is never NULL */
+    if (first) {
+        entry->next = first;
+        entry->prev = first->prev;
+        first->prev->next = entry;
+        first->prev = entry;
+    }
+    else {
+        entry->next = entry;
+        entry->prev = entry;
+        wheel->slots[level][slot] = entry;
+        wheel->pending[level] |= 1U << slot;
+    }
+    DEBUG("_wheel_place() %p target %" PRIu32 " level %d slot %u\n",
+          (void *)entry, entry->offset, level, slot);
+}
+
+static void _wheel_unlink(ztimer_wheel_t *wheel, ztimer_base_t *entry)
+{
+    int level = _wheel_level(wheel, entry->offset);
+
+    assert(level >= 0);
+    unsigned slot = _wheel_slot(entry->offset, level);
+
+    if (entry->next == entry) {
+        wheel->slots[level][slot] = NULL;
+        wheel->pending[level] &= ~(1U << slot);
+    }
+    else {
+        entry->prev->next = entry->next;
+        entry->next->prev = entry->prev;
+        if (wheel->slots[level][slot] == entry) {
+            wheel->slots[level][slot] = entry->next;
+        }
+    }
+    entry->next = NULL;
+    entry->prev = NULL;
+}
+
+/* moves the wheel's time to the list's time, the timers of all slots that
+ * started in between are put into lower levels or into the list */
+static void _wheel_advance(ztimer_clock_t *clock)
+{
+    ztimer_wheel_t *wheel = clock->wheel;
+    uint32_t elapsed = clock->list.offset - wheel->now;
+    uint32_t delta;
+    ztimer_base_t *due = NULL;
+
+    if (!_wheel_next(wheel, &delta) || (elapsed < delta)) {
+        /* no slot started, so no timer changes its slot */
+        wheel->now = clock->list.offset;
+        return;
+    }
+
+    for (unsigned level = 0; level < ZTIMER_WHEEL_LEVELS; level++) {
+        unsigned pending = wheel->pending[level];
+
+        while (pending) {
+            unsigned slot = bitarithm_lsb(pending);
+            ztimer_base_t *first = wheel->slots[level][slot];
+
+            pending &= ~(1U << slot);
+            if (_wheel_slot_start(wheel, level, slot) > elapsed) {
+                continue;
+            }
+            /* turn the circular slot list into a chain in front of due */
+            first->prev->next = due;
+            due = first;
+            wheel->slots[level][slot] = NULL;
+            wheel->pending[level] &= ~(1U << slot);
+        }
+    }
+
+    uint32_t before = wheel->now;
+
+    wheel->now = clock->list.offset;
+    while (due) {
+        ztimer_base_t *entry = due;
+
+        due = entry->next;
+        if ((entry->offset - before) <= elapsed) {
+            /* already expired */
+            entry->offset = wheel->now;
+        }
+        _wheel_place(clock, entry);
+    }
+}
+
+/* (re-)sets the wheel's timer to the start of the next non-empty slot */
+static void _wheel_arm(ztimer_clock_t *clock)
+{
+    ztimer_wheel_t *wheel = clock->wheel;
+    bool armed = _is_set(clock, &wheel->timer);
+    uint32_t delta;
+
+    if (!_wheel_next(wheel, &delta)) {
+        if (armed) {
+            _del_entry_from_list(clock, &wheel->timer.base);
+#if MODULE_ZTIMER_ONDEMAND
+            ztimer_release(clock);
+#endif
+        }
+        return;
+    }
+    if (armed) {
+        if (wheel->next == (wheel->now + delta)) {
+            return;
+        }
+        _del_entry_from_list(clock, &wheel->timer.base);
+    }
+    else {
+#if MODULE_ZTIMER_ONDEMAND
+        _ztimer_acquire(clock);
+#endif
+    }
+    wheel->next = wheel->now + delta;
+    wheel->timer.base.offset = delta;
+    _add_entry_to_list(clock, &wheel->timer.base);
+}
+
+static void _wheel_callback(void *arg)
+{
+    ztimer_clock_t *clock = arg;
+
+    _wheel_advance(clock);
+    _wheel_arm(clock);
+}
+#endif /* MODULE_ZTIMER_WHEEL */
+
+static void _add_entry(ztimer_clock_t *clock, ztimer_base_t *entry)
+{
+#if MODULE_ZTIMER_WHEEL
+    if (clock->wheel) {
+        _wheel_advance(clock);
+        entry->offset += clock->list.offset;
+        _wheel_place(clock, entry);
+        _wheel_arm(clock);
+        return;
+    }
+#endif
+    _add_entry_to_list(clock, entry);
+}
+
+static bool _del_entry(ztimer_clock_t *clock, ztimer_base_t *entry)
+{
+#if MODULE_ZTIMER_WHEEL
+    if (clock->wheel) {
+        bool was_removed = true;
+
+        _wheel_advance(clock);
+        if (entry->prev) {
+            _wheel_unlink(clock->wheel, entry);
+        }
+        else {
+            was_removed = _del_entry_from_list(clock, entry);
+        }
+        _wheel_arm(clock);
+        return was_removed;
+    }
+#endif
+    return _del_entry_from_list(clock, entry);
+}
+
 static void _add_entry_to_list(ztimer_clock_t *clock, ztimer_base_t *entry)
 {
     uint32_t delta_sum = 0;
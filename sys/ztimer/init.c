@@ -236,6 +236,9 @@ ztimer_clock_t *const ZTIMER_MSEC = &_ztimer_convert_frac_msec.super.super;
 #  else
 ztimer_clock_t *const ZTIMER_MSEC = ZTIMER_MSEC_BASE;
 #   endif
+#  if MODULE_ZTIMER_WHEEL
+static ztimer_wheel_t _ztimer_wheel_msec;
+#  endif
 #endif
 
 #if MODULE_ZTIMER_SEC
@@ -407,6 +410,10 @@ void ztimer_init(void)
               CONFIG_ZTIMER_MSEC_ADJUST);
     ZTIMER_MSEC->adjust = CONFIG_ZTIMER_MSEC_ADJUST;
 #  endif
+#  if MODULE_ZTIMER_WHEEL
+    LOG_DEBUG("ztimer_init(): ZTIMER_MSEC using a timer wheel\n");
+    ztimer_wheel_init(ZTIMER_MSEC, &_ztimer_wheel_msec);
+#  endif
 #endif
 
 #if MODULE_ZTIMER_SEC
@@ -0,0 +1,102 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Throughput benchmark for ChaCha20-Poly1305
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "container.h"
+#include "crypto/chacha20poly1305.h"
+#include "ztimer.h"
+#include "ztimer/stopwatch.h"
+
+#ifndef BENCH_BYTES
+#define BENCH_BYTES         (1024UL * 1024UL)
+#endif
+
+#ifndef BENCH_MAX_LEN
+#define BENCH_MAX_LEN       (4096U)
+#endif
+
+static const uint8_t _key[CHACHA20POLY1305_KEY_BYTES] = { 0x42 };
+static const uint8_t _nonce[CHACHA20POLY1305_NONCE_BYTES] = { 0x23 };
+static const uint8_t _aad[12] = { 0x17 };
+
+static uint8_t _msg[BENCH_MAX_LEN];
+static uint8_t _cipher[BENCH_MAX_LEN + CHACHA20POLY1305_TAG_BYTES];
+static uint8_t _plain[BENCH_MAX_LEN];
+
+static void _print(const char *name, size_t len, uint32_t time,
+                   unsigned long runs)
+{
+    /* bytes per millisecond is kB/s */
+    uint32_t kb_per_sec = (uint32_t)((uint64_t)len * runs * 1000 / time);
+
+    printf("%s %4u byte: %9" PRIu32 "us  ---  %4" PRIu32 ".%03" PRIu32
+           " MB/s\n", name, (unsigned)len, time, kb_per_sec / 1000,
+           kb_per_sec % 1000);
+}
+
+static int _bench(size_t len)
+{
+    unsigned long runs = BENCH_BYTES / len;
+    ztimer_stopwatch_t timer = { .clock = ZTIMER_USEC };
+    size_t plain_len;
+    int res = 1;
+
+    ztimer_stopwatch_start(&timer);
+    for (unsigned long i = 0; i < runs; i++) {
+        chacha20poly1305_encrypt(_cipher, _msg, len, _aad, sizeof(_aad),
+                                 _key, _nonce);
+    }
+    _print("encrypt", len, ztimer_stopwatch_measure(&timer), runs);
+
+    ztimer_stopwatch_reset(&timer);
+    for (unsigned long i = 0; i < runs; i++) {
+        res &= chacha20poly1305_decrypt(_cipher,
+                                        len + CHACHA20POLY1305_TAG_BYTES,
+                                        _plain, &plain_len, _aad, sizeof(_aad),
+                                        _key, _nonce);
+    }
+    _print("decrypt", len, ztimer_stopwatch_measure(&timer), runs);
+    ztimer_stopwatch_stop(&timer);
+
+    if (!res || (plain_len != len) || memcmp(_plain, _msg, len)) {
+        return -1;
+    }
+    return 0;
+}
+
+int main(void)
+{
+    static const size_t lens[] = { 64, 256, 1024, BENCH_MAX_LEN };
+
+    puts("ChaCha20-Poly1305 throughput benchmark");
+
+    for (unsigned i = 0; i < sizeof(_msg); i++) {
+        _msg[i] = i;
+    }
+    for (unsigned i = 0; i < ARRAY_SIZE(lens); i++) {
+        if (_bench(lens[i]) != 0) {
+            puts("\n[FAILED]");
+            return 1;
+        }
+    }
+    puts("\n[SUCCESS]");
+    return 0;
+}
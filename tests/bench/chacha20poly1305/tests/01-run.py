@@ -0,0 +1,25 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 Freie Universität Berlin
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+BENCHMARK_REGEXP = r"{op}\s+{len} byte:\s+\d+us\s+---\s+\d+\.\d+ MB/s"
+
+
+def testfunc(child):
+    child.expect_exact("ChaCha20-Poly1305 throughput benchmark")
+    for length in (64, 256, 1024, 4096):
+        child.expect(BENCHMARK_REGEXP.format(op="encrypt", len=length))
+        child.expect(BENCHMARK_REGEXP.format(op="decrypt", len=length))
+    child.expect_exact("[SUCCESS]")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
@@ -0,0 +1,112 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Throughput benchmark for the CRC implementations
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#include "checksum/crc16_ccitt.h"
+#include "checksum/crc32.h"
+#include "checksum/ucrc16.h"
+#include "kernel_defines.h"
+#include "periph_conf.h"
+#include "time_units.h"
+#include "ztimer.h"
+#include "ztimer/stopwatch.h"
+
+#ifndef BENCH_LEN
+#define BENCH_LEN           (1024U)
+#endif
+
+#ifndef BENCH_RUNS
+#define BENCH_RUNS          (1000UL)
+#endif
+
+static uint8_t _data[BENCH_LEN];
+static volatile uint32_t _sink;
+
+#define BENCH_CRC(name, call) \
+    do { \
+        ztimer_stopwatch_t timer = { .clock = ZTIMER_USEC }; \
+        ztimer_stopwatch_start(&timer); \
+        for (unsigned long i = 0; i < BENCH_RUNS; i++) { \
+            _sink = call; \
+        } \
+        _print(name, ztimer_stopwatch_measure(&timer)); \
+        ztimer_stopwatch_stop(&timer); \
+    } while (0)
+
+/* bitwise reference the result of crc32() is checked against */
+static uint32_t _crc32_ref(const uint8_t *buf, size_t len)
+{
+    uint32_t crc = ~0U;
+
+    for (size_t i = 0; i < len; i++) {
+        crc ^= buf[i];
+        for (unsigned bit = 0; bit < 8; bit++) {
+            crc = (crc >> 1) ^ ((crc & 1) ? 0xEDB88320U : 0);
+        }
+    }
+    return ~crc;
+}
+
+static void _print(const char *name, uint32_t time)
+{
+    uint64_t bytes = (uint64_t)BENCH_LEN * BENCH_RUNS;
+    /* bytes per millisecond is kB/s */
+    uint32_t kb_per_sec = bytes * 1000 / time;
+
+    printf("%20s: %9" PRIu32 "us  ---  %5" PRIu32 ".%03" PRIu32 " MB/s",
+           name, time, kb_per_sec / 1000, kb_per_sec % 1000);
+#ifdef CLOCK_CORECLOCK
+    /* in hundredths */
+    uint32_t cycles = (uint64_t)time * (CLOCK_CORECLOCK / US_PER_SEC) * 100 /
+                      bytes;
+    printf("  ---  %3" PRIu32 ".%02" PRIu32 " cycles/byte",
+           cycles / 100, cycles % 100);
+#endif
+    puts("");
+}
+
+int main(void)
+{
+    puts("CRC throughput benchmark");
+    /* flash used by the lookup tables */
+    printf("crc16 tables: %u byte\n",
+           IS_USED(MODULE_CRC16_FAST) ? 2 * 256 * 2 : 0);
+    printf("crc32 tables: %u byte\n",
+           IS_USED(MODULE_CRC32_FAST) ? CONFIG_CRC32_FAST_SLICES * 256 * 4 : 0);
+
+    for (unsigned i = 0; i < sizeof(_data); i++) {
+        _data[i] = i;
+    }
+
+    BENCH_CRC("crc32", crc32(_data, sizeof(_data)));
+    if (_sink != _crc32_ref(_data, sizeof(_data))) {
+        printf("crc32: FAIL (0x%08" PRIx32 ")\n", _sink);
+        return 1;
+    }
+    BENCH_CRC("crc16_ccitt_kermit",
+              crc16_ccitt_kermit_calc(_data, sizeof(_data)));
+    BENCH_CRC("crc16_ccitt_false",
+              crc16_ccitt_false_calc(_data, sizeof(_data)));
+    BENCH_CRC("ucrc16_le",
+              ucrc16_calc_le(_data, sizeof(_data), UCRC16_CCITT_POLY_LE, 0));
+
+    puts("\n[SUCCESS]");
+    return 0;
+}
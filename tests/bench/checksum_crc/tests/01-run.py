@@ -0,0 +1,27 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 Freie Universität Berlin
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+BENCHMARK_REGEXP = r"\s+{func}:\s+\d+us\s+---\s+\d+\.\d+ MB/s"
+
+
+def testfunc(child):
+    child.expect_exact("CRC throughput benchmark")
+    child.expect(r"crc16 tables: \d+ byte\r\n")
+    child.expect(r"crc32 tables: \d+ byte\r\n")
+    for func in ("crc32", "crc16_ccitt_kermit", "crc16_ccitt_false",
+                 "ucrc16_le"):
+        child.expect(BENCHMARK_REGEXP.format(func=func))
+    child.expect_exact("[SUCCESS]")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
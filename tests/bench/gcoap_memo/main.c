@@ -0,0 +1,192 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Request/response round trip time of gcoap vs. the number of
+ *              observe registrations
+ *
+ * @}
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "benchmark.h"
+#include "kernel_defines.h"
+#include "mutex.h"
+#include "net/gcoap.h"
+#include "net/ipv6/addr.h"
+
+#ifndef BENCH_RUNS
+#define BENCH_RUNS          (1000UL)
+#endif
+
+#define OBS_PATH_FMT        "/obs/%u"
+#define OBS_PATH_LEN        sizeof("/obs/65535")
+
+static ssize_t _ping_handler(coap_pkt_t *pdu, uint8_t *buf, size_t len,
+                             coap_request_ctx_t *ctx);
+static ssize_t _obs_handler(coap_pkt_t *pdu, uint8_t *buf, size_t len,
+                            coap_request_ctx_t *ctx);
+
+static char _obs_paths[NUMOF_OBSERVERS][OBS_PATH_LEN];
+/* the unobserved resource is checked first, so resource lookup does not
+ * depend on the number of observed resources */
+static coap_resource_t _resources[NUMOF_OBSERVERS + 1] = {
+    { "/ping", COAP_GET, _ping_handler, NULL },
+};
+
+static gcoap_listener_t _listener = {
+    .resources = _resources,
+    .resources_len = ARRAY_SIZE(_resources),
+};
+
+static sock_udp_ep_t _remote = {
+    .family = AF_INET6,
+    .netif = SOCK_ADDR_ANY_NETIF,
+    .port = CONFIG_GCOAP_PORT,
+};
+
+static uint8_t _buf[CONFIG_GCOAP_PDU_BUF_SIZE];
+static mutex_t _resp_lock = MUTEX_INIT_LOCKED;
+static unsigned _notifications;
+static bool _resp_ok;
+
+static ssize_t _ping_handler(coap_pkt_t *pdu, uint8_t *buf, size_t len,
+                             coap_request_ctx_t *ctx)
+{
+    (void)ctx;
+    gcoap_resp_init(pdu, buf, len, COAP_CODE_CONTENT);
+    return coap_opt_finish(pdu, COAP_OPT_FINISH_NONE);
+}
+
+static ssize_t _obs_handler(coap_pkt_t *pdu, uint8_t *buf, size_t len,
+                            coap_request_ctx_t *ctx)
+{
+    (void)ctx;
+    gcoap_resp_init(pdu, buf, len, COAP_CODE_CONTENT);
+    return coap_opt_finish(pdu, COAP_OPT_FINISH_NONE);
+}
+
+static void _resp_handler(const gcoap_request_memo_t *memo, coap_pkt_t *pdu,
+                          const sock_udp_ep_t *remote)
+{
+    (void)remote;
+    _resp_ok = (memo->state == GCOAP_MEMO_RESP) &&
+               (coap_get_code_class(pdu) == COAP_CLASS_SUCCESS);
+    mutex_unlock(&_resp_lock);
+}
+
+static void _notify_handler(const gcoap_request_memo_t *memo, coap_pkt_t *pdu,
+                            const sock_udp_ep_t *remote)
+{
+    (void)remote;
+    /* each notification must be matched to the request for its resource */
+    if ((memo->state == GCOAP_MEMO_RESP) && coap_has_observe(pdu) &&
+        ((uintptr_t)memo->context == (uintptr_t)_notifications)) {
+        _notifications++;
+    }
+    mutex_unlock(&_resp_lock);
+}
+
+static bool _request(const char *path, bool observe,
+                     gcoap_resp_handler_t handler, void *context)
+{
+    coap_pkt_t pdu;
+    ssize_t len;
+
+    /* Observe option precedes Uri-Path */
+    gcoap_req_init(&pdu, _buf, sizeof(_buf), COAP_METHOD_GET, NULL);
+    if (observe) {
+        coap_opt_add_uint(&pdu, COAP_OPT_OBSERVE, COAP_OBS_REGISTER);
+    }
+    coap_opt_add_uri_path(&pdu, path);
+    len = coap_opt_finish(&pdu, COAP_OPT_FINISH_NONE);
+    _resp_ok = false;
+    if (gcoap_req_send(_buf, len, &_remote, handler, context,
+                       GCOAP_SOCKET_TYPE_UDP) <= 0) {
+        return false;
+    }
+    mutex_lock(&_resp_lock);
+    return true;
+}
+
+static bool _notify(unsigned idx)
+{
+    coap_pkt_t pdu;
+    ssize_t len;
+
+    if (gcoap_obs_init(&pdu, _buf, sizeof(_buf), &_resources[idx + 1]) !=
+        GCOAP_OBS_INIT_OK) {
+        return false;
+    }
+    len = coap_opt_finish(&pdu, COAP_OPT_FINISH_NONE);
+    if (gcoap_obs_send(_buf, len, &_resources[idx + 1]) <= 0) {
+        return false;
+    }
+    mutex_lock(&_resp_lock);
+    return true;
+}
+
+static void _ping(void)
+{
+    _request("/ping", false, _resp_handler, NULL);
+}
+
+int main(void)
+{
+    unsigned observers = 0;
+
+    puts("gcoap memo lookup benchmark");
+    printf("lookup: %s\n",
+           IS_ACTIVE(CONFIG_GCOAP_MEMO_HASH) ? "hash" : "linear");
+
+    for (unsigned i = 0; i < NUMOF_OBSERVERS; i++) {
+        snprintf(_obs_paths[i], OBS_PATH_LEN, OBS_PATH_FMT, i);
+        _resources[i + 1] = (coap_resource_t){
+            _obs_paths[i], COAP_GET, _obs_handler, NULL
+        };
+    }
+    memcpy(_remote.addr.ipv6, &ipv6_addr_loopback, sizeof(_remote.addr.ipv6));
+    gcoap_register_listener(&_listener);
+
+    for (unsigned size = 1; size <= NUMOF_OBSERVERS; size *= 2) {
+        for (; observers < size; observers++) {
+            /* the response to the registration is the first notification */
+            _notifications = observers;
+            if (!_request(_obs_paths[observers], true, _notify_handler,
+                          (void *)(uintptr_t)observers) ||
+                (_notifications != (observers + 1))) {
+                printf("Unable to observe %s\n", _obs_paths[observers]);
+                return 1;
+            }
+        }
+        if (!_request("/ping", false, _resp_handler, NULL) || !_resp_ok) {
+            printf("%u observers: FAIL\n", observers);
+            return 1;
+        }
+        printf("%u observers: OK\n", observers);
+        BENCHMARK_FUNC("GET round trip", BENCH_RUNS, _ping());
+    }
+
+    for (unsigned i = 0; i < observers; i++) {
+        _notifications = i;
+        if (!_notify(i) || (_notifications != (i + 1))) {
+            printf("notification %u: FAIL\n", i);
+            return 1;
+        }
+    }
+    puts("notifications: OK");
+
+    puts("\n[SUCCESS]");
+    return 0;
+}
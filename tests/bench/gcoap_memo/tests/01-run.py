@@ -0,0 +1,29 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 Freie Universität Berlin
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+BENCHMARK_REGEXP = r"\s+{func}:\s+\d+us\s+---\s+\d*\.*\d+us per call\s+---\s+\d+ calls per sec"
+
+
+def testfunc(child):
+    child.expect_exact("gcoap memo lookup benchmark")
+    child.expect(r"lookup: (hash|linear)\r\n")
+    while True:
+        res = child.expect([r"(\d+) observers: OK\r\n",
+                            r"notifications: OK\r\n"])
+        if res == 1:
+            break
+        child.expect(BENCHMARK_REGEXP.format(func="GET round trip"), timeout=120)
+    child.expect_exact("[SUCCESS]")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
@@ -0,0 +1,138 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Route lookup rate of the NIB forwarding table vs. its size
+ *
+ * @}
+ */
+
+#include <stdbool.h>
+#include <stdio.h>
+
+#include "benchmark.h"
+#include "kernel_defines.h"
+#include "net/gnrc/ipv6/nib/conf.h"
+#include "net/gnrc/ipv6/nib/ft.h"
+#include "net/ipv6/addr.h"
+#include "random.h"
+
+#ifndef BENCH_RUNS
+#define BENCH_RUNS          (10UL * 1000UL)
+#endif
+
+#define ROUTES_NUMOF        (CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF)
+#define DSTS_NUMOF          (64U)
+#define IFACE               (6U)
+
+static const ipv6_addr_t _next_hop = { .u8 = {
+        0xfe, 0x80, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x01
+    }
+};
+
+static ipv6_addr_t _pfxs[ROUTES_NUMOF];
+static uint8_t _pfx_lens[ROUTES_NUMOF];
+static ipv6_addr_t _dsts[DSTS_NUMOF];
+static unsigned _dst_idx;
+
+static void _random_route(ipv6_addr_t *pfx, uint8_t *pfx_len)
+{
+    static const uint8_t lens[] = { 48, 56, 64, 128, 128, 128, 128, 128 };
+    ipv6_addr_t tmp;
+
+    /* 2001:db8::/32 */
+    ipv6_addr_from_str(&tmp, "2001:db8::");
+    random_bytes(&tmp.u8[4], sizeof(tmp) - 4);
+    *pfx_len = lens[random_uint32_range(0, ARRAY_SIZE(lens))];
+    ipv6_addr_set_unspecified(pfx);
+    ipv6_addr_init_prefix(pfx, &tmp, *pfx_len);
+}
+
+static void _random_dst(ipv6_addr_t *dst, unsigned routes)
+{
+    unsigned idx = random_uint32_range(0, routes);
+
+    random_bytes(dst->u8, sizeof(*dst));
+    ipv6_addr_init_prefix(dst, &_pfxs[idx], _pfx_lens[idx]);
+}
+
+/* route the NIB is expected to yield: most bits in common with dst, first
+ * added wins on a tie */
+static int _expected_route(const ipv6_addr_t *dst, unsigned routes)
+{
+    int res = -1;
+    uint8_t best_match = 0;
+
+    for (unsigned i = 0; i < routes; i++) {
+        uint8_t match = ipv6_addr_match_prefix(&_pfxs[i], dst);
+
+        if ((match > best_match) && (match >= _pfx_lens[i])) {
+            res = i;
+            best_match = match;
+        }
+    }
+    return res;
+}
+
+static bool _check(unsigned routes)
+{
+    for (unsigned i = 0; i < DSTS_NUMOF; i++) {
+        gnrc_ipv6_nib_ft_t fte;
+        int exp = _expected_route(&_dsts[i], routes);
+
+        if ((gnrc_ipv6_nib_ft_get(&_dsts[i], NULL, &fte) < 0) || (exp < 0) ||
+            (fte.dst_len != _pfx_lens[exp]) ||
+            !ipv6_addr_equal(&fte.dst, &_pfxs[exp])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static void _lookup(void)
+{
+    gnrc_ipv6_nib_ft_t fte;
+
+    gnrc_ipv6_nib_ft_get(&_dsts[_dst_idx++ % DSTS_NUMOF], NULL, &fte);
+}
+
+int main(void)
+{
+    unsigned routes = 0;
+
+    puts("NIB forwarding table lookup benchmark");
+    printf("lookup: %s\n",
+           IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_OFFL_TRIE) ? "trie" : "linear");
+
+    for (unsigned size = 8; size <= ROUTES_NUMOF; size *= 2) {
+        for (; routes < size; routes++) {
+            _random_route(&_pfxs[routes], &_pfx_lens[routes]);
+            if (gnrc_ipv6_nib_ft_add(&_pfxs[routes], _pfx_lens[routes],
+                                     &_next_hop, IFACE, 0) < 0) {
+                printf("Unable to add route %u\n", routes);
+                return 1;
+            }
+        }
+        for (unsigned i = 0; i < DSTS_NUMOF; i++) {
+            _random_dst(&_dsts[i], routes);
+        }
+        if (!_check(routes)) {
+            printf("%u routes: FAIL\n", routes);
+            return 1;
+        }
+        printf("%u routes: OK\n", routes);
+        BENCHMARK_FUNC("ft_get()", BENCH_RUNS, _lookup());
+    }
+
+    puts("\n[SUCCESS]");
+    return 0;
+}
@@ -0,0 +1,27 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 Freie Universität Berlin
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+BENCHMARK_REGEXP = r"\s+{func}:\s+\d+us\s+---\s+\d*\.*\d+us per call\s+---\s+\d+ calls per sec"
+
+
+def testfunc(child):
+    child.expect_exact("NIB forwarding table lookup benchmark")
+    child.expect(r"lookup: (trie|linear)\r\n")
+    while True:
+        res = child.expect([r"(\d+) routes: OK\r\n", r"\[SUCCESS\]"])
+        if res == 1:
+            break
+        child.expect(BENCHMARK_REGEXP.format(func=r"ft_get\(\)"), timeout=60)
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
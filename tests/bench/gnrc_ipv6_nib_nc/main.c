@@ -0,0 +1,110 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Neighbor cache lookup cost of the NIB vs. its size
+ *
+ * @}
+ */
+
+#include <stdbool.h>
+#include <stdio.h>
+
+#include "benchmark.h"
+#include "kernel_defines.h"
+#include "net/gnrc/ipv6/nib/conf.h"
+#include "net/gnrc/ipv6/nib/nc.h"
+#include "net/ipv6/addr.h"
+
+#include "_nib-internal.h"
+
+#ifndef BENCH_RUNS
+#define BENCH_RUNS          (10UL * 1000UL)
+#endif
+
+#define NEIGHBORS_NUMOF     (CONFIG_GNRC_IPV6_NIB_NUMOF)
+#define IFACE               (6U)
+
+static const uint8_t _l2addr[] = { 0x02, 0x00, 0x00, 0xff, 0xfe, 0, 0, 0x01 };
+static unsigned _neighbors;
+static unsigned _idx;
+
+static void _neighbor_addr(ipv6_addr_t *addr, unsigned n)
+{
+    ipv6_addr_from_str(addr, "fe80::ff:fe00:0");
+    addr->u16[7] = byteorder_htons(n);
+}
+
+static void _onl_get(void)
+{
+    ipv6_addr_t addr;
+
+    _neighbor_addr(&addr, _idx++ % _neighbors);
+    _nib_acquire();
+    _nib_onl_get(&addr, IFACE);
+    _nib_release();
+}
+
+static void _nc_set(void)
+{
+    ipv6_addr_t addr;
+
+    _neighbor_addr(&addr, _idx++ % _neighbors);
+    gnrc_ipv6_nib_nc_set(&addr, IFACE, _l2addr, sizeof(_l2addr));
+}
+
+static bool _check(void)
+{
+    for (unsigned i = 0; i < _neighbors; i++) {
+        ipv6_addr_t addr;
+        _nib_onl_entry_t *node;
+
+        _neighbor_addr(&addr, i);
+        _nib_acquire();
+        node = _nib_onl_get(&addr, IFACE);
+        _nib_release();
+        if ((node == NULL) || !ipv6_addr_equal(&node->ipv6, &addr)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+int main(void)
+{
+    puts("NIB neighbor cache lookup benchmark");
+    printf("lookup: %s\n",
+           IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_NC_HASH) ? "hash" : "linear");
+
+    for (unsigned size = 8; size <= NEIGHBORS_NUMOF; size *= 2) {
+        for (; _neighbors < size; _neighbors++) {
+            ipv6_addr_t addr;
+
+            _neighbor_addr(&addr, _neighbors);
+            if (gnrc_ipv6_nib_nc_set(&addr, IFACE, _l2addr,
+                                     sizeof(_l2addr)) < 0) {
+                printf("Unable to add neighbor %u\n", _neighbors);
+                return 1;
+            }
+        }
+        if (!_check()) {
+            printf("%u neighbors: FAIL\n", _neighbors);
+            return 1;
+        }
+        printf("%u neighbors: OK\n", _neighbors);
+        BENCHMARK_FUNC("_nib_onl_get()", BENCH_RUNS, _onl_get());
+        BENCHMARK_FUNC("nc_set() existing", BENCH_RUNS, _nc_set());
+    }
+
+    puts("\n[SUCCESS]");
+    return 0;
+}
@@ -0,0 +1,219 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Packet buffer stress benchmark with a 6LoWPAN-like workload
+ *
+ * @}
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "benchmark.h"
+#include "kernel_defines.h"
+#include "net/gnrc/netif/hdr.h"
+#include "net/gnrc/pktbuf.h"
+#include "random.h"
+
+#ifndef BENCH_RUNS
+#define BENCH_RUNS          (100UL * 1000UL)
+#endif
+
+#ifndef BENCH_SEED
+#define BENCH_SEED          (0x5eed)
+#endif
+
+/* packets in flight at most */
+#define SLOTS_NUMOF         (12U)
+
+/* netif header with two 8 byte addresses */
+#define NETIF_HDR_LEN       (sizeof(gnrc_netif_hdr_t) + 16U)
+
+typedef struct {
+    gnrc_pktsnip_t *pkt;
+    uint8_t fill;
+} _slot_t;
+
+static _slot_t _slots[SLOTS_NUMOF];
+static uint8_t _fill;
+static unsigned _fails;
+static unsigned _corrupt;
+
+/* only the first and the last byte of a snip are written and checked, so the
+ * benchmark is not dominated by copying */
+static void _fill_snip(gnrc_pktsnip_t *snip)
+{
+    uint8_t *data = snip->data;
+
+    data[0] = _fill;
+    data[snip->size - 1] = _fill;
+}
+
+static bool _check(const gnrc_pktsnip_t *pkt, uint8_t fill)
+{
+    for (; pkt != NULL; pkt = pkt->next) {
+        const uint8_t *data = pkt->data;
+
+        if ((pkt->size > 0) &&
+            ((data[0] != fill) || (data[pkt->size - 1] != fill))) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static gnrc_pktsnip_t *_add_netif_hdr(gnrc_pktsnip_t *pkt)
+{
+    gnrc_pktsnip_t *netif;
+
+    if (pkt == NULL) {
+        return NULL;
+    }
+    netif = gnrc_pktbuf_add(NULL, NULL, NETIF_HDR_LEN, GNRC_NETTYPE_NETIF);
+    if (netif == NULL) {
+        gnrc_pktbuf_release(pkt);
+        return NULL;
+    }
+    _fill_snip(netif);
+    return gnrc_pkt_append(pkt, netif);
+}
+
+/* received 6LoWPAN fragment: the IEEE 802.15.4 MAC header and the
+ * fragmentation header are marked in the frame as read from the device */
+static gnrc_pktsnip_t *_rx_frag(void)
+{
+    size_t mhr_len = random_uint32_range(9, 24);
+    gnrc_pktsnip_t *pkt = gnrc_pktbuf_add(NULL, NULL,
+                                          random_uint32_range(mhr_len + 5, 128),
+                                          GNRC_NETTYPE_UNDEF);
+
+    if (pkt == NULL) {
+        return NULL;
+    }
+    /* as written by the device */
+    memset(pkt->data, _fill, pkt->size);
+    if ((gnrc_pktbuf_mark(pkt, mhr_len, GNRC_NETTYPE_UNDEF) == NULL) ||
+        (gnrc_pktbuf_mark(pkt, 4, GNRC_NETTYPE_UNDEF) == NULL)) {
+        gnrc_pktbuf_release(pkt);
+        return NULL;
+    }
+    return _add_netif_hdr(pkt);
+}
+
+/* reassembly buffer for a datagram */
+static gnrc_pktsnip_t *_reass(void)
+{
+    gnrc_pktsnip_t *pkt = gnrc_pktbuf_add(NULL, NULL,
+                                          random_uint32_range(256, 1281),
+                                          GNRC_NETTYPE_UNDEF);
+
+    if (pkt != NULL) {
+        _fill_snip(pkt);
+    }
+    return _add_netif_hdr(pkt);
+}
+
+/* outgoing UDP datagram, headers prepended by the stack and sometimes merged
+ * for fragmentation */
+static gnrc_pktsnip_t *_tx(void)
+{
+    static const size_t hdr_lens[] = { 8, 40 };
+    gnrc_pktsnip_t *pkt = gnrc_pktbuf_add(NULL, NULL,
+                                          random_uint32_range(16, 513),
+                                          GNRC_NETTYPE_UNDEF);
+
+    if (pkt == NULL) {
+        return NULL;
+    }
+    _fill_snip(pkt);
+    for (unsigned i = 0; i < ARRAY_SIZE(hdr_lens); i++) {
+        gnrc_pktsnip_t *hdr = gnrc_pktbuf_add(pkt, NULL, hdr_lens[i],
+                                              GNRC_NETTYPE_UNDEF);
+
+        if (hdr == NULL) {
+            gnrc_pktbuf_release(pkt);
+            return NULL;
+        }
+        _fill_snip(hdr);
+        pkt = hdr;
+    }
+    if ((random_uint32() & 0x1) && (gnrc_pktbuf_merge(pkt) != 0)) {
+        gnrc_pktbuf_release(pkt);
+        return NULL;
+    }
+    pkt = gnrc_pktbuf_add(pkt, NULL, NETIF_HDR_LEN, GNRC_NETTYPE_NETIF);
+    if (pkt != NULL) {
+        _fill_snip(pkt);
+    }
+    return pkt;
+}
+
+static void _step(void)
+{
+    _slot_t *slot = &_slots[random_uint32_range(0, SLOTS_NUMOF)];
+    unsigned op;
+
+    if (slot->pkt != NULL) {
+        if (!_check(slot->pkt, slot->fill)) {
+            _corrupt++;
+        }
+        gnrc_pktbuf_release(slot->pkt);
+        slot->pkt = NULL;
+        return;
+    }
+    _fill++;
+    op = random_uint32_range(0, 10);
+    if (op < 5) {
+        slot->pkt = _rx_frag();
+    }
+    else if (op < 7) {
+        slot->pkt = _reass();
+    }
+    else {
+        slot->pkt = _tx();
+    }
+    if (slot->pkt == NULL) {
+        _fails++;
+    }
+    slot->fill = _fill;
+}
+
+int main(void)
+{
+    puts("Packet buffer stress benchmark");
+    printf("backend: %s\n",
+           IS_USED(MODULE_GNRC_PKTBUF_SLAB) ? "slab" :
+           IS_USED(MODULE_GNRC_PKTBUF_MALLOC) ? "malloc" : "static");
+
+    random_init(BENCH_SEED);
+    BENCHMARK_FUNC("step", BENCH_RUNS, _step());
+    printf("failed allocations: %u\n", _fails);
+#ifdef DEVELHELP
+    gnrc_pktbuf_stats();
+#endif
+    for (unsigned i = 0; i < SLOTS_NUMOF; i++) {
+        if ((_slots[i].pkt != NULL) && !_check(_slots[i].pkt, _slots[i].fill)) {
+            _corrupt++;
+        }
+        gnrc_pktbuf_release(_slots[i].pkt);
+    }
+    if (_corrupt > 0) {
+        printf("%u packets corrupted\n", _corrupt);
+        puts("\n[FAILED]");
+        return 1;
+    }
+    puts("\n[SUCCESS]");
+    return 0;
+}
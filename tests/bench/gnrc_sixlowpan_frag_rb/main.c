@@ -0,0 +1,190 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       6LoWPAN reassembly cost vs. the number of datagrams
+ *              reassembled concurrently
+ *
+ * @}
+ */
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "benchmark.h"
+#include "net/gnrc/netif/hdr.h"
+#include "net/gnrc/netreg.h"
+#include "net/gnrc/pktbuf.h"
+#include "net/gnrc/sixlowpan/frag/rb.h"
+#include "net/ipv6.h"
+#include "net/sixlowpan.h"
+
+#ifndef BENCH_ROUNDS
+#define BENCH_ROUNDS        (16U)
+#endif
+
+#define DATAGRAM_SIZE       (IPV6_MIN_MTU)
+#define FRAG_PAYLOAD_SIZE   (96U)
+#define NUMOF_FRAGS         ((DATAGRAM_SIZE + FRAG_PAYLOAD_SIZE - 1) / \
+                             FRAG_PAYLOAD_SIZE)
+
+static struct {
+    gnrc_netif_hdr_t hdr;
+    uint8_t src[IEEE802154_LONG_ADDRESS_LEN];
+    uint8_t dst[IEEE802154_LONG_ADDRESS_LEN];
+} _netif_hdr;
+static uint8_t _src[IEEE802154_LONG_ADDRESS_LEN] = {
+    0xb3, 0x47, 0x60, 0x49, 0x78, 0xfe, 0x00, 0x00,
+};
+static const uint8_t _dst[IEEE802154_LONG_ADDRESS_LEN] = {
+    0xa4, 0xf2, 0xd2, 0xc9, 0x13, 0xb9, 0xbb, 0x25,
+};
+static uint8_t _frag[sizeof(sixlowpan_frag_n_t) + FRAG_PAYLOAD_SIZE];
+static unsigned _numof;
+static unsigned _idx;
+static unsigned _received;
+static unsigned _corrupted;
+
+static uint8_t _datagram_byte(unsigned datagram, unsigned i)
+{
+    /* first byte must not be mistaken for an uncompressed IPv6 dispatch */
+    return (i == 0) ? 0x60 : (uint8_t)(datagram + i);
+}
+
+static void _recv(uint16_t cmd, gnrc_pktsnip_t *pkt, void *ctx)
+{
+    (void)ctx;
+    if (cmd != GNRC_NETAPI_MSG_TYPE_RCV) {
+        gnrc_pktbuf_release(pkt);
+        return;
+    }
+    const gnrc_netif_hdr_t *hdr = pkt->next->data;
+    const uint8_t *src = gnrc_netif_hdr_get_src_addr(hdr);
+    unsigned datagram = (src[6] << 8) | src[7];
+    const uint8_t *data = pkt->data;
+
+    if (pkt->size != DATAGRAM_SIZE) {
+        _corrupted++;
+    }
+    else {
+        for (unsigned i = 0; i < DATAGRAM_SIZE; i++) {
+            if (data[i] != _datagram_byte(datagram, i)) {
+                _corrupted++;
+                break;
+            }
+        }
+    }
+    _received++;
+    gnrc_pktbuf_release(pkt);
+}
+
+static gnrc_netreg_entry_cbd_t _recv_cbd = { .cb = _recv };
+static gnrc_netreg_entry_t _recv_reg = GNRC_NETREG_ENTRY_INIT_CB(
+        GNRC_NETREG_DEMUX_CTX_ALL, &_recv_cbd
+    );
+
+/* adds the next fragment: all datagrams of a round are received interleaved,
+ * the fragments of every other datagram in reverse order */
+static void _add(void)
+{
+    unsigned round = _idx / (_numof * NUMOF_FRAGS);
+    unsigned datagram = _idx % _numof;
+    unsigned frag = (_idx / _numof) % NUMOF_FRAGS;
+    uint16_t tag = (round * _numof) + datagram;
+    sixlowpan_frag_n_t *hdr = (sixlowpan_frag_n_t *)_frag;
+    size_t hdr_size = sizeof(sixlowpan_frag_n_t);
+    size_t offset, size;
+    gnrc_pktsnip_t *pkt;
+    gnrc_sixlowpan_frag_rb_t *entry;
+
+    _idx++;
+    if (datagram & 1) {
+        frag = NUMOF_FRAGS - 1 - frag;
+    }
+    offset = frag * FRAG_PAYLOAD_SIZE;
+    size = DATAGRAM_SIZE - offset;
+    if (size > FRAG_PAYLOAD_SIZE) {
+        size = FRAG_PAYLOAD_SIZE;
+    }
+    hdr->disp_size = byteorder_htons(DATAGRAM_SIZE);
+    hdr->tag = byteorder_htons(tag);
+    if (offset == 0) {
+        hdr->disp_size.u8[0] |= SIXLOWPAN_FRAG_1_DISP;
+        hdr_size = sizeof(sixlowpan_frag_t);
+    }
+    else {
+        hdr->disp_size.u8[0] |= SIXLOWPAN_FRAG_N_DISP;
+        hdr->offset = offset / 8;
+    }
+    for (unsigned i = 0; i < size; i++) {
+        _frag[hdr_size + i] = _datagram_byte(datagram, offset + i);
+    }
+    _src[6] = datagram >> 8;
+    _src[7] = datagram & 0xff;
+    gnrc_netif_hdr_set_src_addr(&_netif_hdr.hdr, _src, sizeof(_src));
+
+    pkt = gnrc_pktbuf_add(NULL, _frag, hdr_size + size, GNRC_NETTYPE_SIXLOWPAN);
+    if ((pkt != NULL) &&
+        ((entry = gnrc_sixlowpan_frag_rb_add(&_netif_hdr.hdr, pkt, offset,
+                                             0)) != NULL)) {
+        gnrc_sixlowpan_frag_rb_dispatch_when_complete(entry, &_netif_hdr.hdr);
+    }
+}
+
+static bool _rbuf_empty(void)
+{
+    const gnrc_sixlowpan_frag_rb_t *rbuf = gnrc_sixlowpan_frag_rb_array();
+
+    for (unsigned i = 0; i < CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE; i++) {
+        if (!gnrc_sixlowpan_frag_rb_entry_empty(&rbuf[i])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+int main(void)
+{
+    gnrc_pktbuf_init();
+    gnrc_netif_hdr_init(&_netif_hdr.hdr, sizeof(_src), sizeof(_dst));
+    gnrc_netif_hdr_set_dst_addr(&_netif_hdr.hdr, (uint8_t *)_dst,
+                                sizeof(_dst));
+    gnrc_netreg_register(GNRC_NETTYPE_UNDEF, &_recv_reg);
+
+    puts("6LoWPAN reassembly buffer benchmark");
+    printf("buckets: %u, bitmap: %u\n",
+           (unsigned)CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_BUCKETS,
+           (unsigned)GNRC_SIXLOWPAN_FRAG_RB_BITMAP);
+
+    for (_numof = 8; _numof <= CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE;
+         _numof *= 2) {
+        _idx = 0;
+        _received = 0;
+        _corrupted = 0;
+        BENCHMARK_FUNC("fragment", BENCH_ROUNDS * _numof * NUMOF_FRAGS, _add());
+        /* the shared interval pool is sized for 99 byte fragments, so with
+         * the interval list datagrams are dropped when it runs out */
+        if ((GNRC_SIXLOWPAN_FRAG_RB_BITMAP &&
+             (_received != (BENCH_ROUNDS * _numof))) || (_corrupted > 0) ||
+            !_rbuf_empty() || !gnrc_pktbuf_is_empty()) {
+            printf("%u datagrams: FAIL (%u received, %u corrupted)\n", _numof,
+                   _received, _corrupted);
+            return 1;
+        }
+        printf("%u datagrams: OK (%u of %u reassembled)\n", _numof, _received,
+               BENCH_ROUNDS * _numof);
+    }
+
+    puts("\n[SUCCESS]");
+    return 0;
+}
@@ -0,0 +1,178 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Throughput benchmark for sending fragmented 6LoWPAN datagrams
+ *
+ * @}
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "benchmark.h"
+#include "net/gnrc/ipv6/hdr.h"
+#include "net/gnrc/netif/hdr.h"
+#include "net/gnrc/netif/ieee802154.h"
+#include "net/gnrc/pktbuf.h"
+#include "net/gnrc/sixlowpan.h"
+#include "net/gnrc/sixlowpan/config.h"
+#include "net/gnrc/tx_sync.h"
+#include "net/netdev_test.h"
+#include "net/sixlowpan.h"
+#include "test_utils/expect.h"
+#include "ztimer.h"
+
+#ifndef BENCH_RUNS
+#define BENCH_RUNS          (10UL * 1000UL)
+#endif
+
+/* UDP payload of a datagram filling the minimum IPv6 MTU */
+#define PAYLOAD_SIZE        (1232U)
+
+/* usual payload of an IEEE 802.15.4 frame with long addresses */
+#define MAX_FRAG_SIZE       (102U)
+
+#define LOCAL_EUI64         { 0x02, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x00, 0x01 }
+#define REMOTE_EUI64        { 0x02, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x00, 0x02 }
+
+static gnrc_netif_t _netif;
+static char _netif_stack[THREAD_STACKSIZE_DEFAULT];
+static netdev_test_t _dev;
+static const uint8_t _local_eui64[] = LOCAL_EUI64;
+static const uint8_t _remote_eui64[] = REMOTE_EUI64;
+static uint8_t _payload[PAYLOAD_SIZE];
+
+static unsigned _frames;
+static unsigned _first_frags;
+static unsigned _bad_frames;
+
+static int _get_device_type(netdev_t *netdev, void *value, size_t max_len)
+{
+    expect(max_len == sizeof(uint16_t));
+    (void)netdev;
+    *((uint16_t *)value) = NETDEV_TYPE_IEEE802154;
+    return sizeof(uint16_t);
+}
+
+static int _get_proto(netdev_t *netdev, void *value, size_t max_len)
+{
+    expect(max_len == sizeof(gnrc_nettype_t));
+    (void)netdev;
+    *((gnrc_nettype_t *)value) = GNRC_NETTYPE_SIXLOWPAN;
+    return sizeof(gnrc_nettype_t);
+}
+
+static int _get_max_pdu_size(netdev_t *netdev, void *value, size_t max_len)
+{
+    expect(max_len == sizeof(uint16_t));
+    (void)netdev;
+    *((uint16_t *)value) = MAX_FRAG_SIZE;
+    return sizeof(uint16_t);
+}
+
+static int _get_src_len(netdev_t *netdev, void *value, size_t max_len)
+{
+    expect(max_len == sizeof(uint16_t));
+    (void)netdev;
+    *((uint16_t *)value) = sizeof(_local_eui64);
+    return sizeof(uint16_t);
+}
+
+static int _get_addr_long(netdev_t *netdev, void *value, size_t max_len)
+{
+    expect(max_len >= sizeof(_local_eui64));
+    (void)netdev;
+    memcpy(value, _local_eui64, sizeof(_local_eui64));
+    return sizeof(_local_eui64);
+}
+
+/* the first element of iolist is the MAC header, the frame payload starts
+ * with the fragmentation header */
+static int _send(netdev_t *netdev, const iolist_t *iolist)
+{
+    const uint8_t *disp = iolist->iol_next->iol_base;
+
+    (void)netdev;
+    _frames++;
+    if (sixlowpan_frag_1_is((sixlowpan_frag_t *)disp)) {
+        _first_frags++;
+    }
+    else if (!sixlowpan_frag_n_is((sixlowpan_frag_t *)disp)) {
+        _bad_frames++;
+    }
+    return iolist_size(iolist);
+}
+
+static void _init_netif(void)
+{
+    netdev_test_setup(&_dev, NULL);
+    netdev_test_set_get_cb(&_dev, NETOPT_DEVICE_TYPE, _get_device_type);
+    netdev_test_set_get_cb(&_dev, NETOPT_PROTO, _get_proto);
+    netdev_test_set_get_cb(&_dev, NETOPT_MAX_PDU_SIZE, _get_max_pdu_size);
+    netdev_test_set_get_cb(&_dev, NETOPT_SRC_LEN, _get_src_len);
+    netdev_test_set_get_cb(&_dev, NETOPT_ADDRESS_LONG, _get_addr_long);
+    netdev_test_set_send_cb(&_dev, _send);
+    gnrc_netif_ieee802154_create(&_netif, _netif_stack, sizeof(_netif_stack),
+                                 GNRC_NETIF_PRIO, "bench_netif",
+                                 &_dev.netdev.netdev);
+    /* wait for the thread to start */
+    ztimer_sleep(ZTIMER_MSEC, 1);
+}
+
+/* hands a datagram with link-local addresses to 6LoWPAN and waits until the
+ * last fragment was sent */
+static void _send_datagram(void)
+{
+    ipv6_addr_t src = IPV6_ADDR_UNSPECIFIED, dst = IPV6_ADDR_UNSPECIFIED;
+    gnrc_tx_sync_t tx_sync = gnrc_tx_sync_init();
+    gnrc_pktsnip_t *pkt, *netif_hdr;
+
+    ipv6_addr_set_link_local_prefix(&src);
+    ipv6_addr_set_aiid(&src, (uint8_t *)_local_eui64);
+    ipv6_addr_set_link_local_prefix(&dst);
+    ipv6_addr_set_aiid(&dst, (uint8_t *)_remote_eui64);
+
+    pkt = gnrc_pktbuf_add(NULL, _payload, sizeof(_payload),
+                          GNRC_NETTYPE_UNDEF);
+    expect(pkt != NULL);
+    pkt = gnrc_ipv6_hdr_build(pkt, &src, &dst);
+    expect(pkt != NULL);
+    ((ipv6_hdr_t *)pkt->data)->nh = PROTNUM_IPV6_NONXT;
+    ((ipv6_hdr_t *)pkt->data)->hl = 64;
+    netif_hdr = gnrc_netif_hdr_build(_local_eui64, sizeof(_local_eui64),
+                                     _remote_eui64, sizeof(_remote_eui64));
+    expect(netif_hdr != NULL);
+    gnrc_netif_hdr_set_netif(netif_hdr->data, &_netif);
+    pkt = gnrc_pkt_prepend(pkt, netif_hdr);
+    expect(gnrc_tx_sync_append(pkt, &tx_sync) == 0);
+    expect(gnrc_netapi_send(gnrc_sixlowpan_get_pid(), pkt) == 1);
+    gnrc_tx_sync(&tx_sync);
+}
+
+int main(void)
+{
+    puts("6LoWPAN fragmentation TX benchmark");
+    printf("fragments per message: %u\n", CONFIG_GNRC_SIXLOWPAN_FRAG_TX_BATCH);
+
+    _init_netif();
+    BENCHMARK_FUNC("datagram", BENCH_RUNS, _send_datagram());
+    printf("frames sent: %u (%u per datagram)\n", _frames,
+           _frames / _first_frags);
+    if ((_first_frags != BENCH_RUNS) || (_bad_frames > 0) ||
+        (_frames % _first_frags)) {
+        puts("\n[FAILED]");
+        return 1;
+    }
+    puts("\n[SUCCESS]");
+    return 0;
+}
@@ -0,0 +1,304 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       6LoWPAN IPv6 header compression and decompression benchmark
+ *
+ * @}
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "benchmark.h"
+#include "msg.h"
+#include "net/gnrc/netif.h"
+#include "net/gnrc/netif/hdr.h"
+#include "net/gnrc/netreg.h"
+#include "net/gnrc/pktbuf.h"
+#include "net/gnrc/sixlowpan/config.h"
+#include "net/gnrc/sixlowpan/ctx.h"
+#include "net/gnrc/sixlowpan/iphc.h"
+#include "net/ieee802154.h"
+#include "net/ipv6.h"
+#include "net/l2util.h"
+#include "net/protnum.h"
+#include "test_utils/expect.h"
+
+#ifndef BENCH_RUNS
+#define BENCH_RUNS          (100UL * 1000UL)
+#endif
+
+#define MAIN_QUEUE_SIZE     (4U)
+#define PAYLOAD_SIZE        (32U)
+/* dispatch, traffic class, flow label and both addresses carried inline */
+#define FRAME_MAX_SIZE      (3U + 4U + 2U + (2U * sizeof(ipv6_addr_t)) + \
+                             PAYLOAD_SIZE)
+
+typedef struct {
+    const char *src;
+    const char *dst;
+    uint32_t fl;
+    uint8_t hl;
+    uint8_t dst_l2addr_last;
+} flow_conf_t;
+
+typedef struct {
+    ipv6_hdr_t hdr;
+    uint8_t dst_l2addr[IEEE802154_LONG_ADDRESS_LEN];
+    uint8_t frame[FRAME_MAX_SIZE];
+    size_t frame_len;
+} flow_t;
+
+/* addresses without interface identifier get the one of the link-layer
+ * address appended */
+static const flow_conf_t _flow_confs[] = {
+    /* link-local, everything derived from the link-layer addresses */
+    { .src = "fe80::", .dst = "fe80::", .hl = 64, .dst_l2addr_last = 0x02 },
+    /* context based compression with flow label inline */
+    { .src = "2001:db8::", .dst = "2001:db8::1:2", .fl = 0x12345, .hl = 255,
+      .dst_l2addr_last = 0x03 },
+    /* context based source, link-local multicast destination */
+    { .src = "2001:db8:2::", .dst = "ff02::1a", .hl = 1,
+      .dst_l2addr_last = 0x04 },
+    /* no context for source, 16 bit destination, inline hop limit */
+    { .src = "2001:db8:ffff::1", .dst = "fe80::ff:fe00:42", .hl = 17,
+      .dst_l2addr_last = 0x05 },
+};
+
+#define NUMOF_FLOWS         ARRAY_SIZE(_flow_confs)
+
+static const struct {
+    const char *prefix;
+    uint8_t prefix_len;
+} _ctxs[] = {
+    { "fd00::", 8 },
+    { "2001:db8::", 64 },
+    { "2001:db8:1::", 64 },
+    { "2001:db8:2::", 48 },
+};
+
+static const uint8_t _local_l2addr[] = {
+    0x02, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x00, 0x01,
+};
+
+static gnrc_netif_t _netif;
+static msg_t _main_msg_queue[MAIN_QUEUE_SIZE];
+static flow_t _flows[NUMOF_FLOWS];
+static uint8_t _payload[PAYLOAD_SIZE];
+static unsigned _idx;
+static unsigned _flow;
+static unsigned _ok;
+static unsigned _failed;
+
+static void _recv(uint16_t cmd, gnrc_pktsnip_t *pkt, void *ctx)
+{
+    (void)ctx;
+    gnrc_pktsnip_t *ipv6 = gnrc_pktsnip_search_type(pkt, GNRC_NETTYPE_IPV6);
+
+    if ((cmd == GNRC_NETAPI_MSG_TYPE_RCV) && (ipv6 != NULL) &&
+        (ipv6->size == sizeof(ipv6_hdr_t) + PAYLOAD_SIZE) &&
+        (memcmp(ipv6->data, &_flows[_flow].hdr, sizeof(ipv6_hdr_t)) == 0) &&
+        (memcmp((uint8_t *)ipv6->data + sizeof(ipv6_hdr_t), _payload,
+                PAYLOAD_SIZE) == 0)) {
+        _ok++;
+    }
+    else {
+        _failed++;
+    }
+    gnrc_pktbuf_release(pkt);
+}
+
+static gnrc_netreg_entry_cbd_t _recv_cbd = { .cb = _recv };
+static gnrc_netreg_entry_t _recv_reg = GNRC_NETREG_ENTRY_INIT_CB(
+        GNRC_NETREG_DEMUX_CTX_ALL, &_recv_cbd
+    );
+
+static void _init_netif(void)
+{
+    /* the interface is served by this thread, so packets sent over it end up
+     * in the message queue of the benchmark */
+    _netif.pid = thread_getpid();
+    _netif.device_type = NETDEV_TYPE_IEEE802154;
+    _netif.flags = GNRC_NETIF_FLAGS_HAS_L2ADDR;
+    memcpy(_netif.l2addr, _local_l2addr, sizeof(_local_l2addr));
+    _netif.l2addr_len = sizeof(_local_l2addr);
+    rmutex_init(&_netif.mutex);
+    netif_register(&_netif.netif);
+}
+
+static void _init_addr(ipv6_addr_t *addr, const char *str, const uint8_t *l2addr)
+{
+    expect(ipv6_addr_from_str(addr, str) != NULL);
+    if (addr->u64[1].u64 == 0) {
+        expect(l2util_ipv6_iid_from_addr(NETDEV_TYPE_IEEE802154, l2addr,
+                                         IEEE802154_LONG_ADDRESS_LEN,
+                                         (eui64_t *)&addr->u64[1]) ==
+               sizeof(eui64_t));
+    }
+}
+
+static void _init_flows(void)
+{
+    for (unsigned i = 0; i < ARRAY_SIZE(_ctxs); i++) {
+        ipv6_addr_t prefix;
+
+        expect(ipv6_addr_from_str(&prefix, _ctxs[i].prefix) != NULL);
+        expect(gnrc_sixlowpan_ctx_update(i, &prefix, _ctxs[i].prefix_len,
+                                         UINT16_MAX, true) != NULL);
+    }
+    for (unsigned i = 0; i < NUMOF_FLOWS; i++) {
+        const flow_conf_t *conf = &_flow_confs[i];
+        ipv6_hdr_t *hdr = &_flows[i].hdr;
+
+        memcpy(_flows[i].dst_l2addr, _local_l2addr, sizeof(_local_l2addr));
+        _flows[i].dst_l2addr[sizeof(_local_l2addr) - 1] = conf->dst_l2addr_last;
+        ipv6_hdr_set_version(hdr);
+        ipv6_hdr_set_fl(hdr, conf->fl);
+        hdr->len = byteorder_htons(PAYLOAD_SIZE);
+        hdr->nh = PROTNUM_IPV6_NONXT;
+        hdr->hl = conf->hl;
+        _init_addr(&hdr->src, conf->src, _local_l2addr);
+        _init_addr(&hdr->dst, conf->dst, _flows[i].dst_l2addr);
+    }
+    for (unsigned i = 0; i < PAYLOAD_SIZE; i++) {
+        _payload[i] = i;
+    }
+}
+
+static gnrc_pktsnip_t *_netif_hdr_build(unsigned flow)
+{
+    gnrc_pktsnip_t *netif_hdr;
+
+    netif_hdr = gnrc_netif_hdr_build(_local_l2addr, sizeof(_local_l2addr),
+                                     _flows[flow].dst_l2addr,
+                                     sizeof(_flows[flow].dst_l2addr));
+    expect(netif_hdr != NULL);
+    gnrc_netif_hdr_set_netif(netif_hdr->data, &_netif);
+    return netif_hdr;
+}
+
+static bool _frame_equal(const gnrc_pktsnip_t *frame, unsigned flow)
+{
+    size_t len = 0;
+
+    for (; frame != NULL; frame = frame->next) {
+        if (((len + frame->size) > _flows[flow].frame_len) ||
+            (memcmp(&_flows[flow].frame[len], frame->data, frame->size) != 0)) {
+            return false;
+        }
+        len += frame->size;
+    }
+    return len == _flows[flow].frame_len;
+}
+
+/* compresses the next packet of @p flow, returns the frame handed to the
+ * interface */
+static gnrc_pktsnip_t *_send(unsigned flow)
+{
+    gnrc_pktsnip_t *pkt;
+    msg_t msg;
+
+    pkt = gnrc_pktbuf_add(NULL, _payload, PAYLOAD_SIZE, GNRC_NETTYPE_UNDEF);
+    expect(pkt != NULL);
+    pkt = gnrc_pktbuf_add(pkt, &_flows[flow].hdr, sizeof(ipv6_hdr_t),
+                          GNRC_NETTYPE_IPV6);
+    expect(pkt != NULL);
+    pkt = gnrc_pkt_prepend(pkt, _netif_hdr_build(flow));
+    gnrc_sixlowpan_iphc_send(pkt, NULL, 0);
+
+    if ((msg_try_receive(&msg) == 1) &&
+        (msg.type == GNRC_NETAPI_MSG_TYPE_SND)) {
+        return msg.content.ptr;
+    }
+    return NULL;
+}
+
+static void _compress(void)
+{
+    unsigned flow = _idx++ % NUMOF_FLOWS;
+    gnrc_pktsnip_t *pkt = _send(flow);
+
+    if ((pkt != NULL) && _frame_equal(pkt->next, flow)) {
+        _ok++;
+    }
+    else {
+        _failed++;
+    }
+    gnrc_pktbuf_release(pkt);
+}
+
+static void _decompress(void)
+{
+    unsigned flow = _idx++ % NUMOF_FLOWS;
+    gnrc_pktsnip_t *pkt;
+
+    pkt = gnrc_pktbuf_add(NULL, _flows[flow].frame, _flows[flow].frame_len,
+                          GNRC_NETTYPE_SIXLOWPAN);
+    expect(pkt != NULL);
+    pkt = gnrc_pkt_append(pkt, _netif_hdr_build(flow));
+    _flow = flow;
+    gnrc_sixlowpan_iphc_recv(pkt, NULL, 0);
+}
+
+/* compresses every flow once for the reference frames the benchmark compares
+ * its results to */
+static void _init_frames(void)
+{
+    for (unsigned i = 0; i < NUMOF_FLOWS; i++) {
+        gnrc_pktsnip_t *pkt = _send(i);
+
+        expect(pkt != NULL);
+        for (gnrc_pktsnip_t *snip = pkt->next; snip != NULL; snip = snip->next) {
+            expect((_flows[i].frame_len + snip->size) <=
+                   sizeof(_flows[i].frame));
+            memcpy(&_flows[i].frame[_flows[i].frame_len], snip->data,
+                   snip->size);
+            _flows[i].frame_len += snip->size;
+        }
+        printf("flow %u: %u byte header\n", i,
+               (unsigned)(_flows[i].frame_len - PAYLOAD_SIZE));
+        gnrc_pktbuf_release(pkt);
+    }
+}
+
+int main(void)
+{
+    msg_init_queue(_main_msg_queue, MAIN_QUEUE_SIZE);
+    gnrc_pktbuf_init();
+    _init_netif();
+    _init_flows();
+    gnrc_netreg_register(GNRC_NETTYPE_IPV6, &_recv_reg);
+
+    puts("6LoWPAN header compression benchmark");
+    printf("cache size: %u\n", (unsigned)CONFIG_GNRC_SIXLOWPAN_IPHC_CACHE_SIZE);
+    _init_frames();
+
+    BENCHMARK_FUNC("compress", BENCH_RUNS, _compress());
+    if ((_ok != BENCH_RUNS) || !gnrc_pktbuf_is_empty()) {
+        printf("compressed: FAIL (%u OK, %u failed)\n", _ok, _failed);
+        return 1;
+    }
+    printf("compressed: %u packets OK\n", _ok);
+
+    _idx = 0;
+    _ok = 0;
+    BENCHMARK_FUNC("decompress", BENCH_RUNS, _decompress());
+    if ((_ok != BENCH_RUNS) || !gnrc_pktbuf_is_empty()) {
+        printf("decompressed: FAIL (%u OK, %u failed)\n", _ok, _failed);
+        return 1;
+    }
+    printf("decompressed: %u packets OK\n", _ok);
+
+    puts("\n[SUCCESS]");
+    return 0;
+}
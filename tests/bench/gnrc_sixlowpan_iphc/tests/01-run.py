@@ -0,0 +1,29 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 Freie Universität Berlin
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+BENCHMARK_REGEXP = r"\s+{func}:\s+\d+us\s+---\s+\d*\.*\d+us per call\s+---\s+\d+ calls per sec"
+
+
+def testfunc(child):
+    child.expect_exact("6LoWPAN header compression benchmark")
+    child.expect(r"cache size: \d+\r\n")
+    for flow in range(4):
+        child.expect(r"flow {}: \d+ byte header\r\n".format(flow))
+    child.expect(BENCHMARK_REGEXP.format(func="compress"), timeout=60)
+    child.expect(r"compressed: \d+ packets OK\r\n")
+    child.expect(BENCHMARK_REGEXP.format(func="decompress"), timeout=60)
+    child.expect(r"decompressed: \d+ packets OK\r\n")
+    child.expect_exact("[SUCCESS]")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
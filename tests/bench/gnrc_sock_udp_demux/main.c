@@ -0,0 +1,115 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       UDP port demultiplexing and port allocation cost vs. the
+ *              number of socks
+ *
+ * @}
+ */
+
+#include <stdbool.h>
+#include <stdio.h>
+
+#include "benchmark.h"
+#include "net/gnrc/netreg.h"
+#include "net/sock/udp.h"
+
+#include "gnrc_sock_internal.h"
+
+#ifndef BENCH_RUNS
+#define BENCH_RUNS          (10UL * 1000UL)
+#endif
+
+#ifndef BENCH_SOCKS
+#define BENCH_SOCKS         (64U)
+#endif
+
+static const sock_udp_ep_t _local = SOCK_IPV6_EP_ANY;
+static sock_udp_t _socks[NUMOF_SOCKS];
+static sock_udp_t _bench_socks[BENCH_SOCKS];
+static unsigned _socks_numof;
+static unsigned _idx;
+
+/* walks the registry like gnrc_netapi_dispatch_receive() does: count the
+ * receivers first, then hand the packet to each one */
+static void _lookup(void)
+{
+    uint16_t port = _socks[_idx++ % _socks_numof].local.port;
+    gnrc_netreg_entry_t *entry = NULL;
+    unsigned numof = 0;
+
+    for (entry = gnrc_netreg_lookup(GNRC_NETTYPE_UDP, port); entry != NULL;
+         entry = gnrc_netreg_getnext(entry)) {
+        numof++;
+    }
+    for (entry = gnrc_netreg_lookup(GNRC_NETTYPE_UDP, port); numof > 0;
+         entry = gnrc_netreg_getnext(entry)) {
+        numof--;
+    }
+}
+
+static void _create(void)
+{
+    sock_udp_create(&_bench_socks[_idx++ % BENCH_SOCKS], &_local, NULL, 0);
+}
+
+static bool _check(void)
+{
+    bool res = true;
+
+    gnrc_netreg_acquire_shared();
+    for (unsigned i = 0; i < _socks_numof; i++) {
+        uint16_t port = _socks[i].local.port;
+
+        if ((gnrc_netreg_lookup(GNRC_NETTYPE_UDP, port) != &_socks[i].reg.entry) ||
+            (gnrc_netreg_num(GNRC_NETTYPE_UDP, port) != 1)) {
+            res = false;
+            break;
+        }
+    }
+    gnrc_netreg_release_shared();
+    return res;
+}
+
+int main(void)
+{
+    puts("UDP port demultiplexing benchmark");
+    printf("buckets: %u, port bitmap: %u\n",
+           (unsigned)CONFIG_GNRC_NETREG_UDP_BUCKETS,
+           (unsigned)CONFIG_GNRC_SOCK_UDP_PORT_BITMAP);
+
+    for (unsigned size = 8; size <= NUMOF_SOCKS; size *= 2) {
+        for (; _socks_numof < size; _socks_numof++) {
+            if (sock_udp_create(&_socks[_socks_numof], &_local, NULL, 0) < 0) {
+                printf("Unable to create sock %u\n", _socks_numof);
+                return 1;
+            }
+        }
+        if (!_check()) {
+            printf("%u socks: FAIL\n", _socks_numof);
+            return 1;
+        }
+        printf("%u socks: OK\n", _socks_numof);
+        gnrc_netreg_acquire_shared();
+        BENCHMARK_FUNC("netreg lookup", BENCH_RUNS, _lookup());
+        gnrc_netreg_release_shared();
+        _idx = 0;
+        BENCHMARK_FUNC("sock_udp_create()", BENCH_SOCKS, _create());
+        for (unsigned i = 0; i < BENCH_SOCKS; i++) {
+            sock_udp_close(&_bench_socks[i]);
+        }
+    }
+
+    puts("\n[SUCCESS]");
+    return 0;
+}
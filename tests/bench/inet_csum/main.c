@@ -0,0 +1,90 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Throughput of the Internet checksum calculation
+ *
+ * @}
+ */
+
+#include <stdbool.h>
+#include <stdio.h>
+
+#include "benchmark.h"
+#include "kernel_defines.h"
+#include "net/inet_csum.h"
+#include "random.h"
+
+#ifndef BENCH_RUNS
+#define BENCH_RUNS          (10UL * 1000UL)
+#endif
+
+#define MAX_LEN             (1280U)
+
+static const uint16_t _lens[] = { 20, 64, 256, MAX_LEN };
+
+/* one extra word to start at an odd address */
+static uint32_t _buf[(MAX_LEN / sizeof(uint32_t)) + 1];
+static volatile uint16_t _sum;
+
+static uint16_t _ref_csum_slice(uint16_t sum, const uint8_t *buf, uint16_t len,
+                                size_t accum_len)
+{
+    uint32_t csum = sum;
+
+    for (unsigned i = 0; i < len; i++, accum_len++) {
+        csum += (accum_len & 1) ? buf[i] : (uint16_t)(buf[i] << 8);
+    }
+    while (csum >> 16) {
+        csum = (csum & 0xffff) + (csum >> 16);
+    }
+    return csum;
+}
+
+static bool _check(const uint8_t *buf, uint16_t len)
+{
+    for (size_t accum_len = 0; accum_len < 2; accum_len++) {
+        if (inet_csum_slice(0, buf, len, accum_len) !=
+            _ref_csum_slice(0, buf, len, accum_len)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+int main(void)
+{
+    const uint8_t *aligned = (uint8_t *)_buf;
+    const uint8_t *unaligned = aligned + 1;
+
+    puts("Internet checksum benchmark");
+    printf("implementation: %s\n",
+           IS_USED(MODULE_INET_CSUM_FAST) ? "fast" : "byte-wise");
+    random_bytes((uint8_t *)_buf, sizeof(_buf));
+
+    for (unsigned i = 0; i < ARRAY_SIZE(_lens); i++) {
+        uint16_t len = _lens[i];
+
+        if (!_check(aligned, len) || !_check(unaligned, len)) {
+            printf("%u byte: FAIL\n", len);
+            return 1;
+        }
+        printf("%u byte: OK\n", len);
+        BENCHMARK_FUNC("aligned", BENCH_RUNS,
+                       _sum = inet_csum(0, aligned, len));
+        BENCHMARK_FUNC("unaligned", BENCH_RUNS,
+                       _sum = inet_csum(0, unaligned, len));
+    }
+
+    puts("\n[SUCCESS]");
+    return 0;
+}
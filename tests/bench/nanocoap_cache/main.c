@@ -0,0 +1,98 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Lookup benchmark for the nanocoap response cache
+ *
+ * @}
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "benchmark.h"
+#include "hashes/sha256.h"
+#include "net/nanocoap/cache.h"
+#include "random.h"
+
+#ifndef BENCH_RUNS
+#define BENCH_RUNS          (100UL * 1000UL)
+#endif
+
+#ifndef BENCH_SEED
+#define BENCH_SEED          (0x5eed)
+#endif
+
+static uint8_t _keys[2 * CONFIG_NANOCOAP_CACHE_ENTRIES][SHA256_DIGEST_LENGTH];
+static unsigned _hits;
+
+/* cache keys are (truncated) SHA-256 digests of the request */
+static void _init_keys(void)
+{
+    for (unsigned i = 0; i < ARRAY_SIZE(_keys); i++) {
+        sha256(&i, sizeof(i), _keys[i]);
+    }
+}
+
+static int _fill(void)
+{
+    uint8_t buf[32];
+    coap_pkt_t resp;
+    size_t len;
+
+    len = coap_build_hdr((coap_hdr_t *)buf, COAP_TYPE_NON, NULL, 0,
+                         COAP_CODE_205, 0);
+    coap_pkt_init(&resp, buf, sizeof(buf), len);
+    len = coap_opt_finish(&resp, COAP_OPT_FINISH_NONE);
+    /* the first half of the keys is cached */
+    for (unsigned i = 0; i < CONFIG_NANOCOAP_CACHE_ENTRIES; i++) {
+        if (nanocoap_cache_add_by_key(_keys[i], COAP_METHOD_GET, &resp,
+                                      len) == NULL) {
+            return -1;
+        }
+    }
+    return 0;
+}
+
+static void _lookup(unsigned first)
+{
+    unsigned idx = first + random_uint32_range(0, CONFIG_NANOCOAP_CACHE_ENTRIES);
+
+    if (nanocoap_cache_key_lookup(_keys[idx]) != NULL) {
+        _hits++;
+    }
+}
+
+int main(void)
+{
+    unsigned hits;
+
+    puts("nanocoap cache lookup benchmark");
+    printf("cache entries: %u\n", CONFIG_NANOCOAP_CACHE_ENTRIES);
+
+    random_init(BENCH_SEED);
+    _init_keys();
+    nanocoap_cache_init();
+    if (_fill() != 0) {
+        puts("\n[FAILED]");
+        return 1;
+    }
+    BENCHMARK_FUNC("hit", BENCH_RUNS, _lookup(0));
+    hits = _hits;
+    BENCHMARK_FUNC("miss", BENCH_RUNS, _lookup(CONFIG_NANOCOAP_CACHE_ENTRIES));
+    if ((hits != BENCH_RUNS) || (_hits != hits)) {
+        puts("\n[FAILED]");
+        return 1;
+    }
+    puts("\n[SUCCESS]");
+    return 0;
+}
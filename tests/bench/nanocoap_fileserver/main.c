@@ -0,0 +1,153 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Block-wise download benchmark for the nanocoap fileserver
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "container.h"
+#include "fs/constfs.h"
+#include "macros/math.h"
+#include "net/nanocoap.h"
+#include "net/nanocoap/fileserver.h"
+#include "vfs.h"
+#include "ztimer.h"
+#include "ztimer/stopwatch.h"
+
+#ifndef BENCH_FILE_SIZE
+#define BENCH_FILE_SIZE     (2UL * 1024UL * 1024UL)
+#endif
+
+static uint8_t _data[BENCH_FILE_SIZE];
+
+static const constfs_file_t _files[] = {
+    {
+        .path = "/data.bin",
+        .data = _data,
+        .size = sizeof(_data),
+    },
+};
+
+static constfs_t _fs = {
+    .files = _files,
+    .nfiles = ARRAY_SIZE(_files),
+};
+
+static vfs_mount_t _mount = {
+    .mount_point = "/const",
+    .fs = &constfs_file_system,
+    .private_data = &_fs,
+};
+
+static const coap_resource_t _resource = {
+    .path = "/files",
+    .methods = COAP_GET | COAP_MATCH_SUBTREE,
+    .handler = nanocoap_fileserver_handler,
+    .context = "/const",
+};
+
+/* like the nanocoap server, the response replaces the request in the buffer */
+static uint8_t _buf[1280];
+
+/* request block @p blknum and check the response, returns the more flag or
+ * -1 on error */
+static int _get_block(unsigned szx, uint32_t blknum)
+{
+    static uint16_t msg_id;
+    sock_udp_ep_t remote = { .family = AF_INET6, .port = 5683 };
+    coap_request_ctx_t ctx = {
+        .resource = &_resource,
+        .remote = &remote,
+    };
+    coap_pkt_t pkt;
+    coap_block1_t block2 = { .blknum = blknum, .szx = szx };
+
+    ssize_t len = coap_build_hdr((coap_hdr_t *)_buf, COAP_TYPE_CON, NULL, 0,
+                                 COAP_METHOD_GET, msg_id++);
+    coap_pkt_init(&pkt, _buf, sizeof(_buf), len);
+    coap_opt_add_uri_path(&pkt, "/files/data.bin");
+    coap_opt_add_block2_control(&pkt, &block2);
+    len = coap_opt_finish(&pkt, COAP_OPT_FINISH_NONE);
+    if ((len < 0) || (coap_parse(&pkt, _buf, len) < 0)) {
+        return -1;
+    }
+
+    len = nanocoap_fileserver_handler(&pkt, _buf, sizeof(_buf), &ctx);
+    if ((len <= 0) || (coap_parse(&pkt, _buf, len) < 0) ||
+        (coap_get_code_raw(&pkt) != COAP_CODE_CONTENT) ||
+        !coap_get_block2(&pkt, &block2) || (block2.szx != szx)) {
+        return -1;
+    }
+    if (memcmp(pkt.payload, &_data[block2.offset], pkt.payload_len)) {
+        return -1;
+    }
+    return block2.more;
+}
+
+static int _bench_download(unsigned szx)
+{
+    ztimer_stopwatch_t timer = { .clock = ZTIMER_USEC };
+    uint32_t blknum = 0;
+    int more;
+
+    ztimer_stopwatch_start(&timer);
+    do {
+        more = _get_block(szx, blknum++);
+    } while (more > 0);
+    uint32_t time = ztimer_stopwatch_measure(&timer);
+    ztimer_stopwatch_stop(&timer);
+
+    if ((more < 0) ||
+        (blknum != DIV_ROUND_UP(sizeof(_data), (size_t)coap_szx2size(szx)))) {
+        return -1;
+    }
+
+    /* bytes per millisecond is kB/s */
+    uint32_t kb_per_sec = (uint32_t)((uint64_t)sizeof(_data) * 1000 / time);
+
+    printf("block size %4u: %9" PRIu32 "us  ---  %5" PRIu32 ".%03" PRIu32
+           " MB/s  ---  %5" PRIu32 "ns per block\n",
+           (unsigned)coap_szx2size(szx), time, kb_per_sec / 1000,
+           kb_per_sec % 1000, (uint32_t)((uint64_t)time * 1000 / blknum));
+    return 0;
+}
+
+int main(void)
+{
+    puts("nanocoap fileserver download benchmark");
+    printf("file size: %lu byte\n", (unsigned long)sizeof(_data));
+
+    for (unsigned i = 0; i < sizeof(_data); i++) {
+        _data[i] = i * 7;
+    }
+    if (vfs_mount(&_mount) != 0) {
+        puts("\n[FAILED]");
+        return 1;
+    }
+
+    /* 64, 256 and 1024 byte blocks */
+    for (unsigned szx = COAP_BLOCKSIZE_64; szx <= COAP_BLOCKSIZE_1024; szx += 2) {
+        if (_bench_download(szx) != 0) {
+            puts("\n[FAILED]");
+            return 1;
+        }
+    }
+
+    puts("\n[SUCCESS]");
+    return 0;
+}
@@ -0,0 +1,26 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 Freie Universität Berlin
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+BENCHMARK_REGEXP = r"block size\s+{size}:\s+\d+us\s+---\s+\d+\.\d+ MB/s" \
+                   r"\s+---\s+\d+ns per block"
+
+
+def testfunc(child):
+    child.expect_exact("nanocoap fileserver download benchmark")
+    child.expect(r"file size: \d+ byte")
+    for size in (64, 256, 1024):
+        child.expect(BENCHMARK_REGEXP.format(size=size))
+    child.expect_exact("[SUCCESS]")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
@@ -0,0 +1,113 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Throughput benchmark for SHA-256 and PBKDF2-SHA256
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "container.h"
+#include "hashes/pbkdf2.h"
+#include "hashes/sha256.h"
+#include "periph_conf.h"
+#include "time_units.h"
+#include "ztimer.h"
+#include "ztimer/stopwatch.h"
+
+#ifndef BENCH_BYTES
+#define BENCH_BYTES         (1024UL * 1024UL)
+#endif
+
+#ifndef BENCH_MAX_LEN
+#define BENCH_MAX_LEN       (4096U)
+#endif
+
+#ifndef BENCH_PBKDF2_ITERATIONS
+#define BENCH_PBKDF2_ITERATIONS (4096)
+#endif
+
+static uint8_t _data[BENCH_MAX_LEN];
+static uint8_t _digest[SHA256_DIGEST_LENGTH];
+
+/* SHA-256("") */
+static const uint8_t _empty[SHA256_DIGEST_LENGTH] = {
+    0xe3, 0xb0, 0xc4, 0x42, 0x98, 0xfc, 0x1c, 0x14,
+    0x9a, 0xfb, 0xf4, 0xc8, 0x99, 0x6f, 0xb9, 0x24,
+    0x27, 0xae, 0x41, 0xe4, 0x64, 0x9b, 0x93, 0x4c,
+    0xa4, 0x95, 0x99, 0x1b, 0x78, 0x52, 0xb8, 0x55,
+};
+
+static void _bench_sha256(size_t len)
+{
+    unsigned long runs = BENCH_BYTES / len;
+    ztimer_stopwatch_t timer = { .clock = ZTIMER_USEC };
+
+    ztimer_stopwatch_start(&timer);
+    for (unsigned long i = 0; i < runs; i++) {
+        sha256(_data, len, _digest);
+    }
+    uint32_t time = ztimer_stopwatch_measure(&timer);
+    ztimer_stopwatch_stop(&timer);
+
+    /* bytes per millisecond is kB/s */
+    uint32_t kb_per_sec = (uint32_t)((uint64_t)len * runs * 1000 / time);
+
+    printf("sha256 %4u byte: %9" PRIu32 "us  ---  %4" PRIu32 ".%03" PRIu32
+           " MB/s", (unsigned)len, time, kb_per_sec / 1000, kb_per_sec % 1000);
+#ifdef CLOCK_CORECLOCK
+    uint32_t cycles = (uint64_t)time * (CLOCK_CORECLOCK / US_PER_SEC) /
+                      ((uint64_t)len * runs);
+    printf("  ---  %4" PRIu32 " cycles/byte", cycles);
+#endif
+    puts("");
+}
+
+static void _bench_pbkdf2(void)
+{
+    ztimer_stopwatch_t timer = { .clock = ZTIMER_USEC };
+
+    ztimer_stopwatch_start(&timer);
+    pbkdf2_sha256("password", 8, "salt", 4, BENCH_PBKDF2_ITERATIONS, _digest);
+    uint32_t time = ztimer_stopwatch_measure(&timer);
+    ztimer_stopwatch_stop(&timer);
+
+    printf("pbkdf2 %u iterations: %9" PRIu32 "us\n",
+           BENCH_PBKDF2_ITERATIONS, time);
+}
+
+int main(void)
+{
+    static const size_t lens[] = { 64, 256, 1024, BENCH_MAX_LEN };
+
+    puts("SHA-256 throughput benchmark");
+
+    sha256(NULL, 0, _digest);
+    if (memcmp(_digest, _empty, sizeof(_digest))) {
+        puts("\n[FAILED]");
+        return 1;
+    }
+    for (unsigned i = 0; i < sizeof(_data); i++) {
+        _data[i] = i;
+    }
+    for (unsigned i = 0; i < ARRAY_SIZE(lens); i++) {
+        _bench_sha256(lens[i]);
+    }
+    _bench_pbkdf2();
+
+    puts("\n[SUCCESS]");
+    return 0;
+}
@@ -101,6 +101,10 @@ int main(void)
     P(msg_queue);
     P(msg_array);
 #endif
+#ifdef MODULE_CORE_MUTEX_PRIORITY_INHERITANCE
+    P(mutex_waiting);
+    P(base_priority);
+#endif
 #if defined(DEVELHELP) || IS_ACTIVE(SCHED_TEST_STACK) || defined(MODULE_MPU_STACK_GUARD)
     P(stack_start);
 #endif
@@ -0,0 +1,112 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Path resolution benchmark for the VFS
+ *
+ * @}
+ */
+
+#include <fcntl.h>
+#include <stdio.h>
+#include <sys/stat.h>
+
+#include "benchmark.h"
+#include "container.h"
+#include "fs/constfs.h"
+#include "vfs.h"
+
+#ifndef BENCH_RUNS
+#define BENCH_RUNS          (100UL * 1000UL)
+#endif
+
+#ifndef BENCH_MOUNTS
+#define BENCH_MOUNTS        (8)
+#endif
+
+static const uint8_t _data[] = "benchmark";
+
+static const constfs_file_t _files[] = {
+    {
+        .path = "/file",
+        .data = _data,
+        .size = sizeof(_data),
+    },
+};
+
+static const constfs_t _fs = {
+    .files = _files,
+    .nfiles = ARRAY_SIZE(_files),
+};
+
+static char _mount_points[BENCH_MOUNTS][16];
+static vfs_mount_t _mounts[BENCH_MOUNTS];
+static unsigned _errors;
+
+static void _stat(const char *path)
+{
+    struct stat buf;
+
+    if (vfs_stat(path, &buf) != 0) {
+        _errors++;
+    }
+}
+
+static void _open_close(const char *path)
+{
+    int fd = vfs_open(path, O_RDONLY, 0);
+
+    if ((fd < 0) || (vfs_close(fd) != 0)) {
+        _errors++;
+    }
+}
+
+int main(void)
+{
+    puts("VFS path resolution benchmark");
+    printf("mounts: %u\n", BENCH_MOUNTS);
+
+    /* "/", "/mnt1", "/mnt2", ... */
+    for (unsigned i = 0; i < BENCH_MOUNTS; i++) {
+        if (i == 0) {
+            snprintf(_mount_points[i], sizeof(_mount_points[i]), "/");
+        }
+        else {
+            snprintf(_mount_points[i], sizeof(_mount_points[i]), "/mnt%u", i);
+        }
+        _mounts[i] = (vfs_mount_t) {
+            .mount_point = _mount_points[i],
+            .fs = &constfs_file_system,
+            .private_data = (void *)&_fs,
+        };
+        if (vfs_mount(&_mounts[i]) != 0) {
+            puts("\n[FAILED]");
+            return 1;
+        }
+    }
+
+    /* the file of the first and of the last mounted file system */
+    char last[32];
+    snprintf(last, sizeof(last), "%s/file", _mount_points[BENCH_MOUNTS - 1]);
+
+    BENCHMARK_FUNC("stat first", BENCH_RUNS, _stat("/file"));
+    BENCHMARK_FUNC("stat last", BENCH_RUNS, _stat(last));
+    BENCHMARK_FUNC("open/close first", BENCH_RUNS, _open_close("/file"));
+    BENCHMARK_FUNC("open/close last", BENCH_RUNS, _open_close(last));
+
+    if (_errors) {
+        puts("\n[FAILED]");
+        return 1;
+    }
+    puts("\n[SUCCESS]");
+    return 0;
+}
@@ -0,0 +1,26 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 Freie Universität Berlin
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+BENCHMARK_REGEXP = r"{name}:\s+\d+us\s+---\s+\d+\.\d+us per call"
+
+
+def testfunc(child):
+    child.expect_exact("VFS path resolution benchmark")
+    child.expect(r"mounts: \d+")
+    for name in ("stat first", "stat last",
+                 "open/close first", "open/close last"):
+        child.expect(BENCHMARK_REGEXP.format(name=name))
+    child.expect_exact("[SUCCESS]")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
@@ -273,6 +273,37 @@ int main(void)
     _print_result("remove() many decreasing", NUMOF_TIMERS, diff);
     expect(!_triggers);
 
+    /*
+     * test setting / removing one timer REPEAT times with an increasing
+     * number of armed timers
+     *
+     */
+    for (unsigned armed = 1; armed <= NUMOF_TIMERS; armed *= 10) {
+        char desc[32];
+
+        before = ztimer_now(ZTIMER_USEC);
+        _base = BASE  - (before - start);
+        for (n = 1; n < armed; n++) {
+            _timer_set(n);
+        }
+
+        before = ztimer_now(ZTIMER_USEC);
+        for (n = 0; n < REPEAT; n++) {
+            ztimer_set(ZTIMER, &_timers[0], _timer_val(armed / 2));
+            _timer_remove(0);
+        }
+
+        diff = ztimer_now(ZTIMER_USEC) - before;
+
+        snprintf(desc, sizeof(desc), "set() + remove() %u armed", armed);
+        _print_result(desc, REPEAT, diff);
+        expect(!_triggers);
+
+        for (n = 1; n < armed; n++) {
+            _timer_remove(n);
+        }
+    }
+
     /*
      * test ztimer_now()
      *
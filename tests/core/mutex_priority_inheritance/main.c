@@ -0,0 +1,226 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup tests
+ * @{
+ *
+ * @file
+ * @brief       Test application for mutex priority inheritance
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <stdbool.h>
+#include <stdio.h>
+
+#include "mutex.h"
+#include "test_utils/expect.h"
+#include "thread.h"
+#include "ztimer.h"
+
+#ifndef CRITICAL_SECTION_US
+#define CRITICAL_SECTION_US     (20000U)
+#endif
+
+#ifndef MID_BUSY_US
+#define MID_BUSY_US             (500000U)
+#endif
+
+#define LATENCY_ROUNDS          (3U)
+
+/* waiting time of the high priority thread must not depend on the mid
+ * priority thread, allow for the scheduling noise of native */
+#define LATENCY_BOUND_US        (2U * CRITICAL_SECTION_US)
+
+#define PRIO                    (THREAD_PRIORITY_MAIN)
+
+static char _stacks[3][THREAD_STACKSIZE_DEFAULT];
+
+static mutex_t _a = MUTEX_INIT;
+static mutex_t _b = MUTEX_INIT;
+static mutex_cancel_t _mc;
+static int _cancel_res;
+static uint32_t _latency;
+
+static uint8_t _prio(void)
+{
+    return thread_get_active()->priority;
+}
+
+static kernel_pid_t _create(unsigned idx, uint8_t prio, int flags,
+                            thread_task_func_t func, void *arg)
+{
+    kernel_pid_t pid = thread_create(_stacks[idx], sizeof(_stacks[idx]), prio,
+                                     THREAD_CREATE_STACKTEST | flags, func,
+                                     arg, "test");
+
+    expect(pid_is_valid(pid));
+    return pid;
+}
+
+static void _join(kernel_pid_t pid)
+{
+    while (thread_get(pid) != NULL) {
+        ztimer_sleep(ZTIMER_USEC, 1000);
+    }
+}
+
+static void *_lock_unlock(void *arg)
+{
+    mutex_lock(arg);
+    mutex_unlock(arg);
+    return NULL;
+}
+
+/* main holds two mutexes, each one blocking a higher priority thread */
+static void _test_nested(bool reverse)
+{
+    mutex_lock(&_a);
+    mutex_lock(&_b);
+    _create(0, PRIO - 1, 0, _lock_unlock, &_a);
+    expect(_prio() == PRIO - 1);
+    _create(1, PRIO - 2, 0, _lock_unlock, &_b);
+    expect(_prio() == PRIO - 2);
+    if (!reverse) {
+        mutex_unlock(&_b);
+        /* still blocking the thread waiting for _a */
+        expect(_prio() == PRIO - 1);
+        mutex_unlock(&_a);
+    }
+    else {
+        mutex_unlock(&_a);
+        /* still blocking the thread waiting for _b */
+        expect(_prio() == PRIO - 2);
+        mutex_unlock(&_b);
+    }
+    expect(_prio() == PRIO);
+    puts(reverse ? "nested, reverse order: OK" : "nested: OK");
+}
+
+static void *_chain_mid(void *arg)
+{
+    (void)arg;
+    mutex_lock(&_b);
+    mutex_lock(&_a);
+    mutex_unlock(&_a);
+    mutex_unlock(&_b);
+    expect(_prio() == PRIO - 1);
+    return NULL;
+}
+
+/* main blocks mid via _a, mid blocks high via _b */
+static void _test_chain(void)
+{
+    kernel_pid_t mid;
+
+    mutex_lock(&_a);
+    mid = _create(0, PRIO - 1, 0, _chain_mid, NULL);
+    expect(_prio() == PRIO - 1);
+    _create(1, PRIO - 2, 0, _lock_unlock, &_b);
+    expect(thread_get(mid)->priority == PRIO - 2);
+    expect(_prio() == PRIO - 2);
+    mutex_unlock(&_a);
+    expect(_prio() == PRIO);
+    puts("chain: OK");
+}
+
+static void *_lock_cancelable(void *arg)
+{
+    _mc = mutex_cancel_init(arg);
+    _cancel_res = mutex_lock_cancelable(&_mc);
+    return NULL;
+}
+
+static void _test_cancel(void)
+{
+    mutex_lock(&_a);
+    _create(0, PRIO - 1, 0, _lock_cancelable, &_a);
+    expect(_prio() == PRIO - 1);
+    mutex_cancel(&_mc);
+    expect(_cancel_res == -ECANCELED);
+    expect(_prio() == PRIO);
+    mutex_unlock(&_a);
+    puts("cancel: OK");
+}
+
+static void _busy(uint32_t us)
+{
+    uint32_t start = ztimer_now(ZTIMER_USEC);
+
+    while ((ztimer_now(ZTIMER_USEC) - start) < us) {}
+}
+
+static void *_latency_low(void *arg)
+{
+    (void)arg;
+    mutex_lock(&_a);
+    _busy(CRITICAL_SECTION_US);
+    mutex_unlock(&_a);
+    return NULL;
+}
+
+static void *_latency_mid(void *arg)
+{
+    (void)arg;
+    _busy(MID_BUSY_US);
+    return NULL;
+}
+
+static void *_latency_high(void *arg)
+{
+    (void)arg;
+    uint32_t start = ztimer_now(ZTIMER_USEC);
+
+    mutex_lock(&_a);
+    _latency = ztimer_now(ZTIMER_USEC) - start;
+    mutex_unlock(&_a);
+    return NULL;
+}
+
+/* the low priority thread holds _a when the high priority thread needs it,
+ * while the mid priority thread keeps the CPU busy */
+static uint32_t _test_latency(void)
+{
+    uint32_t worst = 0;
+
+    for (unsigned i = 0; i < LATENCY_ROUNDS; i++) {
+        kernel_pid_t low, mid, high;
+
+        low = _create(0, PRIO + 3, 0, _latency_low, NULL);
+        /* let low enter its critical section */
+        ztimer_sleep(ZTIMER_USEC, CRITICAL_SECTION_US / 4);
+        high = _create(1, PRIO + 1, THREAD_CREATE_WOUT_YIELD, _latency_high,
+                       NULL);
+        mid = _create(2, PRIO + 2, THREAD_CREATE_WOUT_YIELD, _latency_mid,
+                      NULL);
+        _join(high);
+        _join(mid);
+        _join(low);
+        if (_latency > worst) {
+            worst = _latency;
+        }
+    }
+    return worst;
+}
+
+int main(void)
+{
+    uint32_t worst;
+
+    _test_nested(false);
+    _test_nested(true);
+    _test_chain();
+    _test_cancel();
+    worst = _test_latency();
+    printf("latency: worst case %" PRIu32 " us, bound %u us\n", worst,
+           LATENCY_BOUND_US);
+    puts((worst <= LATENCY_BOUND_US) ? "TEST PASSED" : "TEST FAILED");
+    return 0;
+}
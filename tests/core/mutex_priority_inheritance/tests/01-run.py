@@ -0,0 +1,25 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 Freie Universität Berlin
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    child.expect_exact("nested: OK")
+    child.expect_exact("nested, reverse order: OK")
+    child.expect_exact("chain: OK")
+    child.expect_exact("cancel: OK")
+    child.expect(r"latency: worst case (\d+) us, bound (\d+) us\r\n",
+                 timeout=30)
+    assert int(child.match.group(1)) <= int(child.match.group(2))
+    child.expect_exact("TEST PASSED")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
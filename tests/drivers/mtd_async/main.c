@@ -0,0 +1,208 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       mtd_async module test
+ *
+ * @}
+ */
+
+#include <stdint.h>
+#include <errno.h>
+#include <string.h>
+
+#include "embUnit.h"
+#include "event.h"
+#include "event/callback.h"
+#include "mtd.h"
+#include "mtd_async.h"
+#include "mtd_emulated.h"
+#include "ztimer.h"
+
+#define SECTOR_COUNT    16
+#define PAGE_PER_SECTOR 4
+#define PAGE_SIZE       64
+#define SECTOR_SIZE     (PAGE_PER_SECTOR * PAGE_SIZE)
+
+/* emulated duration of a write or an erase */
+#define LATENCY_US      2000
+
+MTD_EMULATED_DEV(0, SECTOR_COUNT, PAGE_PER_SECTOR, PAGE_SIZE);
+
+static mtd_dev_t *_dev = &mtd_emulated_dev0.base;
+
+static event_queue_t _queue;
+static mtd_async_t _worker;
+static mtd_async_req_t _reqs[3];
+
+static uint8_t _buffer[SECTOR_SIZE];
+static uint8_t _pattern[SECTOR_SIZE];
+
+static unsigned _done_numof;
+static int _res[ARRAY_SIZE(_reqs)];
+static mtd_async_req_t *_order[ARRAY_SIZE(_reqs)];
+
+static void _done(mtd_async_req_t *req, int res)
+{
+    _res[req - _reqs] = res;
+    _order[_done_numof++] = req;
+}
+
+/* handles events until the given number of requests completed */
+static void _run(unsigned numof)
+{
+    while (_done_numof < numof) {
+        event_t *event = event_wait(&_queue);
+
+        event->handler(event);
+    }
+}
+
+static void test_mtd_write_read(void)
+{
+    /* unaligned write of more than two pages */
+    const uint32_t offset = PAGE_SIZE / 2;
+    const uint32_t len = 2 * PAGE_SIZE + 3;
+
+    mtd_async_write_page_raw(&_worker, &_reqs[0], _pattern, 1, offset, len,
+                             _done, NULL);
+    mtd_async_read_page(&_worker, &_reqs[1], _buffer, 1, offset, len,
+                        _done, NULL);
+    TEST_ASSERT(mtd_async_pending(&_worker));
+    _run(2);
+    TEST_ASSERT(!mtd_async_pending(&_worker));
+
+    TEST_ASSERT_EQUAL_INT(0, _res[0]);
+    TEST_ASSERT_EQUAL_INT(0, _res[1]);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(_buffer, _pattern, len));
+
+    /* neighbouring bytes are untouched */
+    TEST_ASSERT_EQUAL_INT(0, mtd_read_page(_dev, _buffer, 1, offset - 1, 1));
+    TEST_ASSERT_EQUAL_INT(0xFF, _buffer[0]);
+    TEST_ASSERT_EQUAL_INT(0, mtd_read_page(_dev, _buffer, 1, offset + len, 1));
+    TEST_ASSERT_EQUAL_INT(0xFF, _buffer[0]);
+}
+
+static unsigned _other_pending;
+
+static void _other(void *arg)
+{
+    (void)arg;
+    if (mtd_async_pending(&_worker)) {
+        _other_pending++;
+    }
+}
+
+static void test_mtd_erase_nonblocking(void)
+{
+    const unsigned sectors = 4;
+    event_callback_t other = EVENT_CALLBACK_INIT(_other, NULL);
+
+    memset(_pattern, 0xA5, sizeof(_pattern));
+    TEST_ASSERT_EQUAL_INT(0, mtd_write_sector(_dev, _pattern, 2, sectors));
+
+    uint32_t start = ztimer_now(ZTIMER_USEC);
+    mtd_async_erase_sector(&_worker, &_reqs[0], 2, sectors, _done, NULL);
+
+    /* other events are handled while the device is busy */
+    while (mtd_async_pending(&_worker)) {
+        event_post(&_queue, &other.super);
+        event_t *event = event_wait(&_queue);
+
+        event->handler(event);
+    }
+    uint32_t elapsed = ztimer_now(ZTIMER_USEC) - start;
+    event_cancel(&_queue, &other.super);
+
+    TEST_ASSERT_EQUAL_INT(1, _done_numof);
+    TEST_ASSERT_EQUAL_INT(0, _res[0]);
+    TEST_ASSERT(elapsed >= sectors * LATENCY_US);
+    TEST_ASSERT(_other_pending >= sectors);
+
+    for (unsigned i = 0; i < sectors; i++) {
+        TEST_ASSERT_EQUAL_INT(0, mtd_read_page(_dev, _buffer,
+                                               (2 + i) * PAGE_PER_SECTOR, 0,
+                                               SECTOR_SIZE));
+        for (unsigned j = 0; j < SECTOR_SIZE; j++) {
+            TEST_ASSERT_EQUAL_INT(0xFF, _buffer[j]);
+        }
+    }
+}
+
+static void test_mtd_order(void)
+{
+    mtd_async_erase_sector(&_worker, &_reqs[0], 0, 1, _done, NULL);
+    mtd_async_write_page_raw(&_worker, &_reqs[1], _pattern, 0, 0, SECTOR_SIZE,
+                             _done, NULL);
+    mtd_async_read_page(&_worker, &_reqs[2], _buffer, 0, 0, SECTOR_SIZE,
+                        _done, NULL);
+    _run(3);
+
+    for (unsigned i = 0; i < ARRAY_SIZE(_reqs); i++) {
+        TEST_ASSERT_EQUAL_INT(0, _res[i]);
+        TEST_ASSERT(_order[i] == &_reqs[i]);
+    }
+    TEST_ASSERT_EQUAL_INT(0, memcmp(_buffer, _pattern, SECTOR_SIZE));
+}
+
+static void test_mtd_errors(void)
+{
+    mtd_async_erase_sector(&_worker, &_reqs[0], SECTOR_COUNT - 1, 2,
+                           _done, NULL);
+    mtd_async_write_page_raw(&_worker, &_reqs[1], _pattern,
+                             SECTOR_COUNT * PAGE_PER_SECTOR - 1, 1, PAGE_SIZE,
+                             _done, NULL);
+    _run(2);
+
+    TEST_ASSERT_EQUAL_INT(-EOVERFLOW, _res[0]);
+    TEST_ASSERT_EQUAL_INT(-EOVERFLOW, _res[1]);
+}
+
+static void set_up(void)
+{
+    for (unsigned i = 0; i < sizeof(_pattern); i++) {
+        _pattern[i] = i;
+    }
+    memset(_buffer, 0, sizeof(_buffer));
+    memset(_res, 0, sizeof(_res));
+    _done_numof = 0;
+    _other_pending = 0;
+
+    mtd_emulated_dev0.init_done = false;
+    mtd_emulated_dev0.latency_us = LATENCY_US;
+    mtd_init(_dev);
+    mtd_async_init(&_worker, _dev, &_queue);
+}
+
+Test *tests_mtd_async_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_mtd_write_read),
+        new_TestFixture(test_mtd_erase_nonblocking),
+        new_TestFixture(test_mtd_order),
+        new_TestFixture(test_mtd_errors),
+    };
+
+    EMB_UNIT_TESTCALLER(mtd_async_tests, set_up, NULL, fixtures);
+
+    return (Test *)&mtd_async_tests;
+}
+
+int main(void)
+{
+    event_queue_init(&_queue);
+
+    TESTS_START();
+    TESTS_RUN(tests_mtd_async_tests());
+    TESTS_END();
+    return 0;
+}
@@ -0,0 +1,205 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       mtd_cache module test
+ *
+ * @}
+ */
+
+#include <stdint.h>
+#include <errno.h>
+#include <string.h>
+
+#include "embUnit.h"
+#include "mtd.h"
+#include "mtd_cache.h"
+#include "mtd_emulated.h"
+
+#define SECTOR_COUNT    16
+#define PAGE_PER_SECTOR 4
+#define PAGE_SIZE       64
+#define SECTOR_SIZE     (PAGE_PER_SECTOR * PAGE_SIZE)
+#define SLOTS_NUMOF     2
+
+/* size of the records appended to a log */
+#define RECORD_SIZE     16
+
+MTD_EMULATED_DEV(0, SECTOR_COUNT, PAGE_PER_SECTOR, PAGE_SIZE);
+
+static mtd_cache_slot_t _slots[SLOTS_NUMOF];
+static uint8_t _buf[SLOTS_NUMOF * SECTOR_SIZE];
+static mtd_cache_t _cache = MTD_CACHE_INIT(&mtd_emulated_dev0.base, _slots,
+                                           _buf);
+
+static mtd_dev_t *_dev = &_cache.mtd;
+static mtd_dev_t *_parent = &mtd_emulated_dev0.base;
+
+static uint8_t _buffer[SECTOR_SIZE];
+
+static void _test_mem(uint8_t *buffer, size_t len, uint8_t expected)
+{
+    for (size_t i = 0; i < len; i++) {
+        TEST_ASSERT_EQUAL_INT(expected, buffer[i]);
+    }
+}
+
+static void _read_parent(uint32_t addr, size_t len)
+{
+    TEST_ASSERT_EQUAL_INT(0, mtd_read(_parent, _buffer, addr, len));
+}
+
+static void test_mtd_init(void)
+{
+    TEST_ASSERT_EQUAL_INT(0, mtd_init(_dev));
+    TEST_ASSERT_EQUAL_INT(SECTOR_COUNT, _dev->sector_count);
+    TEST_ASSERT_EQUAL_INT(PAGE_PER_SECTOR, _dev->pages_per_sector);
+    TEST_ASSERT_EQUAL_INT(PAGE_SIZE, _dev->page_size);
+    TEST_ASSERT_EQUAL_INT(1, _dev->write_size);
+}
+
+static void test_mtd_write_back(void)
+{
+    memset(_buffer, 0xAA, 3);
+    /* unaligned write crossing a page boundary */
+    TEST_ASSERT_EQUAL_INT(0, mtd_write_page(_dev, _buffer, 0, PAGE_SIZE - 1, 3));
+
+    /* the new data is read from the cache */
+    TEST_ASSERT_EQUAL_INT(0, mtd_read(_dev, _buffer, PAGE_SIZE - 2, 5));
+    TEST_ASSERT_EQUAL_INT(0xFF, _buffer[0]);
+    _test_mem(&_buffer[1], 3, 0xAA);
+    TEST_ASSERT_EQUAL_INT(0xFF, _buffer[4]);
+
+    /* not written back yet */
+    _read_parent(PAGE_SIZE - 1, 3);
+    _test_mem(_buffer, 3, 0xFF);
+
+    TEST_ASSERT_EQUAL_INT(0, mtd_cache_flush(&_cache));
+    _read_parent(PAGE_SIZE - 1, 3);
+    _test_mem(_buffer, 3, 0xAA);
+    TEST_ASSERT_EQUAL_INT(1, _cache.stats.writebacks);
+    TEST_ASSERT_EQUAL_INT(1, _cache.stats.erases);
+
+    /* nothing left to write back */
+    TEST_ASSERT_EQUAL_INT(0, mtd_cache_flush(&_cache));
+    TEST_ASSERT_EQUAL_INT(1, _cache.stats.writebacks);
+}
+
+static void test_mtd_append(void)
+{
+    const unsigned sectors = 4;
+
+    /* appending records to a log erases each sector only once */
+    for (unsigned i = 0; i < sectors * SECTOR_SIZE / RECORD_SIZE; i++) {
+        memset(_buffer, i, RECORD_SIZE);
+        TEST_ASSERT_EQUAL_INT(0, mtd_write_page(_dev, _buffer, 0,
+                                                i * RECORD_SIZE,
+                                                RECORD_SIZE));
+    }
+    TEST_ASSERT_EQUAL_INT(0, mtd_cache_flush(&_cache));
+    TEST_ASSERT_EQUAL_INT(sectors, _cache.stats.writebacks);
+    TEST_ASSERT_EQUAL_INT(sectors, _cache.stats.erases);
+
+    for (unsigned i = 0; i < sectors * SECTOR_SIZE / RECORD_SIZE; i++) {
+        _read_parent(i * RECORD_SIZE, RECORD_SIZE);
+        _test_mem(_buffer, RECORD_SIZE, i);
+    }
+}
+
+static void test_mtd_evict(void)
+{
+    /* one more sector than there are slots */
+    for (unsigned i = 0; i <= SLOTS_NUMOF; i++) {
+        memset(_buffer, 0x10 + i, RECORD_SIZE);
+        TEST_ASSERT_EQUAL_INT(0, mtd_write(_dev, _buffer, i * SECTOR_SIZE,
+                                           RECORD_SIZE));
+    }
+
+    /* the least recently used sector was written back */
+    TEST_ASSERT_EQUAL_INT(1, _cache.stats.writebacks);
+    _read_parent(0, RECORD_SIZE);
+    _test_mem(_buffer, RECORD_SIZE, 0x10);
+    _read_parent(SLOTS_NUMOF * SECTOR_SIZE, RECORD_SIZE);
+    _test_mem(_buffer, RECORD_SIZE, 0xFF);
+
+    /* the evicted sector is read from the backing device */
+    TEST_ASSERT_EQUAL_INT(0, mtd_read(_dev, _buffer, 0, RECORD_SIZE));
+    _test_mem(_buffer, RECORD_SIZE, 0x10);
+}
+
+static void test_mtd_erase(void)
+{
+    memset(_buffer, 0x55, SECTOR_SIZE);
+    TEST_ASSERT_EQUAL_INT(0, mtd_write_sector(_dev, _buffer, 1, 1));
+    TEST_ASSERT_EQUAL_INT(0, mtd_cache_flush(&_cache));
+    TEST_ASSERT_EQUAL_INT(1, _cache.stats.erases);
+
+    /* read sector 1 into the cache and modify it */
+    TEST_ASSERT_EQUAL_INT(0, mtd_write(_dev, _buffer, SECTOR_SIZE, 1));
+
+    /* erasing drops the modification */
+    TEST_ASSERT_EQUAL_INT(0, mtd_erase_sector(_dev, 1, 1));
+    TEST_ASSERT_EQUAL_INT(2, _cache.stats.erases);
+    TEST_ASSERT_EQUAL_INT(0, mtd_read(_dev, _buffer, SECTOR_SIZE, SECTOR_SIZE));
+    _test_mem(_buffer, SECTOR_SIZE, 0xFF);
+
+    /* writing to the sector just erased does not erase it again */
+    memset(_buffer, 0x66, RECORD_SIZE);
+    TEST_ASSERT_EQUAL_INT(0, mtd_write(_dev, _buffer, SECTOR_SIZE, RECORD_SIZE));
+    TEST_ASSERT_EQUAL_INT(0, mtd_cache_flush(&_cache));
+    TEST_ASSERT_EQUAL_INT(2, _cache.stats.erases);
+    _read_parent(SECTOR_SIZE, SECTOR_SIZE);
+    _test_mem(_buffer, RECORD_SIZE, 0x66);
+    _test_mem(&_buffer[RECORD_SIZE], SECTOR_SIZE - RECORD_SIZE, 0xFF);
+
+    TEST_ASSERT_EQUAL_INT(-EOVERFLOW, mtd_erase_sector(_dev, SECTOR_COUNT, 1));
+}
+
+static void test_mtd_power_down(void)
+{
+    memset(_buffer, 0x77, RECORD_SIZE);
+    TEST_ASSERT_EQUAL_INT(0, mtd_write(_dev, _buffer, 0, RECORD_SIZE));
+    TEST_ASSERT_EQUAL_INT(0, mtd_power(_dev, MTD_POWER_DOWN));
+    _read_parent(0, RECORD_SIZE);
+    _test_mem(_buffer, RECORD_SIZE, 0x77);
+    TEST_ASSERT_EQUAL_INT(0, mtd_power(_dev, MTD_POWER_UP));
+}
+
+static void set_up(void)
+{
+    mtd_emulated_dev0.init_done = false;
+    mtd_init(_dev);
+}
+
+Test *tests_mtd_cache_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_mtd_init),
+        new_TestFixture(test_mtd_write_back),
+        new_TestFixture(test_mtd_append),
+        new_TestFixture(test_mtd_evict),
+        new_TestFixture(test_mtd_erase),
+        new_TestFixture(test_mtd_power_down),
+    };
+
+    EMB_UNIT_TESTCALLER(mtd_cache_tests, set_up, NULL, fixtures);
+
+    return (Test *)&mtd_cache_tests;
+}
+
+int main(void)
+{
+    TESTS_START();
+    TESTS_RUN(tests_mtd_cache_tests());
+    TESTS_END();
+    return 0;
+}
@@ -235,10 +235,21 @@ static void _test_entry(const gnrc_sixlowpan_frag_rb_t *entry,
                         "entry->super.dst != TEST_NETIF_HDR_DST");
     TEST_ASSERT_EQUAL_INT(TEST_TAG, entry->super.tag);
     TEST_ASSERT_EQUAL_INT(exp_current_size, entry->super.current_size);
+#if GNRC_SIXLOWPAN_FRAG_RB_BITMAP
+    TEST_ASSERT_NULL(entry->super.ints);
+    for (unsigned i = 0; i < GNRC_SIXLOWPAN_FRAG_RB_UNITS; i++) {
+        TEST_ASSERT_EQUAL_INT((i >= (exp_int_start / 8)) &&
+                              (i <= (exp_int_end / 8)),
+                              bf_isset(entry->units, i));
+        TEST_ASSERT_EQUAL_INT(i == (exp_int_start / 8),
+                              bf_isset(entry->starts, i));
+    }
+#else   /* GNRC_SIXLOWPAN_FRAG_RB_BITMAP */
     TEST_ASSERT_NOT_NULL(entry->super.ints);
     TEST_ASSERT_NULL(entry->super.ints->next);
     TEST_ASSERT_EQUAL_INT(exp_int_start, entry->super.ints->start);
     TEST_ASSERT_EQUAL_INT(exp_int_end, entry->super.ints->end);
+#endif  /* GNRC_SIXLOWPAN_FRAG_RB_BITMAP */
 }
 
 static void _check_pktbuf(const gnrc_sixlowpan_frag_rb_t *entry)
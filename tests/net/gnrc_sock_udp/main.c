@@ -24,6 +24,7 @@
 #include <stdio.h>
 
 #include "net/sock/udp.h"
+#include "random.h"
 #include "test_utils/expect.h"
 #include "xtimer.h"
 
@@ -821,6 +822,36 @@ static void test_sock_udp_send__no_sock(void)
     expect(_check_net());
 }
 
+#ifdef MODULE_GNRC_SOCK_CHECK_REUSE
+static void test_sock_udp_send__implicit_bind_dyn_port(void)
+{
+    static const ipv6_addr_t dst_addr = { .u8 = _TEST_ADDR_REMOTE };
+    static const sock_udp_ep_t local = { .family = AF_INET6,
+                                         .port = 0U };
+    static const sock_udp_ep_t remote = { .addr = { .ipv6 = _TEST_ADDR_REMOTE },
+                                          .family = AF_INET6,
+                                          .port = _TEST_PORT_REMOTE };
+    sock_udp_ep_t ep, ep2;
+
+    expect(0 == sock_udp_create(&_sock, NULL, &remote, 0));
+    /* let both socks draw the same random port first */
+    random_init(_TEST_PORT_LOCAL);
+    expect(sizeof("ABCD") == sock_udp_send(&_sock, "ABCD", sizeof("ABCD"),
+                                           NULL));
+    expect(_check_packet(&ipv6_addr_unspecified, &dst_addr, 0,
+                         _TEST_PORT_REMOTE, "ABCD", sizeof("ABCD"),
+                         SOCK_ADDR_ANY_NETIF, true));
+    xtimer_usleep(1000);    /* let GNRC stack finish */
+    expect(_check_net());
+    random_init(_TEST_PORT_LOCAL);
+    expect(0 == sock_udp_create(&_sock2, &local, NULL, 0));
+    expect(0 == sock_udp_get_local(&_sock, &ep));
+    expect(0 == sock_udp_get_local(&_sock2, &ep2));
+    expect(ep.port != ep2.port);
+    sock_udp_close(&_sock2);
+}
+#endif
+
 int main(void)
 {
     _net_init();
@@ -873,6 +904,9 @@ int main(void)
     CALL(test_sock_udp_send__unsocketed());
     CALL(test_sock_udp_send__no_sock_no_netif());
     CALL(test_sock_udp_send__no_sock());
+#ifdef MODULE_GNRC_SOCK_CHECK_REUSE
+    CALL(test_sock_udp_send__implicit_bind_dyn_port());
+#endif
 
     puts("ALL TESTS SUCCESSFUL");
 
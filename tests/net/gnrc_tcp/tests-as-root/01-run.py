@@ -12,7 +12,8 @@ import random
 import pexpect
 import base64
 
-from scapy.all import Ether, IPv6, TCP, raw, sendp
+from scapy.all import Ether, IPv6, TCP, ICMPv6ND_NS, ICMPv6NDOptSrcLLAddr, conf, raw, \
+                      sendp, sniff
 
 from helpers import Runner, RiotTcpServer, RiotTcpClient, HostTcpServer, HostTcpClient, \
                     generate_port_number, sudo_guard
@@ -22,6 +23,53 @@ from helpers import Runner, RiotTcpServer, RiotTcpClient, HostTcpServer, HostTcp
 _GNRC_TCP_NO_TIMEOUT = 1
 
 
+class _RawTcpClient:
+    """ TCP client built from raw frames. It uses an address unknown to the host
+        system, otherwise the host system would reset the connection.
+    """
+    MAC = '02:00:00:00:23:42'
+    ADDRESS = 'fe80::23:42'
+
+    def __init__(self, target, mss, window):
+        self.target = target
+        self.sock = conf.L2socket(iface=os.environ['TAPDEV'])
+        self.sport = generate_port_number()
+        self.mss = mss
+        self.window = window
+        self.seq = random.randint(0, 0xffffffff)
+        self.ack = 0
+
+    def open(self):
+        # Announce the link layer address, the target would have to resolve it
+        self.sock.send(
+            Ether(src=self.MAC, dst=self.target.mac) /
+            IPv6(src=self.ADDRESS, dst=self.target.address, hlim=255) /
+            ICMPv6ND_NS(tgt=self.target.address) / ICMPv6NDOptSrcLLAddr(lladdr=self.MAC)
+        )
+        self.send('S', options=[('MSS', self.mss)])
+        syn_ack = self.receive()
+        assert syn_ack is not None and syn_ack.flags == 'SA'
+        self.seq += 1
+        self.ack = syn_ack.seq + 1
+        self.send('A')
+
+    def close(self):
+        self.sock.close()
+
+    def send(self, flags, options=None):
+        self.sock.send(
+            Ether(src=self.MAC, dst=self.target.mac) /
+            IPv6(src=self.ADDRESS, dst=self.target.address) /
+            TCP(sport=self.sport, dport=int(self.target.listen_port), flags=flags,
+                seq=self.seq, ack=self.ack, window=self.window, options=options or [])
+        )
+
+    def receive(self, timeout=1):
+        pkts = sniff(opened_socket=self.sock, count=1, timeout=timeout,
+                     lfilter=lambda p: TCP in p and p[Ether].dst == self.MAC)
+        return pkts[0][TCP] if pkts else None
+
+
 @Runner(timeout=5)
 def test_connection_lifecycle_as_client(child):
     """ Open/close a single connection as tcp client """
@@ -303,6 +351,71 @@ def test_gnrc_tcp_send_behavior_on_zero_length_buffer_size(child):
             host_srv.close()
 
 
+@Runner(timeout=5)
+def test_gnrc_tcp_fast_retransmit_on_duplicate_ack(child):
+    """ This test verifies that with the default send queue size a lost segment
+        is retransmitted after a duplicate acknowledgment, without waiting for
+        the retransmission timer.
+    """
+    with RiotTcpServer(child, generate_port_number()) as riot_srv:
+        raw_cli = _RawTcpClient(riot_srv, mss=100, window=1000)
+
+        child.sendline('gnrc_tcp_accept 2000')
+        raw_cli.open()
+        child.expect_exact('gnrc_tcp_accept: returns 0')
+
+        # Send two segments, the default send queue holds both of them
+        riot_srv._setup_internal_buffer()
+        riot_srv._write_data_to_internal_buffer('a' * 200)
+        child.sendline('tcp_stats reset')
+        child.sendline('gnrc_tcp_send 0 200')
+        first = raw_cli.receive()
+        second = raw_cli.receive()
+        assert first is not None and first.seq == raw_cli.ack and len(first.payload) == 100
+        assert second is not None and second.seq == raw_cli.ack + 100
+
+        # Acknowledge the second segment only. The retransmission timer
+        # expires after one second at the earliest.
+        raw_cli.send('A')
+        retransmit = raw_cli.receive(timeout=0.5)
+        assert retransmit is not None and retransmit.seq == first.seq
+
+        # Acknowledge both segments
+        raw_cli.ack += 200
+        raw_cli.send('A')
+        child.expect_exact('gnrc_tcp_send: sent 200')
+        child.sendline('tcp_stats')
+        child.expect_exact('retransmissions: 0 on timeout, 1 fast')
+
+        riot_srv.abort()
+        raw_cli.close()
+
+
+@Runner(timeout=5)
+def test_gnrc_tcp_send_releases_segments_on_timeout(child):
+    """ This test verifies that gnrc_tcp_send releases the unacknowledged
+        segments if the user specified timeout expires.
+    """
+    with RiotTcpServer(child, generate_port_number()) as riot_srv:
+        raw_cli = _RawTcpClient(riot_srv, mss=100, window=1000)
+
+        child.sendline('gnrc_tcp_accept 2000')
+        raw_cli.open()
+        child.expect_exact('gnrc_tcp_accept: returns 0')
+
+        # Send two segments and never acknowledge them
+        riot_srv._setup_internal_buffer()
+        riot_srv._write_data_to_internal_buffer('a' * 200)
+        child.sendline('gnrc_tcp_send 500 200')
+        assert raw_cli.receive() is not None
+        assert raw_cli.receive() is not None
+        child.expect_exact('gnrc_tcp_send: returns -ETIMEDOUT')
+        riot_srv._verify_pktbuf_empty()
+
+        riot_srv.abort()
+        raw_cli.close()
+
+
 @Runner(timeout=1)
 def test_gnrc_tcp_ep_from_str(child):
     """ Verify Endpoint construction from string """
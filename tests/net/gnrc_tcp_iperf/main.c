@@ -0,0 +1,185 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       GNRC TCP throughput test
+ *
+ * @}
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "msg.h"
+#include "net/af.h"
+#include "net/gnrc/tcp.h"
+#include "shell.h"
+#include "ztimer.h"
+
+#define MAIN_QUEUE_SIZE (8)
+#define BUFFER_SIZE     (2048)
+
+static msg_t _main_msg_queue[MAIN_QUEUE_SIZE];
+static gnrc_tcp_tcb_t _tcb;
+static gnrc_tcp_tcb_queue_t _queue = GNRC_TCP_TCB_QUEUE_INIT;
+static uint8_t _buffer[BUFFER_SIZE];
+
+/* every byte of the stream carries the lower bits of its offset */
+static void _fill(uint8_t *buf, size_t len, uint32_t offset)
+{
+    for (size_t i = 0; i < len; i++) {
+        buf[i] = offset + i;
+    }
+}
+
+static int _check(const uint8_t *buf, size_t len, uint32_t offset)
+{
+    for (size_t i = 0; i < len; i++) {
+        if (buf[i] != (uint8_t)(offset + i)) {
+            return -1;
+        }
+    }
+    return 0;
+}
+
+static int _iperf_server_cmd(int argc, char **argv)
+{
+    if (argc < 2) {
+        printf("usage: %s <port>\n", argv[0]);
+        return 1;
+    }
+
+    gnrc_tcp_ep_t local;
+    gnrc_tcp_tcb_t *tcb;
+    int res = gnrc_tcp_ep_from_str(&local, "[::]");
+
+    local.port = atoi(argv[1]);
+    gnrc_tcp_tcb_init(&_tcb);
+    gnrc_tcp_tcb_queue_init(&_queue);
+    if (res == 0) {
+        res = gnrc_tcp_listen(&_queue, &_tcb, 1, &local);
+    }
+    if (res < 0) {
+        printf("%s: listen failed: %d\n", argv[0], res);
+        return 1;
+    }
+    puts("iperf_server: listening");
+
+    res = gnrc_tcp_accept(&_queue, &tcb, GNRC_TCP_NO_TIMEOUT);
+    if (res < 0) {
+        printf("%s: accept failed: %d\n", argv[0], res);
+        gnrc_tcp_stop_listen(&_queue);
+        return 1;
+    }
+
+    uint32_t start = ztimer_now(ZTIMER_MSEC);
+    uint32_t received = 0;
+    ssize_t len;
+
+    while ((len = gnrc_tcp_recv(tcb, _buffer, sizeof(_buffer),
+                                GNRC_TCP_NO_TIMEOUT)) > 0) {
+        if (_check(_buffer, len, received) < 0) {
+            printf("%s: corrupted data at offset %" PRIu32 "\n", argv[0],
+                   received);
+            len = -EBADMSG;
+            break;
+        }
+        received += len;
+    }
+    uint32_t ms = ztimer_now(ZTIMER_MSEC) - start;
+
+    printf("%s: received %" PRIu32 " bytes in %" PRIu32 " ms: %" PRIu32
+           " kbit/s\n", argv[0], received, ms,
+           ms ? (uint32_t)((uint64_t)received * 8 / ms) : 0);
+    gnrc_tcp_close(tcb);
+    gnrc_tcp_stop_listen(&_queue);
+
+    if (len < 0) {
+        printf("%s: receive failed: %d\n", argv[0], (int)len);
+        return 1;
+    }
+    return 0;
+}
+
+static int _iperf_client_cmd(int argc, char **argv)
+{
+    if (argc < 3) {
+        printf("usage: %s <[addr%%netif]:port> <bytes>\n", argv[0]);
+        return 1;
+    }
+
+    gnrc_tcp_ep_t remote;
+    uint32_t total = strtoul(argv[2], NULL, 10);
+    int res = gnrc_tcp_ep_from_str(&remote, argv[1]);
+
+    if (res < 0) {
+        printf("%s: invalid endpoint: %d\n", argv[0], res);
+        return 1;
+    }
+
+    gnrc_tcp_tcb_init(&_tcb);
+    res = gnrc_tcp_open(&_tcb, &remote, 0);
+    if (res < 0) {
+        printf("%s: open failed: %d\n", argv[0], res);
+        return 1;
+    }
+
+    uint32_t sent = 0;
+
+    while (sent < total) {
+        size_t len = total - sent;
+
+        if (len > sizeof(_buffer)) {
+            len = sizeof(_buffer);
+        }
+        _fill(_buffer, len, sent);
+
+        for (size_t done = 0; done < len;) {
+            ssize_t n = gnrc_tcp_send(&_tcb, _buffer + done, len - done,
+                                      GNRC_TCP_NO_TIMEOUT);
+            if (n < 0) {
+                printf("%s: send failed: %d\n", argv[0], (int)n);
+                gnrc_tcp_abort(&_tcb);
+                return 1;
+            }
+            done += n;
+        }
+        sent += len;
+    }
+
+    /* closing waits until all data was acknowledged, the throughput is
+     * measured by the receiver */
+    gnrc_tcp_close(&_tcb);
+    printf("%s: sent %" PRIu32 " bytes\n", argv[0], sent);
+    return 0;
+}
+
+static const shell_command_t _commands[] = {
+    { "iperf_server", "Receive a TCP stream and measure throughput",
+      _iperf_server_cmd },
+    { "iperf_client", "Send a TCP stream and measure throughput",
+      _iperf_client_cmd },
+    { NULL, NULL, NULL }
+};
+
+int main(void)
+{
+    /* we need a message queue for the thread running the shell in order to
+     * receive potentially fast incoming networking packets */
+    msg_init_queue(_main_msg_queue, MAIN_QUEUE_SIZE);
+    puts("RIOT GNRC TCP throughput test");
+
+    char line_buf[SHELL_DEFAULT_BUFSIZE];
+    shell_run(_commands, line_buf, SHELL_DEFAULT_BUFSIZE);
+
+    return 0;
+}
@@ -0,0 +1,55 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 Freie Universität Berlin
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import os
+import sys
+import time
+import pexpect
+from testrunner import run
+
+# Tap device of the second RIOT instance, must be bridged with TAPDEV
+CLIENT_TAP = os.environ.get("CLIENT_TAP", "tap1")
+PORT = 5001
+SIZE = int(os.environ.get("IPERF_SIZE", 1024 * 1024))
+
+
+def testfunc(child):
+    client = pexpect.spawnu(os.environ["ELFFILE"], [CLIENT_TAP], timeout=60,
+                            logfile=sys.stdout)
+    try:
+        client.expect_exact("RIOT GNRC TCP throughput test")
+        # wait until the link-local address of the client became valid
+        client.sendline("ifconfig")
+        client.expect(r"Iface\s+(\d+)")
+        iface = client.match.group(1)
+        client.expect(r"scope: link\s+(\w+)")
+        while client.match.group(1) != "VAL":
+            time.sleep(0.5)
+            client.sendline("ifconfig")
+            client.expect(r"scope: link\s+(\w+)")
+
+        child.sendline("ifconfig")
+        child.expect(r"inet6 addr: (fe80::[0-9a-f:]+)\s+scope: link")
+        addr = child.match.group(1)
+
+        child.sendline("iperf_server {}".format(PORT))
+        child.expect_exact("iperf_server: listening")
+        client.sendline("iperf_client [{}%{}]:{} {}".format(addr, iface, PORT,
+                                                           SIZE))
+        child.expect(r"iperf_server: received {} bytes in \d+ ms: \d+ kbit/s"
+                     .format(SIZE), timeout=60)
+        client.expect_exact("iperf_client: sent {} bytes".format(SIZE))
+        child.sendline("tcp_stats")
+        child.expect(r"out of order: \d+ queued, \d+ merged, \d+ dropped")
+    finally:
+        client.terminate(force=True)
+    print("[SUCCESS]")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc, timeout=10))
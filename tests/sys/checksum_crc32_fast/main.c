@@ -0,0 +1,109 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Tests for the table driven CRC-32 of crc32_fast
+ *
+ * @}
+ */
+
+#include <stdint.h>
+
+#include "embUnit.h"
+
+#include "checksum/crc32.h"
+
+static uint32_t _crc32_bitwise(const uint8_t *buf, size_t len)
+{
+    uint32_t crc = 0xffffffff;
+
+    while (len--) {
+        crc ^= *buf++;
+        for (unsigned i = 0; i < 8; i++) {
+            crc = (crc >> 1) ^ (0xedb88320 & -(crc & 1));
+        }
+    }
+    return ~crc;
+}
+
+static void test_crc32_fast_sequence_empty(void)
+{
+    TEST_ASSERT_EQUAL_INT(0x0, crc32("", 0));
+}
+
+static void test_crc32_fast_sequence_1to9(void)
+{
+    unsigned char buf[] = "123456789";
+
+    TEST_ASSERT_EQUAL_INT(0xcbf43926, crc32(buf, sizeof(buf) - 1));
+}
+
+static void test_crc32_fast_sequence_unaligned(void)
+{
+    /* starts at an odd address, length is neither a multiple of 4 nor of 8 */
+    unsigned char buf[] = "_The quick brown fox jumps over the lazy dog";
+
+    TEST_ASSERT_EQUAL_INT(0x414fa339, crc32(buf + 1, sizeof(buf) - 2));
+}
+
+static void test_crc32_fast_sequence_0to255(void)
+{
+    /* indexes every entry of the lookup tables */
+    unsigned char buf[256];
+
+    for (unsigned i = 0; i < sizeof(buf); i++) {
+        buf[i] = i;
+    }
+
+    TEST_ASSERT_EQUAL_INT(0x29058c73, crc32(buf, sizeof(buf)));
+}
+
+static void test_crc32_fast_offsets_lengths(void)
+{
+    /* every alignment and every remainder of the sliced loop */
+    uint8_t buf[64];
+
+    for (unsigned i = 0; i < sizeof(buf); i++) {
+        buf[i] = (i * 167) + 13;
+    }
+
+    for (unsigned off = 0; off < 8; off++) {
+        for (unsigned len = 0; len <= sizeof(buf) - off; len++) {
+            TEST_ASSERT_EQUAL_INT(_crc32_bitwise(buf + off, len),
+                                  crc32(buf + off, len));
+        }
+    }
+}
+
+static Test *tests_crc32_fast_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_crc32_fast_sequence_empty),
+        new_TestFixture(test_crc32_fast_sequence_1to9),
+        new_TestFixture(test_crc32_fast_sequence_unaligned),
+        new_TestFixture(test_crc32_fast_sequence_0to255),
+        new_TestFixture(test_crc32_fast_offsets_lengths),
+    };
+
+    EMB_UNIT_TESTCALLER(crc32_fast_tests, NULL, NULL, fixtures);
+
+    return (Test *)&crc32_fast_tests;
+}
+
+int main(void)
+{
+    TESTS_START();
+    TESTS_RUN(tests_crc32_fast_tests());
+    TESTS_END();
+
+    return 0;
+}
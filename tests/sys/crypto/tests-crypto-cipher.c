@@ -44,6 +44,39 @@ static void test_crypto_cipher_aes_encrypt(void)
     TEST_ASSERT_MESSAGE(1 == cmp, "wrong ciphertext");
 }
 
+static void test_crypto_cipher_aes_encrypt_blocks(void)
+{
+    cipher_t cipher;
+    int err, cmp;
+    uint8_t input[3 * 16], data[3 * 16], block[16];
+
+    for (unsigned i = 0; i < sizeof(input); i++) {
+        input[i] = i;
+    }
+    memcpy(input, TEST_INP, 16);
+
+    err = cipher_init(&cipher, CIPHER_AES, TEST_KEY, 16);
+    TEST_ASSERT_EQUAL_INT(1, err);
+
+    err = cipher_encrypt_blocks(&cipher, input, data, 3);
+    TEST_ASSERT_EQUAL_INT(1, err);
+
+    cmp = compare(TEST_ENC_AES, data, 16);
+    TEST_ASSERT_MESSAGE(1 == cmp, "wrong ciphertext");
+    for (unsigned i = 0; i < 3; i++) {
+        err = cipher_encrypt(&cipher, &input[i * 16], block);
+        TEST_ASSERT_EQUAL_INT(1, err);
+        cmp = compare(block, &data[i * 16], 16);
+        TEST_ASSERT_MESSAGE(1 == cmp, "wrong ciphertext");
+    }
+
+    /* in place */
+    err = cipher_encrypt_blocks(&cipher, input, input, 3);
+    TEST_ASSERT_EQUAL_INT(1, err);
+    cmp = compare(input, data, sizeof(data));
+    TEST_ASSERT_MESSAGE(1 == cmp, "wrong ciphertext");
+}
+
 static void test_crypto_cipher_aes_decrypt(void)
 {
     cipher_t cipher;
@@ -79,6 +112,7 @@ Test *tests_crypto_cipher_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
         new_TestFixture(test_crypto_cipher_aes_encrypt),
+        new_TestFixture(test_crypto_cipher_aes_encrypt_blocks),
         new_TestFixture(test_crypto_cipher_aes_decrypt),
         new_TestFixture(test_crypto_cipher_init_aes_key_length),
     };
@@ -246,11 +246,41 @@ static void test_crypto_modes_ctr_decrypt(void)
                     TEST_CIPHER_LEN, TEST_PLAIN, TEST_PLAIN_LEN);
 }
 
+static void test_crypto_modes_ctr_partial(void)
+{
+    cipher_t cipher;
+    int len, err, cmp;
+    uint8_t ctr[16], data[64];
+
+    err = cipher_init(&cipher, CIPHER_AES, TEST_1_KEY, TEST_1_KEY_LEN);
+    TEST_ASSERT_EQUAL_INT(1, err);
+
+    /* a partial block consumes a whole counter value */
+    memcpy(ctr, TEST_COUNTER, 16);
+    len = cipher_encrypt_ctr(&cipher, ctr, 0, TEST_PLAIN, 37, data);
+    TEST_ASSERT_EQUAL_INT(37, len);
+    cmp = compare(TEST_1_CIPHER, data, len);
+    TEST_ASSERT_MESSAGE(1 == cmp, "wrong ciphertext");
+    TEST_ASSERT_EQUAL_INT(0xff, ctr[14]);
+    TEST_ASSERT_EQUAL_INT(0x02, ctr[15]);
+
+    /* continuing with the counter gives the same key stream */
+    memcpy(ctr, TEST_COUNTER, 16);
+    len = cipher_encrypt_ctr(&cipher, ctr, 0, TEST_PLAIN, 16, data);
+    TEST_ASSERT_EQUAL_INT(16, len);
+    len = cipher_encrypt_ctr(&cipher, ctr, 0, TEST_PLAIN + 16,
+                             TEST_PLAIN_LEN - 16, data + 16);
+    TEST_ASSERT_EQUAL_INT(TEST_PLAIN_LEN - 16, len);
+    cmp = compare(TEST_1_CIPHER, data, TEST_CIPHER_LEN);
+    TEST_ASSERT_MESSAGE(1 == cmp, "wrong ciphertext");
+}
+
 Test *tests_crypto_modes_ctr_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
         new_TestFixture(test_crypto_modes_ctr_encrypt),
-        new_TestFixture(test_crypto_modes_ctr_decrypt)
+        new_TestFixture(test_crypto_modes_ctr_decrypt),
+        new_TestFixture(test_crypto_modes_ctr_partial),
     };
 
     EMB_UNIT_TESTCALLER(crypto_modes_ctr_tests, NULL, NULL, fixtures);
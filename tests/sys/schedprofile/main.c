@@ -0,0 +1,101 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup tests
+ * @{
+ *
+ * @file
+ * @brief       Test application for the scheduler profiler
+ *
+ * @}
+ */
+
+#include <stdio.h>
+
+#include "msg.h"
+#include "schedprofile.h"
+#include "shell.h"
+#include "test_utils/expect.h"
+#include "test_utils/interactive_sync.h"
+#include "thread.h"
+#include "ztimer.h"
+
+#define WAKEUPS     (20U)
+
+static char _stacks[2][THREAD_STACKSIZE_DEFAULT];
+
+static void *_timer_thread(void *arg)
+{
+    (void)arg;
+    for (unsigned i = 0; i < WAKEUPS; i++) {
+        ztimer_sleep(ZTIMER_USEC, 1000);
+    }
+    return NULL;
+}
+
+static void *_msg_thread(void *arg)
+{
+    (void)arg;
+    for (unsigned i = 0; i < WAKEUPS; i++) {
+        msg_t msg;
+
+        msg_receive(&msg);
+    }
+    return NULL;
+}
+
+static unsigned _wakeups(kernel_pid_t pid, schedprofile_wakeup_t src)
+{
+    unsigned sum = 0;
+
+    for (unsigned i = 0; i < CONFIG_SCHEDPROFILE_HIST_SIZE; i++) {
+        sum += schedprofile_pidlist[pid].latency[src][i];
+    }
+    return sum;
+}
+
+int main(void)
+{
+    kernel_pid_t timer_pid, msg_pid;
+
+    test_utils_interactive_sync();
+
+    timer_pid = thread_create(_stacks[0], sizeof(_stacks[0]),
+                              THREAD_PRIORITY_MAIN - 1, THREAD_CREATE_STACKTEST,
+                              _timer_thread, NULL, "timer");
+    msg_pid = thread_create(_stacks[1], sizeof(_stacks[1]),
+                            THREAD_PRIORITY_MAIN - 1, THREAD_CREATE_STACKTEST,
+                            _msg_thread, NULL, "msg");
+    schedprofile_reset();
+    for (unsigned i = 0; i < WAKEUPS; i++) {
+        msg_t msg;
+
+        /* the receiver has a higher priority and preempts main */
+        msg_send(&msg, msg_pid);
+    }
+    /* wait for the timer thread to be done */
+    ztimer_sleep(ZTIMER_USEC, 2 * WAKEUPS * 1000);
+
+    printf("IRQ wakeups of timer thread: %u\n",
+           _wakeups(timer_pid, SCHEDPROFILE_WAKEUP_IRQ));
+    printf("thread wakeups of msg thread: %u\n",
+           _wakeups(msg_pid, SCHEDPROFILE_WAKEUP_THREAD));
+    printf("preemptions of main: %" PRIu32 "\n",
+           schedprofile_pidlist[thread_getpid()].preemptions);
+    expect(_wakeups(timer_pid, SCHEDPROFILE_WAKEUP_IRQ) == WAKEUPS);
+    expect(_wakeups(timer_pid, SCHEDPROFILE_WAKEUP_THREAD) == 0);
+    expect(_wakeups(msg_pid, SCHEDPROFILE_WAKEUP_THREAD) == WAKEUPS);
+    expect(_wakeups(msg_pid, SCHEDPROFILE_WAKEUP_IRQ) == 0);
+    expect(schedprofile_pidlist[thread_getpid()].preemptions >= WAKEUPS);
+    puts("TEST PASSED");
+
+    char line_buf[SHELL_DEFAULT_BUFSIZE];
+    shell_run(NULL, line_buf, SHELL_DEFAULT_BUFSIZE);
+    return 0;
+}
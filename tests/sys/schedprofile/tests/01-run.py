@@ -0,0 +1,43 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 Freie Universität Berlin
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import struct
+import sys
+from testrunner import run
+
+
+def _check_dump(child):
+    child.sendline('schedprofile dump')
+    child.expect(r'(5350[0-9a-f]+)\r?\n')
+    dump = bytes.fromhex(child.match.group(1))
+    version, buckets = struct.unpack_from('<BB', dump, 2)
+    assert version == 1
+    rec_size = 29 + 4 * buckets
+    assert (len(dump) - 4) % rec_size == 0
+    pids = []
+    for offset in range(4, len(dump), rec_size):
+        pid, schedules = struct.unpack_from('<BI', dump, offset)
+        assert schedules > 0
+        pids.append(pid)
+    # main, timer and msg thread at least
+    assert len(pids) >= 3
+
+
+def testfunc(child):
+    child.expect_exact('TEST PASSED')
+    child.sendline('schedprofile')
+    child.expect(r'\d+ \| main\s+\|')
+    child.expect(r'wakeup latency \(IRQ\), max \d+ us: >=\d+:\d+')
+    child.expect_exact('>')
+    _check_dump(child)
+    child.sendline('schedprofile reset')
+    child.expect_exact('>')
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
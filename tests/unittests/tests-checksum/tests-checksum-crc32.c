@@ -56,6 +56,28 @@ static void test_checksum_crc32_sequence_4bytes(void)
     TEST_ASSERT_EQUAL_INT(expect, crc32(buf, sizeof(buf)));
 }
 
+static void test_checksum_crc32_sequence_unaligned(void)
+{
+    /* starts at an odd address, length is neither a multiple of 4 nor of 8 */
+    unsigned char buf[] = "_The quick brown fox jumps over the lazy dog";
+    uint32_t expect = 0x414fa339;
+
+    TEST_ASSERT_EQUAL_INT(expect, crc32(buf + 1, sizeof(buf) - 2));
+}
+
+static void test_checksum_crc32_sequence_0to255(void)
+{
+    /* indexes every entry of the lookup tables */
+    unsigned char buf[256];
+    uint32_t expect = 0x29058c73;
+
+    for (unsigned i = 0; i < sizeof(buf); i++) {
+        buf[i] = i;
+    }
+
+    TEST_ASSERT_EQUAL_INT(expect, crc32(buf, sizeof(buf)));
+}
+
 Test *tests_checksum_crc32_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -64,6 +86,8 @@ Test *tests_checksum_crc32_tests(void)
         new_TestFixture(test_checksum_crc32_sequence_256a),
         new_TestFixture(test_checksum_crc32_sequence_1to9),
         new_TestFixture(test_checksum_crc32_sequence_4bytes),
+        new_TestFixture(test_checksum_crc32_sequence_unaligned),
+        new_TestFixture(test_checksum_crc32_sequence_0to255),
     };
 
     EMB_UNIT_TESTCALLER(checksum_crc32_tests, NULL, NULL, fixtures);
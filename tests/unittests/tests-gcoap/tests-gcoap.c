@@ -18,6 +18,10 @@
 #include "embUnit.h"
 
 #include "net/gcoap.h"
+#include "net/gnrc/netreg.h"
+#include "net/gnrc/pktbuf.h"
+#include "net/ipv6/addr.h"
+#include "thread.h"
 
 #include "unittests-constants.h"
 #include "tests-gcoap.h"
@@ -232,6 +236,66 @@ static void test_gcoap__client_ping(void)
     TEST_ASSERT_EQUAL_INT(4 + ETAG_SLACK, res);
 }
 
+static void _resp_handler(const gcoap_request_memo_t *memo, coap_pkt_t *pdu,
+                          const sock_udp_ep_t *remote)
+{
+    (void)memo;
+    (void)pdu;
+    (void)remote;
+}
+
+static ssize_t _send_non_req(const sock_udp_ep_t *remote, const uint8_t *token)
+{
+    uint8_t buf[CONFIG_GCOAP_PDU_BUF_SIZE];
+    coap_pkt_t pdu;
+    ssize_t len;
+
+    gcoap_req_init(&pdu, buf, CONFIG_GCOAP_PDU_BUF_SIZE, COAP_METHOD_GET,
+                   "/time");
+    coap_hdr_set_type(pdu.hdr, COAP_TYPE_NON);
+    memcpy(coap_get_token(&pdu), token, coap_get_token_len(&pdu));
+    len = coap_opt_finish(&pdu, COAP_OPT_FINISH_NONE);
+
+    return gcoap_req_send(buf, len, remote, _resp_handler, NULL,
+                          GCOAP_SOCKET_TYPE_UDP);
+}
+
+/*
+ * Open requests to two remotes with the same token end up in the same bucket
+ * with CONFIG_GCOAP_MEMO_HASH. Each must only be found for its own remote,
+ * and not anymore once it was forgotten.
+ */
+static void test_gcoap__client_req_memo_lookup(void)
+{
+    static const uint8_t token[CONFIG_GCOAP_TOKENLEN] = { 0 };
+    sock_udp_ep_t remotes[] = {
+        { .family = AF_INET6, .port = COAP_PORT },
+        { .family = AF_INET6, .port = COAP_PORT },
+    };
+    gnrc_netreg_entry_t udp;
+
+    gnrc_pktbuf_init();
+    /* the packets are dropped when handed to this thread, but count as sent */
+    gnrc_netreg_entry_init_pid(&udp, GNRC_NETREG_DEMUX_CTX_ALL,
+                               thread_getpid());
+    TEST_ASSERT_EQUAL_INT(0, gnrc_netreg_register(GNRC_NETTYPE_UDP, &udp));
+    ipv6_addr_from_str((ipv6_addr_t *)&remotes[0].addr.ipv6, "2001:db8::1");
+    ipv6_addr_from_str((ipv6_addr_t *)&remotes[1].addr.ipv6, "2001:db8::2");
+
+    TEST_ASSERT(_send_non_req(&remotes[0], token) > 0);
+    TEST_ASSERT(_send_non_req(&remotes[1], token) > 0);
+    gnrc_netreg_unregister(GNRC_NETTYPE_UDP, &udp);
+
+    TEST_ASSERT_EQUAL_INT(0, gcoap_obs_req_forget(&remotes[1], token,
+                                                  sizeof(token)));
+    TEST_ASSERT_EQUAL_INT(-ENOENT, gcoap_obs_req_forget(&remotes[1], token,
+                                                        sizeof(token)));
+    TEST_ASSERT_EQUAL_INT(0, gcoap_obs_req_forget(&remotes[0], token,
+                                                  sizeof(token)));
+    TEST_ASSERT_EQUAL_INT(-ENOENT, gcoap_obs_req_forget(&remotes[0], token,
+                                                        sizeof(token)));
+}
+
 /*
  * Helper for server_get tests below.
  * Request from libcoap example for gcoap_cli /cli/stats resource
@@ -401,6 +465,7 @@ Test *tests_gcoap_tests(void)
         new_TestFixture(test_gcoap__client_put_req_overfill),
         new_TestFixture(test_gcoap__client_get_path_defer),
         new_TestFixture(test_gcoap__client_ping),
+        new_TestFixture(test_gcoap__client_req_memo_lookup),
         new_TestFixture(test_gcoap__server_get_req),
         new_TestFixture(test_gcoap__server_get_resp),
         new_TestFixture(test_gcoap__server_con_req),
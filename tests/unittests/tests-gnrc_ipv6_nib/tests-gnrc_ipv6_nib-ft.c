@@ -178,6 +178,48 @@ static void test_nib_ft_get__success4(void)
     TEST_ASSERT_EQUAL_INT(IFACE, fte.iface);
 }
 
+/*
+ * Adds routes with nested prefixes of increasing length and a sibling to the
+ * longest one, then tries to get an address that is not covered by the
+ * longest prefix. Removes the best match and tries again.
+ * Expected result: gnrc_ipv6_nib_ft_get() returns the longest covering route
+ * and falls back to the next shorter one after its removal
+ */
+static void test_nib_ft_get__success5(void)
+{
+    gnrc_ipv6_nib_ft_t fte;
+    static const ipv6_addr_t pfx = { .u8 = { 0x20, 0x01, 0x0d, 0xb8,
+                                             0x00, 0x01, 0x00, 0x02 } };
+    static const ipv6_addr_t sibling = { .u8 = { 0x20, 0x01, 0x0d, 0xb8,
+                                                 0x00, 0x01, 0x80, 0x00 } };
+    static const ipv6_addr_t dst = { .u8 = { 0x20, 0x01, 0x0d, 0xb8,
+                                             0x00, 0x01, 0x00, 0x03,
+                                             0, 0, 0, 0, 0, 0, 0, 1 } };
+    ipv6_addr_t next_hop = { .u64 = { { .u8 = LINK_LOCAL_PREFIX },
+                                      { .u64 = TEST_UINT64 } } };
+
+    for (unsigned pfx_len = 16; pfx_len <= 64; pfx_len += 16) {
+        TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_nib_ft_add(&pfx, pfx_len,
+                                                      &next_hop, IFACE, 0));
+        next_hop.u64[1].u64++;
+    }
+    TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_nib_ft_add(&sibling, 64,
+                                                  &next_hop, IFACE, 0));
+    TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_nib_ft_get(&dst, NULL, &fte));
+    TEST_ASSERT_EQUAL_INT(48, fte.dst_len);
+    TEST_ASSERT(ipv6_addr_match_prefix(&pfx, &fte.dst) >= 48);
+    gnrc_ipv6_nib_ft_del(&pfx, 48);
+    TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_nib_ft_get(&dst, NULL, &fte));
+    TEST_ASSERT_EQUAL_INT(32, fte.dst_len);
+    TEST_ASSERT(ipv6_addr_match_prefix(&pfx, &fte.dst) >= 32);
+    TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_nib_ft_get(&pfx, NULL, &fte));
+    TEST_ASSERT_EQUAL_INT(64, fte.dst_len);
+    TEST_ASSERT(ipv6_addr_equal(&pfx, &fte.dst));
+    TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_nib_ft_get(&sibling, NULL, &fte));
+    TEST_ASSERT_EQUAL_INT(64, fte.dst_len);
+    TEST_ASSERT(ipv6_addr_equal(&sibling, &fte.dst));
+}
+
 /*
  * Tries to create a forwarding table entry for the default route (::) with
  * NULL as next hop.
@@ -727,6 +769,7 @@ Test *tests_gnrc_ipv6_nib_ft_tests(void)
         new_TestFixture(test_nib_ft_get__success2),
         new_TestFixture(test_nib_ft_get__success3),
         new_TestFixture(test_nib_ft_get__success4),
+        new_TestFixture(test_nib_ft_get__success5),
         new_TestFixture(test_nib_ft_add__EINVAL_def_route_next_hop_NULL),
         new_TestFixture(test_nib_ft_add__EINVAL_iface0),
         new_TestFixture(test_nib_ft_add__ENOMEM_diff_def_router),
@@ -140,6 +140,30 @@ static void test_nib_alloc__success_noaddr_override(void)
     TEST_ASSERT(ipv6_addr_equal(&addr, &node1->ipv6));
 }
 
+/*
+ * Creates two persistent on-link entries with different addresses on the same
+ * interface, removes the address of the first and then tries to create
+ * another one with the address of the second.
+ * Expected result: the first entry should be taken over
+ */
+static void test_nib_alloc__success_noaddr_override_first(void)
+{
+    _nib_onl_entry_t *node1, *node2;
+    ipv6_addr_t addr = { .u64 = { { .u8 = GLOBAL_PREFIX },
+                                  { .u64 = TEST_UINT64 } } };
+
+    TEST_ASSERT_NOT_NULL((node1 = _nib_onl_alloc(&addr, IFACE)));
+    node1->mode |= _NC;
+    addr.u64[1].u64++;
+    TEST_ASSERT_NOT_NULL((node2 = _nib_onl_alloc(&addr, IFACE)));
+    node2->mode |= _NC;
+    TEST_ASSERT(node1 != node2);
+    _nib_onl_unindex(node1);
+    node1->ipv6 = ipv6_addr_unspecified;
+    TEST_ASSERT(node1 == _nib_onl_alloc(&addr, IFACE));
+    TEST_ASSERT(ipv6_addr_equal(&addr, &node1->ipv6));
+}
+
 /*
  * Creates an non-persistent entry.
  * Expected result: new entry should contain the given address and interface
@@ -361,6 +385,39 @@ static void test_nib_get__empty(void)
     TEST_ASSERT_NULL(_nib_onl_get(&addr, IFACE));
 }
 
+/*
+ * Fills the NIB with entries, removes every other one and then tries to get
+ * all of them.
+ * Expected result: _nib_onl_get() returns only the remaining entries
+ */
+static void test_nib_get__success_after_remove(void)
+{
+    _nib_onl_entry_t *nodes[CONFIG_GNRC_IPV6_NIB_NUMOF];
+    ipv6_addr_t addr = { .u64 = { { .u8 = GLOBAL_PREFIX },
+                                  { .u64 = TEST_UINT64 } } };
+
+    for (int i = 0; i < CONFIG_GNRC_IPV6_NIB_NUMOF; i++) {
+        TEST_ASSERT_NOT_NULL((nodes[i] = _nib_onl_alloc(&addr, IFACE)));
+        nodes[i]->mode = _NC;
+        addr.u64[1].u64++;
+    }
+    for (int i = 0; i < CONFIG_GNRC_IPV6_NIB_NUMOF; i += 2) {
+        nodes[i]->mode = _EMPTY;
+        TEST_ASSERT(_nib_onl_clear(nodes[i]));
+    }
+    addr.u64[1].u64 = TEST_UINT64;
+    for (int i = 0; i < CONFIG_GNRC_IPV6_NIB_NUMOF; i++) {
+        if (i % 2) {
+            TEST_ASSERT(nodes[i] == _nib_onl_get(&addr, IFACE));
+            TEST_ASSERT(nodes[i] == _nib_onl_get(&addr, 0));
+        }
+        else {
+            TEST_ASSERT_NULL(_nib_onl_get(&addr, IFACE));
+        }
+        addr.u64[1].u64++;
+    }
+}
+
 /*
  * Creates CONFIG_GNRC_IPV6_NIB_NUMOF neighbor cache entries with different IP
  * addresses and a non-garbage-collectible AR state and then tries to add
@@ -2008,6 +2065,7 @@ Test *tests_gnrc_ipv6_nib_internal_tests(void)
         new_TestFixture(test_nib_alloc__no_space_left_diff_addr_iface),
         new_TestFixture(test_nib_alloc__success_duplicate),
         new_TestFixture(test_nib_alloc__success_noaddr_override),
+        new_TestFixture(test_nib_alloc__success_noaddr_override_first),
         new_TestFixture(test_nib_alloc__success),
         new_TestFixture(test_nib_clear__persistent),
         new_TestFixture(test_nib_clear__non_persistent_but_content),
@@ -2020,6 +2078,7 @@ Test *tests_gnrc_ipv6_nib_internal_tests(void)
         new_TestFixture(test_nib_get__empty),
         new_TestFixture(test_nib_get__not_in_nib),
         new_TestFixture(test_nib_get__success),
+        new_TestFixture(test_nib_get__success_after_remove),
         new_TestFixture(test_nib_nc_add__no_space_left_diff_addr),
         new_TestFixture(test_nib_nc_add__no_space_left_diff_iface),
         new_TestFixture(test_nib_nc_add__no_space_left_diff_addr_iface),
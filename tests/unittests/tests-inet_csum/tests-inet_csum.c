@@ -13,8 +13,10 @@
  */
 #include <errno.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include "embUnit.h"
+#include "kernel_defines.h"
 
 #include "net/inet_csum.h"
 
@@ -165,6 +167,77 @@ static void test_inet_csum__empty_app_buffer(void)
     TEST_ASSERT_EQUAL_INT(hdr_expected, pyld_sum);
 }
 
+/* straightforward byte-wise implementation to check against */
+static uint16_t _ref_csum_slice(uint16_t sum, const uint8_t *buf, uint16_t len,
+                                size_t accum_len)
+{
+    uint32_t csum = sum;
+
+    for (unsigned i = 0; i < len; i++, accum_len++) {
+        csum += (accum_len & 1) ? buf[i] : (uint16_t)(buf[i] << 8);
+    }
+    while (csum >> 16) {
+        csum = (csum & 0xffff) + (csum >> 16);
+    }
+    return csum;
+}
+
+static void test_inet_csum__cross_check(void)
+{
+    static uint8_t data[1500 + 8];
+    static const uint16_t lens[] = {
+        0, 1, 2, 3, 4, 5, 7, 8, 15, 16, 17, 31, 32, 33, 63, 64, 65, 127, 1500
+    };
+    uint32_t state = 0x5eed;
+
+    for (unsigned i = 0; i < sizeof(data); i++) {
+        state = state * 1103515245 + 12345;
+        data[i] = state >> 16;
+    }
+    /* all alignments of buffer and accumulated length */
+    for (unsigned offset = 0; offset < 8; offset++) {
+        for (unsigned i = 0; i < ARRAY_SIZE(lens); i++) {
+            for (size_t accum_len = 0; accum_len < 4; accum_len++) {
+                const uint8_t *buf = &data[offset];
+                uint16_t sum = accum_len * 0x4321;
+
+                TEST_ASSERT_EQUAL_INT(_ref_csum_slice(sum, buf, lens[i], accum_len),
+                                      inet_csum_slice(sum, buf, lens[i], accum_len));
+            }
+        }
+    }
+}
+
+static void test_inet_csum__all_ones(void)
+{
+    /* every addition carries */
+    static uint8_t data[2047];
+
+    memset(data, 0xff, sizeof(data));
+    TEST_ASSERT_EQUAL_INT(_ref_csum_slice(0xffff, data, sizeof(data), 0),
+                          inet_csum_slice(0xffff, data, sizeof(data), 0));
+    TEST_ASSERT_EQUAL_INT(_ref_csum_slice(0xffff, &data[1], sizeof(data) - 1, 1),
+                          inet_csum_slice(0xffff, &data[1], sizeof(data) - 1, 1));
+}
+
+static void test_inet_csum__slices(void)
+{
+    uint8_t data[67];
+    uint16_t expected;
+
+    for (unsigned i = 0; i < sizeof(data); i++) {
+        data[i] = (i * 37) + 11;
+    }
+    expected = inet_csum(0, data, sizeof(data));
+    /* splitting the domain at any point must not change the result */
+    for (unsigned split = 0; split <= sizeof(data); split++) {
+        uint16_t sum = inet_csum_slice(0, data, split, 0);
+
+        sum = inet_csum_slice(sum, &data[split], sizeof(data) - split, split);
+        TEST_ASSERT_EQUAL_INT(expected, sum);
+    }
+}
+
 Test *tests_inet_csum_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -176,6 +249,9 @@ Test *tests_inet_csum_tests(void)
         new_TestFixture(test_inet_csum__odd_len),
         new_TestFixture(test_inet_csum__two_app_snips),
         new_TestFixture(test_inet_csum__empty_app_buffer),
+        new_TestFixture(test_inet_csum__cross_check),
+        new_TestFixture(test_inet_csum__all_ones),
+        new_TestFixture(test_inet_csum__slices),
     };
 
     EMB_UNIT_TESTCALLER(inet_csum_tests, NULL, NULL, fixtures);
@@ -311,6 +311,57 @@ static void test_nanocoap_cache__max_age(void)
     TEST_ASSERT(nanocoap_cache_entry_is_stale(c, 20));
 }
 
+static void test_nanocoap_cache__evict_stale(void)
+{
+    uint8_t rbuf[_BUF_SIZE];
+    coap_pkt_t resp;
+    uint8_t keys[CONFIG_NANOCOAP_CACHE_ENTRIES + 1][CONFIG_NANOCOAP_CACHE_KEY_LENGTH];
+    nanocoap_cache_entry_t *c = NULL;
+    nanocoap_cache_stats_t stats;
+    size_t len;
+
+    /* initialize the nanocoap cache */
+    nanocoap_cache_init();
+
+    len = coap_build_hdr((coap_hdr_t *)&rbuf[0], COAP_TYPE_NON,
+                         NULL, 0, COAP_CODE_205, 0);
+    coap_pkt_init(&resp, &rbuf[0], sizeof(rbuf), len);
+    len = coap_opt_finish(&resp, COAP_OPT_FINISH_NONE);
+
+    /* keys only differing in the last byte end up in the same bucket */
+    memset(keys, 0xAA, sizeof(keys));
+    for (unsigned i = 0; i < ARRAY_SIZE(keys); i++) {
+        keys[i][CONFIG_NANOCOAP_CACHE_KEY_LENGTH - 1] = i;
+    }
+    for (unsigned i = 0; i < CONFIG_NANOCOAP_CACHE_ENTRIES; i++) {
+        c = nanocoap_cache_add_by_key(keys[i], COAP_METHOD_GET, &resp, len);
+        TEST_ASSERT_NOT_NULL(c);
+    }
+
+    /* make an entry other than the least recently used one stale */
+    c = nanocoap_cache_key_lookup(keys[CONFIG_NANOCOAP_CACHE_ENTRIES / 2]);
+    TEST_ASSERT_NOT_NULL(c);
+    c->max_age = ztimer_now(ZTIMER_SEC) - 1;
+
+    c = nanocoap_cache_add_by_key(keys[CONFIG_NANOCOAP_CACHE_ENTRIES],
+                                  COAP_METHOD_GET, &resp, len);
+    TEST_ASSERT_NOT_NULL(c);
+    TEST_ASSERT_EQUAL_INT(0, nanocoap_cache_free_count());
+
+    /* the stale entry was replaced, not the least recently used one */
+    TEST_ASSERT_NULL(nanocoap_cache_key_lookup(keys[CONFIG_NANOCOAP_CACHE_ENTRIES / 2]));
+    for (unsigned i = 0; i < ARRAY_SIZE(keys); i++) {
+        if (i != CONFIG_NANOCOAP_CACHE_ENTRIES / 2) {
+            TEST_ASSERT_NOT_NULL(nanocoap_cache_key_lookup(keys[i]));
+        }
+    }
+
+    nanocoap_cache_stats_get(&stats);
+    TEST_ASSERT_EQUAL_INT(CONFIG_NANOCOAP_CACHE_ENTRIES + 1, stats.hits);
+    TEST_ASSERT_EQUAL_INT(1, stats.misses);
+    TEST_ASSERT_EQUAL_INT(1, stats.evictions);
+}
+
 Test *tests_nanocoap_cache_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -319,6 +370,7 @@ Test *tests_nanocoap_cache_tests(void)
         new_TestFixture(test_nanocoap_cache__cachekey),
         new_TestFixture(test_nanocoap_cache__cachekey_blockwise),
         new_TestFixture(test_nanocoap_cache__max_age),
+        new_TestFixture(test_nanocoap_cache__evict_stale),
     };
 
     EMB_UNIT_TESTCALLER(nanocoap_cache_entry_tests, NULL, NULL, fixtures);
@@ -185,6 +185,40 @@ void test_netreg_getnext__2_entries(void)
     gnrc_netreg_release_shared();
 }
 
+static void test_netreg_udp__ports(void)
+{
+    /* the first two ports share a bucket */
+    gnrc_netreg_entry_t udp[] = {
+        GNRC_NETREG_ENTRY_INIT_PID(TEST_UINT16, TEST_UINT8),
+        GNRC_NETREG_ENTRY_INIT_PID(TEST_UINT16 + CONFIG_GNRC_NETREG_UDP_BUCKETS,
+                                   TEST_UINT8),
+        GNRC_NETREG_ENTRY_INIT_PID(GNRC_NETREG_DEMUX_CTX_ALL, TEST_UINT8),
+    };
+
+    for (unsigned i = 0; i < ARRAY_SIZE(udp); i++) {
+        TEST_ASSERT_EQUAL_INT(0, gnrc_netreg_register(GNRC_NETTYPE_UDP, &udp[i]));
+    }
+
+    gnrc_netreg_acquire_shared();
+    for (unsigned i = 0; i < ARRAY_SIZE(udp); i++) {
+        TEST_ASSERT(gnrc_netreg_lookup(GNRC_NETTYPE_UDP, udp[i].demux_ctx) == &udp[i]);
+        TEST_ASSERT_NULL(gnrc_netreg_getnext(&udp[i]));
+        TEST_ASSERT_EQUAL_INT(1, gnrc_netreg_num(GNRC_NETTYPE_UDP, udp[i].demux_ctx));
+    }
+    TEST_ASSERT_NULL(gnrc_netreg_lookup(GNRC_NETTYPE_UDP, TEST_UINT16 - 1));
+    TEST_ASSERT_NULL(gnrc_netreg_lookup(GNRC_NETTYPE_TEST, TEST_UINT16));
+    gnrc_netreg_release_shared();
+
+    gnrc_netreg_unregister(GNRC_NETTYPE_UDP, &udp[0]);
+    gnrc_netreg_acquire_shared();
+    TEST_ASSERT_NULL(gnrc_netreg_lookup(GNRC_NETTYPE_UDP, udp[0].demux_ctx));
+    TEST_ASSERT(gnrc_netreg_lookup(GNRC_NETTYPE_UDP, udp[1].demux_ctx) == &udp[1]);
+    gnrc_netreg_release_shared();
+
+    gnrc_netreg_unregister(GNRC_NETTYPE_UDP, &udp[1]);
+    gnrc_netreg_unregister(GNRC_NETTYPE_UDP, &udp[2]);
+}
+
 Test *tests_netreg_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -201,6 +235,7 @@ Test *tests_netreg_tests(void)
         new_TestFixture(test_netreg_num__2_entries),
         new_TestFixture(test_netreg_getnext__NULL),
         new_TestFixture(test_netreg_getnext__2_entries),
+        new_TestFixture(test_netreg_udp__ports),
     };
 
     EMB_UNIT_TESTCALLER(netreg_tests, set_up, NULL, fixtures);
@@ -500,6 +500,40 @@ static void test_pktbuf_mark__success_equally_sized(void)
     TEST_ASSERT(gnrc_pktbuf_is_empty());
 }
 
+static void test_pktbuf_mark__success_padded(void)
+{
+    size_t pad = gnrc_pktbuf_mark_pad(sizeof(TEST_STRING8) - 1);
+    gnrc_pktsnip_t *pkt1 = gnrc_pktbuf_add(NULL, NULL,
+                                           pad + sizeof(TEST_STRING16) - 1,
+                                           GNRC_NETTYPE_TEST);
+    gnrc_pktsnip_t *pkt2;
+    uint8_t *data;
+
+    TEST_ASSERT_NOT_NULL(pkt1);
+    data = pkt1->data;
+    memcpy(data + pad, TEST_STRING16, sizeof(TEST_STRING16) - 1);
+    TEST_ASSERT_NOT_NULL((pkt2 = gnrc_pktbuf_mark(pkt1,
+                                                  pad + sizeof(TEST_STRING8) - 1,
+                                                  GNRC_NETTYPE_UNDEF)));
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+#ifndef MODULE_GNRC_PKTBUF_MALLOC   /* always copies */
+    /* the remainder must not have been moved */
+    TEST_ASSERT(pkt1->data == data + pad + sizeof(TEST_STRING8) - 1);
+#endif
+    TEST_ASSERT_EQUAL_INT(sizeof(TEST_STRING16) - sizeof(TEST_STRING8),
+                          pkt1->size);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(TEST_STRING16 + sizeof(TEST_STRING8) - 1,
+                                    pkt1->data, pkt1->size));
+    TEST_ASSERT_EQUAL_INT(pad + sizeof(TEST_STRING8) - 1, pkt2->size);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(TEST_STRING16, (uint8_t *)pkt2->data + pad,
+                                    sizeof(TEST_STRING8) - 1));
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+
+    gnrc_pktbuf_release(pkt1);
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
 static void test_pktbuf_realloc_data__size_0(void)
 {
     gnrc_pktsnip_t *pkt = gnrc_pktbuf_add(NULL, NULL, sizeof(TEST_STRING8), GNRC_NETTYPE_TEST);
@@ -886,6 +920,7 @@ Test *tests_pktbuf_tests(void)
         new_TestFixture(test_pktbuf_mark__success_aligned),
         new_TestFixture(test_pktbuf_mark__success_small),
         new_TestFixture(test_pktbuf_mark__success_equally_sized),
+        new_TestFixture(test_pktbuf_mark__success_padded),
         new_TestFixture(test_pktbuf_realloc_data__size_0),
 #ifndef MODULE_GNRC_PKTBUF_MALLOC
         new_TestFixture(test_pktbuf_realloc_data__memfull),
@@ -0,0 +1,253 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ * @brief       Unittests for the vfs_buffered module
+ */
+#include <errno.h>
+#include <stdint.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "embUnit/embUnit.h"
+
+#include "vfs.h"
+
+#include "tests-vfs.h"
+
+#define _MOCK_FILE_SIZE     (4 * CONFIG_VFS_BUFFERED_SIZE)
+
+static uint8_t _mock_file[_MOCK_FILE_SIZE];
+static size_t _mock_file_len;
+static unsigned _mock_read_calls;
+static unsigned _mock_write_calls;
+static mode_t _mock_mode;
+
+static ssize_t _mock_read(vfs_file_t *filp, void *dest, size_t nbytes)
+{
+    ++_mock_read_calls;
+    if (filp->pos >= (off_t)_mock_file_len) {
+        return 0;
+    }
+    if (nbytes > _mock_file_len - filp->pos) {
+        nbytes = _mock_file_len - filp->pos;
+    }
+    memcpy(dest, &_mock_file[filp->pos], nbytes);
+    filp->pos += nbytes;
+    return nbytes;
+}
+
+static ssize_t _mock_write(vfs_file_t *filp, const void *src, size_t nbytes)
+{
+    ++_mock_write_calls;
+    if (nbytes > sizeof(_mock_file) - filp->pos) {
+        return -ENOSPC;
+    }
+    memcpy(&_mock_file[filp->pos], src, nbytes);
+    filp->pos += nbytes;
+    if ((size_t)filp->pos > _mock_file_len) {
+        _mock_file_len = filp->pos;
+    }
+    return nbytes;
+}
+
+static int _mock_fstat(vfs_file_t *filp, struct stat *buf)
+{
+    (void)filp;
+    buf->st_mode = _mock_mode;
+    buf->st_size = _mock_file_len;
+    return 0;
+}
+
+static const vfs_file_ops_t _mock_file_ops = {
+    .read  = _mock_read,
+    .write = _mock_write,
+    .fstat = _mock_fstat,
+};
+
+static const vfs_file_system_ops_t _mock_fs_ops = { 0 };
+
+static const vfs_file_system_t _mock_file_system = {
+    .f_op = &_mock_file_ops,
+    .fs_op = &_mock_fs_ops,
+};
+
+static vfs_mount_t _test_vfs_mount_mock = {
+    .mount_point = "/test",
+    .fs = &_mock_file_system,
+};
+
+static void setup(void)
+{
+    for (unsigned i = 0; i < sizeof(_mock_file); i++) {
+        _mock_file[i] = i;
+    }
+    _mock_file_len = sizeof(_mock_file);
+    _mock_read_calls = 0;
+    _mock_write_calls = 0;
+    _mock_mode = S_IFREG;
+    vfs_buffered_stats_reset();
+    vfs_mount(&_test_vfs_mount_mock);
+}
+
+static void teardown(void)
+{
+    vfs_umount(&_test_vfs_mount_mock, false);
+}
+
+static void test_vfs_buffered_read(void)
+{
+    uint8_t buf[3];
+    int fd = vfs_open("/test/file", O_RDONLY, 0);
+    TEST_ASSERT(fd >= 0);
+
+    /* small reads are served from the read-ahead */
+    for (unsigned i = 0; i < CONFIG_VFS_BUFFERED_SIZE / sizeof(buf); i++) {
+        TEST_ASSERT_EQUAL_INT(sizeof(buf), vfs_read(fd, buf, sizeof(buf)));
+        TEST_ASSERT_EQUAL_INT(i * sizeof(buf), buf[0]);
+        TEST_ASSERT_EQUAL_INT(i * sizeof(buf) + 2, buf[2]);
+    }
+    TEST_ASSERT_EQUAL_INT(1, _mock_read_calls);
+
+    /* the position excludes the unread part of the read-ahead */
+    off_t pos = (CONFIG_VFS_BUFFERED_SIZE / sizeof(buf)) * sizeof(buf);
+    TEST_ASSERT_EQUAL_INT(pos, vfs_lseek(fd, 0, SEEK_CUR));
+    TEST_ASSERT_EQUAL_INT(1, vfs_read(fd, buf, 1));
+    TEST_ASSERT_EQUAL_INT(pos, buf[0]);
+
+    /* large reads bypass the buffer */
+    uint8_t large[CONFIG_VFS_BUFFERED_SIZE];
+    unsigned calls = _mock_read_calls;
+    TEST_ASSERT_EQUAL_INT(sizeof(large), vfs_read(fd, large, sizeof(large)));
+    TEST_ASSERT_EQUAL_INT(calls + 1, _mock_read_calls);
+    TEST_ASSERT_EQUAL_INT((uint8_t)(pos + 1), large[0]);
+
+    vfs_buffered_stats_t stats;
+    vfs_buffered_stats(&stats);
+    TEST_ASSERT_EQUAL_INT(CONFIG_VFS_BUFFERED_SIZE / sizeof(buf) + 2, stats.reads);
+    TEST_ASSERT_EQUAL_INT(_mock_read_calls, stats.driver_reads);
+
+    TEST_ASSERT_EQUAL_INT(0, vfs_close(fd));
+}
+
+static void test_vfs_buffered_readline(void)
+{
+    static const char lines[] = "first\nsecond\n";
+    char line[16];
+
+    memcpy(_mock_file, lines, sizeof(lines) - 1);
+    _mock_file_len = sizeof(lines) - 1;
+
+    int fd = vfs_open("/test/file", O_RDONLY, 0);
+    TEST_ASSERT(fd >= 0);
+    TEST_ASSERT_EQUAL_INT(6, vfs_readline(fd, line, sizeof(line)));
+    TEST_ASSERT_EQUAL_STRING("first", line);
+    TEST_ASSERT_EQUAL_INT(7, vfs_readline(fd, line, sizeof(line)));
+    TEST_ASSERT_EQUAL_STRING("second", line);
+    TEST_ASSERT_EQUAL_INT(1, _mock_read_calls);
+    TEST_ASSERT_EQUAL_INT(0, vfs_close(fd));
+}
+
+static void test_vfs_buffered_write(void)
+{
+    static const uint8_t data[] = { 0xaa, 0xbb, 0xcc, 0xdd };
+    int fd = vfs_open("/test/file", O_RDWR, 0);
+    TEST_ASSERT(fd >= 0);
+
+    /* small writes are coalesced until the file is synced */
+    for (unsigned i = 0; i < 4; i++) {
+        TEST_ASSERT_EQUAL_INT(sizeof(data), vfs_write(fd, data, sizeof(data)));
+    }
+    TEST_ASSERT_EQUAL_INT(0, _mock_write_calls);
+    TEST_ASSERT_EQUAL_INT(0, _mock_file[0]);
+    TEST_ASSERT_EQUAL_INT(-EINVAL, vfs_fsync(fd));
+    TEST_ASSERT_EQUAL_INT(1, _mock_write_calls);
+    TEST_ASSERT_EQUAL_INT(0xaa, _mock_file[12]);
+    TEST_ASSERT_EQUAL_INT(16, _mock_file[16]);
+
+    /* writing after a read continues at the position of the reader */
+    uint8_t buf[2];
+    TEST_ASSERT_EQUAL_INT(sizeof(buf), vfs_read(fd, buf, sizeof(buf)));
+    TEST_ASSERT_EQUAL_INT(16, buf[0]);
+    TEST_ASSERT_EQUAL_INT(sizeof(data), vfs_write(fd, data, sizeof(data)));
+    TEST_ASSERT_EQUAL_INT(0, vfs_close(fd));
+    TEST_ASSERT_EQUAL_INT(17, _mock_file[17]);
+    TEST_ASSERT_EQUAL_INT(0xaa, _mock_file[18]);
+    TEST_ASSERT_EQUAL_INT(0xdd, _mock_file[21]);
+    TEST_ASSERT_EQUAL_INT(22, _mock_file[22]);
+
+    vfs_buffered_stats_t stats;
+    vfs_buffered_stats(&stats);
+    TEST_ASSERT_EQUAL_INT(5, stats.writes);
+    TEST_ASSERT_EQUAL_INT(2, stats.driver_writes);
+}
+
+static void test_vfs_buffered_pool(void)
+{
+    int fds[CONFIG_VFS_BUFFERED_NUMOF + 1];
+    uint8_t buf[1];
+
+    for (unsigned i = 0; i < ARRAY_SIZE(fds); i++) {
+        fds[i] = vfs_open("/test/file", O_RDONLY, 0);
+        TEST_ASSERT(fds[i] >= 0);
+    }
+    /* the last file got no buffer and reads directly */
+    for (unsigned i = 0; i < 2; i++) {
+        TEST_ASSERT_EQUAL_INT(1, vfs_read(fds[ARRAY_SIZE(fds) - 1], buf, 1));
+    }
+    TEST_ASSERT_EQUAL_INT(2, _mock_read_calls);
+    for (unsigned i = 0; i < ARRAY_SIZE(fds); i++) {
+        TEST_ASSERT_EQUAL_INT(0, vfs_close(fds[i]));
+    }
+
+    /* closed files return their buffer */
+    fds[0] = vfs_open("/test/file", O_RDONLY, 0);
+    TEST_ASSERT(fds[0] >= 0);
+    for (unsigned i = 0; i < 2; i++) {
+        TEST_ASSERT_EQUAL_INT(1, vfs_read(fds[0], buf, 1));
+    }
+    TEST_ASSERT_EQUAL_INT(3, _mock_read_calls);
+    TEST_ASSERT_EQUAL_INT(0, vfs_close(fds[0]));
+}
+
+static void test_vfs_buffered_device(void)
+{
+    uint8_t buf[1];
+
+    /* devices get no buffer and read directly */
+    _mock_mode = S_IFCHR;
+    int fd = vfs_open("/test/file", O_RDONLY, 0);
+    TEST_ASSERT(fd >= 0);
+    for (unsigned i = 0; i < 2; i++) {
+        TEST_ASSERT_EQUAL_INT(1, vfs_read(fd, buf, 1));
+    }
+    TEST_ASSERT_EQUAL_INT(2, _mock_read_calls);
+    TEST_ASSERT_EQUAL_INT(0, vfs_close(fd));
+}
+
+Test *tests_vfs_buffered_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_vfs_buffered_read),
+        new_TestFixture(test_vfs_buffered_readline),
+        new_TestFixture(test_vfs_buffered_write),
+        new_TestFixture(test_vfs_buffered_pool),
+        new_TestFixture(test_vfs_buffered_device),
+    };
+
+    EMB_UNIT_TESTCALLER(vfs_buffered_tests, setup, teardown, fixtures);
+
+    return (Test *)&vfs_buffered_tests;
+}
+
+/** @} */
@@ -67,6 +67,25 @@ static vfs_mount_t _test_vfs_mount = {
     .private_data = (void *)&fs_data,
 };
 
+static const constfs_file_t _nested_files[] = {
+    {
+        .path = "/nested.txt",
+        .data = str_data,
+        .size = sizeof(str_data),
+    },
+};
+
+static const constfs_t nested_fs_data = {
+    .files = _nested_files,
+    .nfiles = ARRAY_SIZE(_nested_files),
+};
+
+static vfs_mount_t _test_vfs_mount_nested = {
+    .mount_point = "/test/sub",
+    .fs = &constfs_file_system,
+    .private_data = (void *)&nested_fs_data,
+};
+
 static void test_vfs_mount_umount(void)
 {
     int res;
@@ -128,6 +147,35 @@ static void test_vfs_constfs_open(void)
     TEST_ASSERT_EQUAL_INT(0, res);
 }
 
+static void test_vfs_mount__nested(void)
+{
+    struct stat buf;
+    int res;
+
+    /* the longest matching mount point wins, regardless of the mount order */
+    res = vfs_mount(&_test_vfs_mount_nested);
+    TEST_ASSERT_EQUAL_INT(0, res);
+    res = vfs_mount(&_test_vfs_mount);
+    TEST_ASSERT_EQUAL_INT(0, res);
+
+    res = vfs_stat("/test/sub/nested.txt", &buf);
+    TEST_ASSERT_EQUAL_INT(0, res);
+    res = vfs_stat("/test/sub/test.txt", &buf);
+    TEST_ASSERT_EQUAL_INT(-ENOENT, res);
+    res = vfs_stat("/test/test.txt", &buf);
+    TEST_ASSERT_EQUAL_INT(0, res);
+    /* "/test/sub" is no prefix of "/test/subdir" */
+    res = vfs_stat("/test/subdir/nested.txt", &buf);
+    TEST_ASSERT_EQUAL_INT(-ENOENT, res);
+
+    res = vfs_umount(&_test_vfs_mount_nested, false);
+    TEST_ASSERT_EQUAL_INT(0, res);
+    res = vfs_stat("/test/sub/nested.txt", &buf);
+    TEST_ASSERT_EQUAL_INT(-ENOENT, res);
+    res = vfs_umount(&_test_vfs_mount, false);
+    TEST_ASSERT_EQUAL_INT(0, res);
+}
+
 static void test_vfs_constfs_read_lseek(void)
 {
     int res;
@@ -210,6 +258,7 @@ Test *tests_vfs_mount_constfs_tests(void)
         new_TestFixture(test_vfs_mount_umount),
         new_TestFixture(test_vfs_mount__invalid),
         new_TestFixture(test_vfs_umount__invalid_mount),
+        new_TestFixture(test_vfs_mount__nested),
         new_TestFixture(test_vfs_constfs_open),
         new_TestFixture(test_vfs_constfs_read_lseek),
 #if MODULE_NEWLIB || MODULE_PICOLIBC || defined(CPU_NATIVE)
@@ -0,0 +1,201 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ * @brief       Unittests for ztimer_wheel
+ */
+
+#include "ztimer.h"
+#include "ztimer/mock.h"
+
+#include "embUnit/embUnit.h"
+
+#include "tests-ztimer.h"
+
+#define TIMERS_NUMOF    (48U)
+#define STEPS_NUMOF     (4000U)
+
+static ztimer_mock_t _zmock;
+static ztimer_wheel_t _wheel;
+static ztimer_t _timers[TIMERS_NUMOF];
+static uint32_t _fired_at[TIMERS_NUMOF];
+static unsigned _fired[TIMERS_NUMOF];
+
+/* reference model: ticks until the timer fires */
+static uint32_t _remaining[TIMERS_NUMOF];
+static bool _armed[TIMERS_NUMOF];
+
+static uint32_t _rand_state;
+
+static uint32_t _rand(uint32_t max)
+{
+    _rand_state = _rand_state * 1103515245U + 12345U;
+    return (_rand_state >> 8) % max;
+}
+
+static void _cb_record(void *arg)
+{
+    unsigned idx = (ztimer_t *)arg - _timers;
+
+    _fired_at[idx] = _zmock.now;
+    _fired[idx]++;
+}
+
+static void _setup(uint32_t now)
+{
+    ztimer_mock_init(&_zmock, 32);
+    ztimer_mock_jump(&_zmock, now);
+    ztimer_wheel_init(&_zmock.super, &_wheel);
+    for (unsigned i = 0; i < TIMERS_NUMOF; i++) {
+        _timers[i] = (ztimer_t){ .callback = _cb_record, .arg = &_timers[i] };
+        _fired[i] = 0;
+        _armed[i] = false;
+    }
+}
+
+static uint32_t _rand_timeout(void)
+{
+    switch (_rand(8)) {
+    case 0:
+        return _rand(16);
+    case 1:
+    case 2:
+        return _rand(256);
+    case 3:
+    case 4:
+        return _rand(1LU << 12);
+    case 5:
+        return _rand(1LU << 20);
+    case 6:
+        return _rand(1LU << 28);
+    default:
+        return UINT32_MAX - _rand(1LU << 29);
+    }
+}
+
+static void _advance(uint32_t ticks)
+{
+    uint32_t before = _zmock.now;
+
+    ztimer_mock_advance(&_zmock, ticks);
+    for (unsigned i = 0; i < TIMERS_NUMOF; i++) {
+        if (_armed[i] && (_remaining[i] <= ticks)) {
+            TEST_ASSERT_EQUAL_INT(1, _fired[i]);
+            TEST_ASSERT_EQUAL_INT(before + _remaining[i], _fired_at[i]);
+            _armed[i] = false;
+        }
+        else {
+            TEST_ASSERT_EQUAL_INT(0, _fired[i]);
+            _remaining[i] -= ticks;
+        }
+        _fired[i] = 0;
+        TEST_ASSERT_EQUAL_INT(_armed[i],
+                              ztimer_is_set(&_zmock.super, &_timers[i]));
+    }
+}
+
+static void _run(uint32_t start)
+{
+    _rand_state = start;
+    _setup(start);
+    ztimer_acquire(&_zmock.super);
+
+    for (unsigned step = 0; step < STEPS_NUMOF; step++) {
+        unsigned idx = _rand(TIMERS_NUMOF);
+
+        switch (_rand(4)) {
+        case 0:
+            _remaining[idx] = _rand_timeout();
+            ztimer_set(&_zmock.super, &_timers[idx], _remaining[idx]);
+            _armed[idx] = true;
+            break;
+        case 1:
+            TEST_ASSERT_EQUAL_INT(_armed[idx],
+                                  ztimer_remove(&_zmock.super, &_timers[idx]));
+            _armed[idx] = false;
+            break;
+        default:
+            _advance((_rand(4) == 0) ? _rand(1LU << 16) : _rand(64));
+            break;
+        }
+    }
+    /* let everything due within 2^29 ticks expire, remove the rest */
+    _advance(1LU << 29);
+    for (unsigned i = 0; i < TIMERS_NUMOF; i++) {
+        TEST_ASSERT_EQUAL_INT(_armed[i],
+                              ztimer_remove(&_zmock.super, &_timers[i]));
+    }
+    TEST_ASSERT_NULL(_zmock.super.list.next);
+    ztimer_release(&_zmock.super);
+    TEST_ASSERT_EQUAL_INT(0, _zmock.armed);
+    TEST_ASSERT_EQUAL_INT(0, _zmock.running);
+}
+
+static void test_ztimer_wheel_random(void)
+{
+    _run(0);
+}
+
+static void test_ztimer_wheel_random_wrap(void)
+{
+    _run(UINT32_MAX - (1LU << 20));
+}
+
+static void test_ztimer_wheel_far(void)
+{
+    _setup(0x1f000000);
+    /* one tick before the current time, after wrapping around */
+    _remaining[0] = UINT32_MAX;
+    ztimer_set(&_zmock.super, &_timers[0], _remaining[0]);
+    _armed[0] = true;
+    /* keeps the wheel busy the whole time */
+    _remaining[1] = 0x30000000;
+    ztimer_set(&_zmock.super, &_timers[1], _remaining[1]);
+    _armed[1] = true;
+    for (unsigned i = 0; i < 5; i++) {
+        _advance(0x3fffffff);
+    }
+    TEST_ASSERT(!_armed[0] && !_armed[1]);
+    TEST_ASSERT_EQUAL_INT(0, _zmock.running);
+}
+
+static void test_ztimer_wheel_ondemand(void)
+{
+    _setup(0);
+    _remaining[0] = 1000;
+    ztimer_set(&_zmock.super, &_timers[0], _remaining[0]);
+    _armed[0] = true;
+    /* the timer and the wheel's timer use the clock */
+    TEST_ASSERT_EQUAL_INT(2, _zmock.super.users);
+    TEST_ASSERT_EQUAL_INT(1, _zmock.running);
+    _advance(500);
+    TEST_ASSERT(ztimer_remove(&_zmock.super, &_timers[0]));
+    _armed[0] = false;
+    TEST_ASSERT_EQUAL_INT(0, _zmock.super.users);
+    TEST_ASSERT_EQUAL_INT(0, _zmock.running);
+    TEST_ASSERT_NULL(_zmock.super.list.next);
+}
+
+Test *tests_ztimer_wheel_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_ztimer_wheel_random),
+        new_TestFixture(test_ztimer_wheel_random_wrap),
+        new_TestFixture(test_ztimer_wheel_far),
+        new_TestFixture(test_ztimer_wheel_ondemand),
+    };
+
+    EMB_UNIT_TESTCALLER(ztimer_tests, NULL, NULL, fixtures);
+
+    return (Test *)&ztimer_tests;
+}
+
+/** @} */